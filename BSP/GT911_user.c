@@ -93,4 +93,31 @@ GT911_Status_t GT911_I2C_Read(uint8_t Addr, uint8_t* read_data, uint16_t read_le
 	}
 	return HAL_ERROR;
 }
+
+static GT911_Status_t GT911_HAL_Status(HAL_StatusTypeDef status){
+	switch (status) {
+	case HAL_OK:
+		return GT911_OK;
+	case HAL_ERROR:
+		return GT911_Error;
+	case HAL_BUSY:
+	case HAL_TIMEOUT:
+		return GT911_NotResponse;
+	}
+	return GT911_Error;
+}
+
+/* Non-blocking transfers of the background read. They complete in the I2C4 interrupts,
+ * see HAL_I2C_MemRxCpltCallback(), HAL_I2C_MemTxCpltCallback() and HAL_I2C_ErrorCallback() */
+GT911_Status_t GT911_I2C_ReadRegAsync(uint16_t reg, uint8_t* read_data, uint16_t read_length){
+	return GT911_HAL_Status(HAL_I2C_Mem_Read_IT(&hi2c4, GOODIX_ADDRESS << 1, reg, I2C_MEMADD_SIZE_16BIT, read_data, read_length));
+}
+
+GT911_Status_t GT911_I2C_WriteRegAsync(uint16_t reg, uint8_t* write_data, uint16_t write_length){
+	return GT911_HAL_Status(HAL_I2C_Mem_Write_IT(&hi2c4, GOODIX_ADDRESS << 1, reg, I2C_MEMADD_SIZE_16BIT, write_data, write_length));
+}
+
+uint32_t GT911_GetTick(void){
+	return HAL_GetTick();
+}
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -223,26 +223,27 @@ GT911_Status_t GT911_ReadTouch(TouchCoordinate_t *cordinate, uint8_t *number_of_
             // Read coordinates for each touch point
             for (uint8_t i = 0; i < *number_of_cordinate; i++) {
                 // Calculate address for each touch point (each point = 8 bytes)
-                uint16_t point_addr = GOODIX_POINT1_X_ADDR + (i * GT911_TOUCH_POINT_SIZE);
+                uint16_t point_addr = GOODIX_POINT1_TRACK_ID_ADDR + (i * GT911_TOUCH_POINT_SIZE);
 
                 // Set read address
                 TxBuffer[0] = (point_addr >> 8) & 0xFF;
                 TxBuffer[1] = point_addr & 0xFF;
 
-                // Write address and read 6 bytes (X_L, X_H, Y_L, Y_H, Size, Reserved)
+                // Write address and read 7 bytes (Track ID, X_L, X_H, Y_L, Y_H, Size_L, Size_H)
                 result = GT911_I2C_Write(GOODIX_ADDRESS, TxBuffer, 2);
                 if (result != GT911_OK) {
                     return result;
                 }
 
-                result = GT911_I2C_Read(GOODIX_ADDRESS, RxBuffer, 6);
+                result = GT911_I2C_Read(GOODIX_ADDRESS, RxBuffer, 7);
                 if (result != GT911_OK) {
                     return result;
                 }
 
                 // Combine low and high bytes to get coordinates
-                cordinate[i].x = RxBuffer[0] | (RxBuffer[1] << 8);
-                cordinate[i].y = RxBuffer[2] | (RxBuffer[3] << 8);
+                cordinate[i].id = RxBuffer[0];
+                cordinate[i].x = RxBuffer[1] | (RxBuffer[2] << 8);
+                cordinate[i].y = RxBuffer[3] | (RxBuffer[4] << 8);
 
                 // Debug output (can be disabled)
                 #ifdef GT911_DEBUG
@@ -36,6 +36,7 @@
 
 // Coordinate registers
 #define GOODIX_READ_COORD_ADDR      0x814E  // Coordinate status register
+#define GOODIX_POINT1_TRACK_ID_ADDR 0x814F  // First touch point tracking ID
 #define GOODIX_POINT1_X_ADDR        0x8150  // First touch point X coordinate
 #define GOODIX_POINT1_Y_ADDR        0x8152  // First touch point Y coordinate
 
@@ -45,6 +46,9 @@
 // Maximum number of supported touch points
 #define GT911_MAX_TOUCH_POINTS      5
 
+// Number of touch samples buffered by the background read (must be a power of 2)
+#define GT911_SAMPLE_RING_SIZE      16
+
 // Command definitions for GOODIX_REG_COMMAND
 #define GOODIX_CMD_READ             0x00    // Read coordinate state
 #define GOODIX_CMD_DIFFVAL          0x01    // Read difference value
@@ -85,8 +89,18 @@ typedef struct {
 typedef struct {
     uint16_t x;     // X coordinate
     uint16_t y;     // Y coordinate
+    uint8_t id;     // Tracking ID, the same while the finger touches
 } TouchCoordinate_t;
 
+/**
+ * @brief Touch sample acquired by the background read
+ */
+typedef struct {
+    uint32_t tick;                                      // GT911_GetTick() at the interrupt of the sample
+    uint8_t count;                                      // Number of touch points (0 = released)
+    TouchCoordinate_t points[GT911_MAX_TOUCH_POINTS];   // Coordinates of the touch points
+} GT911_Sample_t;
+
 /* Exported constants --------------------------------------------------------*/
 
 /* Exported functions ------------------------------------------------------- */
@@ -113,6 +127,41 @@ GT911_Status_t GT911_InitWithConfig(GT911_Config_t config);
  */
 GT911_Status_t GT911_ReadTouch(TouchCoordinate_t* cordinate, uint8_t* number_of_cordinate);
 
+/**
+ * @brief Start reading the touch points in the background
+ * @note Call it from the interrupt of the INT pin. The status and all the touch points
+ *       are read in one I2C burst and the result is queued as a GT911_Sample_t.
+ *       If a read is already in progress an other one is started after it.
+ * @return GT911_Status_t Status of starting the transfer
+ */
+GT911_Status_t GT911_ReadTouchAsync(void);
+
+/**
+ * @brief Continue the background read after an I2C transfer has completed
+ * @note Call it from the I2C transfer complete and error interrupts
+ * @param result GT911_OK or the error of the transfer
+ */
+void GT911_I2C_TransferDone(GT911_Status_t result);
+
+/**
+ * @brief Take the oldest touch sample queued by the background read
+ * @param sample Pointer to store the sample
+ * @return true if a sample was taken, false if the queue is empty
+ */
+bool GT911_GetSample(GT911_Sample_t *sample);
+
+/**
+ * @brief Check if there is a queued touch sample
+ * @return true if GT911_GetSample() will return a sample
+ */
+bool GT911_IsSampleAvailable(void);
+
+/**
+ * @brief Get the number of samples lost because the queue was full
+ * @return uint32_t Number of dropped samples
+ */
+uint32_t GT911_GetDroppedSamples(void);
+
 /**
  * @brief Set device mode (working, sleep, etc.)
  * @param mode Device mode (0x00 = working, 0x01 = sleep, 0x04 = factory)
@@ -162,4 +211,17 @@ void GT911_Delay(uint16_t ms);          // Delay function
 GT911_Status_t GT911_I2C_Write(uint8_t Addr, uint8_t* write_data, uint16_t write_length);
 GT911_Status_t GT911_I2C_Read(uint8_t Addr, uint8_t* read_data, uint16_t read_length);
 
+// Non-blocking register access for the background read: start the transfer and
+// call GT911_I2C_TransferDone() from the interrupt when it has completed
+GT911_Status_t GT911_I2C_ReadRegAsync(uint16_t reg, uint8_t* read_data, uint16_t read_length);
+GT911_Status_t GT911_I2C_WriteRegAsync(uint16_t reg, uint8_t* write_data, uint16_t write_length);
+uint32_t GT911_GetTick(void);           // Millisecond tick for the sample time stamps
+
+#if GT911_I2C_STUB
+// Host stand-in of the platform functions (gt911_i2c_stub.c)
+void GT911_Stub_SetTouch(const TouchCoordinate_t* points, uint8_t count);  // New report of the device
+bool GT911_Stub_CompleteTransfer(GT911_Status_t result);                   // Finish the pending transfer
+void GT911_Stub_SetTick(uint32_t tick);
+#endif
+
 #endif /* __GT911_H_ */
@@ -0,0 +1,215 @@
+/* Includes ------------------------------------------------------------------*/
+#include "GT911.h"
+
+/*
+ * Background touch acquisition
+ *
+ * The INT pin interrupt starts a non-blocking read of the status register and all
+ * the touch points in one burst. The first point starts right after the status,
+ * with its track ID at 0x814F. When the read has completed the touch points are
+ * queued and the status register is cleared with a non-blocking write. The transfers complete in interrupts, so the main loop never
+ * waits for the I2C bus.
+ *
+ * The queue is a single producer (interrupts), single consumer (main loop) ring.
+ * The producer writes only the head and the consumer writes only the tail, so no
+ * locking is required. A sample is dropped if the ring is full.
+ *
+ * This file depends only on the platform functions declared in GT911.h, so it can be
+ * built on a host with the stand-in in gt911_i2c_stub.c.
+ */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum {
+    GT911_ASYNC_IDLE,       // No transfer in progress
+    GT911_ASYNC_READING,    // Reading the status and the touch points
+    GT911_ASYNC_CLEARING    // Clearing the status register
+} GT911_AsyncState_t;
+
+/* Private define ------------------------------------------------------------*/
+#define STATUS_BUFFER_READY     0x80    // New coordinates are available
+#define STATUS_POINT_NUM_MASK   0x0F    // Number of touch points
+
+// Status register and all the touch points, the first starts with its track ID (0x814F)
+#define BURST_SIZE              (2 + GT911_MAX_TOUCH_POINTS * GT911_TOUCH_POINT_SIZE)
+#define BURST_POINT_OFFSET      (GOODIX_POINT1_X_ADDR - GOODIX_READ_COORD_ADDR)
+
+#define RING_MASK               (GT911_SAMPLE_RING_SIZE - 1)
+
+#if (GT911_SAMPLE_RING_SIZE & RING_MASK) != 0
+#error "GT911_SAMPLE_RING_SIZE must be a power of 2"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+
+// Keep the writes of a sample before the update of the head index.
+// The producer and the consumer run on the same core, so a compiler barrier is enough.
+#define GT911_COMPILER_BARRIER()    __asm volatile ("" ::: "memory")
+
+/* Private variables ---------------------------------------------------------*/
+static volatile GT911_AsyncState_t async_state = GT911_ASYNC_IDLE;
+static volatile bool read_pending;
+static volatile uint32_t irq_tick;
+static uint32_t burst_tick;     // irq_tick when the burst read has started
+
+/* Transfer buffers, they must stay valid until the transfer completes */
+static uint8_t burst_buffer[BURST_SIZE];
+static uint8_t clear_status;
+
+/* Sample ring, the indexes run freely and are masked on access */
+static GT911_Sample_t sample_ring[GT911_SAMPLE_RING_SIZE];
+static volatile uint32_t ring_head;
+static volatile uint32_t ring_tail;
+static volatile uint32_t dropped_samples;
+
+/* Private function prototypes -----------------------------------------------*/
+static GT911_Status_t GT911_StartRead(void);
+static void GT911_PushSample(uint8_t point_num);
+
+/* API Implementation --------------------------------------------------------*/
+
+/**
+ * @brief Start reading the touch points in the background
+ *
+ * Called from the INT pin interrupt. If a transfer is in progress the read is
+ * started when it completes, so a report of the device is not missed.
+ *
+ * @return GT911_Status_t Status of starting the transfer
+ */
+GT911_Status_t GT911_ReadTouchAsync(void)
+{
+    irq_tick = GT911_GetTick();
+
+    if (async_state != GT911_ASYNC_IDLE) {
+        read_pending = true;
+        return GT911_OK;
+    }
+
+    return GT911_StartRead();
+}
+
+/**
+ * @brief Continue the background read after an I2C transfer has completed
+ *
+ * @param result GT911_OK or the error of the transfer
+ */
+void GT911_I2C_TransferDone(GT911_Status_t result)
+{
+    switch (async_state) {
+    case GT911_ASYNC_READING:
+        if (result == GT911_OK && (burst_buffer[0] & STATUS_BUFFER_READY) != 0) {
+            uint8_t point_num = burst_buffer[0] & STATUS_POINT_NUM_MASK;
+            if (point_num <= GT911_MAX_TOUCH_POINTS) {
+                GT911_PushSample(point_num);
+            }
+
+            // Clear the buffer status to let the device report the next coordinates
+            clear_status = 0;
+            async_state = GT911_ASYNC_CLEARING;
+            if (GT911_I2C_WriteRegAsync(GOODIX_READ_COORD_ADDR, &clear_status, 1) == GT911_OK) {
+                return;
+            }
+        }
+        break;
+
+    case GT911_ASYNC_CLEARING:
+        break;
+
+    default:
+        // Not our transfer
+        return;
+    }
+
+    async_state = GT911_ASYNC_IDLE;
+    if (read_pending) {
+        GT911_StartRead();
+    }
+}
+
+/**
+ * @brief Take the oldest touch sample queued by the background read
+ *
+ * @param sample Pointer to store the sample
+ * @return true if a sample was taken, false if the queue is empty
+ */
+bool GT911_GetSample(GT911_Sample_t *sample)
+{
+    uint32_t tail = ring_tail;
+    if (tail == ring_head) {
+        return false;
+    }
+
+    *sample = sample_ring[tail & RING_MASK];
+    GT911_COMPILER_BARRIER();
+    ring_tail = tail + 1;
+
+    return true;
+}
+
+/**
+ * @brief Check if there is a queued touch sample
+ *
+ * @return true if GT911_GetSample() will return a sample
+ */
+bool GT911_IsSampleAvailable(void)
+{
+    return ring_tail != ring_head;
+}
+
+/**
+ * @brief Get the number of samples lost because the queue was full
+ *
+ * @return uint32_t Number of dropped samples
+ */
+uint32_t GT911_GetDroppedSamples(void)
+{
+    return dropped_samples;
+}
+
+/* Private functions Implementation -----------------------------------------*/
+
+/**
+ * @brief Start the burst read of the status and the touch points
+ *
+ * @return GT911_Status_t Status of starting the transfer
+ */
+static GT911_Status_t GT911_StartRead(void)
+{
+    read_pending = false;
+    burst_tick = irq_tick;
+    async_state = GT911_ASYNC_READING;
+
+    GT911_Status_t result = GT911_I2C_ReadRegAsync(GOODIX_READ_COORD_ADDR, burst_buffer, BURST_SIZE);
+    if (result != GT911_OK) {
+        async_state = GT911_ASYNC_IDLE;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Queue the touch points of the completed burst read
+ *
+ * @param point_num Number of touch points in the burst
+ */
+static void GT911_PushSample(uint8_t point_num)
+{
+    uint32_t head = ring_head;
+    if (head - ring_tail >= GT911_SAMPLE_RING_SIZE) {
+        dropped_samples++;
+        return;
+    }
+
+    GT911_Sample_t *sample = &sample_ring[head & RING_MASK];
+    sample->tick = burst_tick;
+    sample->count = point_num;
+    for (uint8_t i = 0; i < point_num; i++) {
+        // Track ID, X_L, X_H, Y_L, Y_H of the point
+        const uint8_t *p = &burst_buffer[BURST_POINT_OFFSET - 1 + i * GT911_TOUCH_POINT_SIZE];
+        sample->points[i].id = p[0];
+        sample->points[i].x = p[1] | (p[2] << 8);
+        sample->points[i].y = p[3] | (p[4] << 8);
+    }
+
+    GT911_COMPILER_BARRIER();
+    ring_head = head + 1;
+}
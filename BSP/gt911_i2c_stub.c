@@ -0,0 +1,125 @@
+/*
+ * Host stand-in of the GT911 platform functions
+ *
+ * Emulates the coordinate registers of the device and holds the non-blocking
+ * transfers until GT911_Stub_CompleteTransfer() is called, the way the I2C
+ * interrupt completes them on the board. Build it with GT911_I2C_STUB=1 together
+ * with gt911_async.c instead of GT911_user.c. BSP/test/gt911_async_test.c drives
+ * it, run it with `make -C BSP/test`.
+ */
+
+#if GT911_I2C_STUB
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "GT911.h"
+
+/* Private define ------------------------------------------------------------*/
+#define STUB_REG_FIRST      GOODIX_READ_COORD_ADDR
+#define STUB_REG_NUM        (2 + GT911_MAX_TOUCH_POINTS * GT911_TOUCH_POINT_SIZE)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t stub_regs[STUB_REG_NUM];
+static uint32_t stub_tick;
+
+/* The transfer in progress */
+static bool xfer_active;
+static bool xfer_write;
+static uint16_t xfer_reg;
+static uint8_t *xfer_data;
+static uint16_t xfer_length;
+
+/* Platform functions --------------------------------------------------------*/
+
+GT911_Status_t GT911_I2C_ReadRegAsync(uint16_t reg, uint8_t *read_data, uint16_t read_length)
+{
+    if (xfer_active) {
+        return GT911_NotResponse;   // Bus busy
+    }
+
+    xfer_active = true;
+    xfer_write = false;
+    xfer_reg = reg;
+    xfer_data = read_data;
+    xfer_length = read_length;
+    return GT911_OK;
+}
+
+GT911_Status_t GT911_I2C_WriteRegAsync(uint16_t reg, uint8_t *write_data, uint16_t write_length)
+{
+    if (xfer_active) {
+        return GT911_NotResponse;
+    }
+
+    xfer_active = true;
+    xfer_write = true;
+    xfer_reg = reg;
+    xfer_data = write_data;
+    xfer_length = write_length;
+    return GT911_OK;
+}
+
+uint32_t GT911_GetTick(void)
+{
+    return stub_tick;
+}
+
+/* Stub control --------------------------------------------------------------*/
+
+/**
+ * @brief Latch a new report in the coordinate registers like the device does
+ *
+ * @param points Coordinates of the touch points
+ * @param count Number of touch points (0 = released)
+ */
+void GT911_Stub_SetTouch(const TouchCoordinate_t *points, uint8_t count)
+{
+    memset(stub_regs, 0, sizeof(stub_regs));
+    stub_regs[0] = 0x80 | count;
+    for (uint8_t i = 0; i < count && i < GT911_MAX_TOUCH_POINTS; i++) {
+        uint8_t *p = &stub_regs[GOODIX_POINT1_TRACK_ID_ADDR - STUB_REG_FIRST + i * GT911_TOUCH_POINT_SIZE];
+        p[0] = points[i].id;
+        p[1] = points[i].x & 0xFF;
+        p[2] = points[i].x >> 8;
+        p[3] = points[i].y & 0xFF;
+        p[4] = points[i].y >> 8;
+    }
+}
+
+/**
+ * @brief Finish the transfer in progress and call GT911_I2C_TransferDone()
+ *
+ * @param result GT911_OK or the error to report
+ * @return true if there was a transfer in progress
+ */
+bool GT911_Stub_CompleteTransfer(GT911_Status_t result)
+{
+    if (!xfer_active) {
+        return false;
+    }
+
+    if (result == GT911_OK) {
+        for (uint16_t i = 0; i < xfer_length; i++) {
+            uint32_t r = xfer_reg + i - STUB_REG_FIRST;
+            if (r >= STUB_REG_NUM) {
+                break;
+            }
+            if (xfer_write) {
+                stub_regs[r] = xfer_data[i];
+            } else {
+                xfer_data[i] = stub_regs[r];
+            }
+        }
+    }
+
+    xfer_active = false;
+    GT911_I2C_TransferDone(result);
+    return true;
+}
+
+void GT911_Stub_SetTick(uint32_t tick)
+{
+    stub_tick = tick;
+}
+
+#endif /* GT911_I2C_STUB */
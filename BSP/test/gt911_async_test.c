@@ -0,0 +1,236 @@
+/*
+ * Host test of the GT911 background read
+ *
+ * Runs gt911_async.c against the I2C stand-in in gt911_i2c_stub.c. The test plays
+ * the INT pin interrupt with GT911_ReadTouchAsync() and the I2C interrupt with
+ * GT911_Stub_CompleteTransfer(). Build and run it with `make -C BSP/test`.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include "GT911.h"
+
+/* Private macro -------------------------------------------------------------*/
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: %s: check failed: %s\n",                         \
+                   __FILE__, __LINE__, __func__, #cond);                    \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/* Private variables ---------------------------------------------------------*/
+static int failures;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief Latch a single point report with the given coordinates
+ */
+static void set_point(uint8_t id, uint16_t x, uint16_t y)
+{
+    TouchCoordinate_t p = { .x = x, .y = y, .id = id };
+    GT911_Stub_SetTouch(&p, 1);
+}
+
+/**
+ * @brief Play an INT edge and complete the burst read and the status clear
+ */
+static void touch_event(uint32_t tick)
+{
+    GT911_Stub_SetTick(tick);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Burst read
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Status clear
+    CHECK(!GT911_Stub_CompleteTransfer(GT911_OK));  // Idle again
+}
+
+static void drain(void)
+{
+    GT911_Sample_t s;
+    while (GT911_GetSample(&s)) {
+    }
+}
+
+/* Tests ---------------------------------------------------------------------*/
+
+static void test_ring_order(void)
+{
+    for (uint16_t i = 0; i < 4; i++) {
+        set_point(i, 100 + i, 200 + i);
+        touch_event(10 * i);
+    }
+
+    // Two fingers, the second point comes from the second slot of the burst
+    TouchCoordinate_t two[2] = { { 10, 20, 3 }, { 700, 400, 7 } };
+    GT911_Stub_SetTouch(two, 2);
+    touch_event(50);
+
+    // Released
+    GT911_Stub_SetTouch(NULL, 0);
+    touch_event(60);
+
+    GT911_Sample_t s;
+    for (uint16_t i = 0; i < 4; i++) {
+        CHECK(GT911_GetSample(&s));
+        CHECK(s.tick == 10u * i);
+        CHECK(s.count == 1);
+        CHECK(s.points[0].id == i);
+        CHECK(s.points[0].x == 100 + i);
+        CHECK(s.points[0].y == 200 + i);
+    }
+
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.count == 2);
+    CHECK(s.points[0].id == 3 && s.points[0].x == 10 && s.points[0].y == 20);
+    CHECK(s.points[1].id == 7 && s.points[1].x == 700 && s.points[1].y == 400);
+
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.tick == 60);
+    CHECK(s.count == 0);
+
+    CHECK(!GT911_IsSampleAvailable());
+    CHECK(!GT911_GetSample(&s));
+}
+
+static void test_pending_reread(void)
+{
+    GT911_Sample_t s;
+
+    set_point(1, 10, 10);
+    GT911_Stub_SetTick(100);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+
+    // INT during the burst read: the read is repeated after the status clear
+    GT911_Stub_SetTick(105);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Burst read
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Status clear, starts the re-read
+    set_point(1, 20, 20);                           // The device latches the next report
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Re-read
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Status clear
+    CHECK(!GT911_Stub_CompleteTransfer(GT911_OK));
+
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.tick == 100 && s.points[0].x == 10);
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.tick == 105 && s.points[0].x == 20);
+    CHECK(!GT911_GetSample(&s));
+
+    // INT during the status clear
+    set_point(1, 30, 30);
+    GT911_Stub_SetTick(110);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Burst read
+    GT911_Stub_SetTick(115);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Status clear, starts the re-read
+    set_point(1, 40, 40);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Re-read
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Status clear
+    CHECK(!GT911_Stub_CompleteTransfer(GT911_OK));
+
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.tick == 110 && s.points[0].x == 30);
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.tick == 115 && s.points[0].x == 40);
+    CHECK(!GT911_GetSample(&s));
+}
+
+static void test_full_ring_drops(void)
+{
+    GT911_Sample_t s;
+    uint32_t dropped = GT911_GetDroppedSamples();
+
+    // The newest samples are dropped, the queued ones are kept
+    for (uint16_t i = 0; i < GT911_SAMPLE_RING_SIZE + 3; i++) {
+        set_point(0, i, 0);
+        touch_event(1000 + i);
+    }
+    CHECK(GT911_GetDroppedSamples() - dropped == 3);
+
+    for (uint16_t i = 0; i < GT911_SAMPLE_RING_SIZE; i++) {
+        CHECK(GT911_GetSample(&s));
+        CHECK(s.points[0].x == i);
+    }
+    CHECK(!GT911_GetSample(&s));
+
+    // There is room again
+    set_point(0, 500, 0);
+    touch_event(2000);
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.points[0].x == 500);
+    CHECK(GT911_GetDroppedSamples() - dropped == 3);
+}
+
+static void test_error_path(void)
+{
+    GT911_Sample_t s;
+    uint32_t dropped = GT911_GetDroppedSamples();
+
+    // Failed burst read: nothing is queued, no clear is started
+    set_point(2, 50, 60);
+    GT911_Stub_SetTick(3000);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_I2C_Error));
+    CHECK(!GT911_Stub_CompleteTransfer(GT911_OK));
+    CHECK(!GT911_IsSampleAvailable());
+
+    // The next INT reads the report that is still latched
+    touch_event(3010);
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.tick == 3010 && s.points[0].x == 50 && s.points[0].y == 60);
+
+    // Status not ready (already cleared): nothing is queued, no clear is started
+    GT911_Stub_SetTick(3020);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));
+    CHECK(!GT911_Stub_CompleteTransfer(GT911_OK));
+    CHECK(!GT911_IsSampleAvailable());
+
+    // Failed read with an INT pending: the read is restarted
+    set_point(2, 70, 80);
+    GT911_Stub_SetTick(3030);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    GT911_Stub_SetTick(3035);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_I2C_Error));
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Re-read
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));   // Status clear
+    CHECK(!GT911_Stub_CompleteTransfer(GT911_OK));
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.tick == 3035 && s.points[0].x == 70);
+
+    // Failed status clear: the sample is kept and the state machine gets idle
+    set_point(2, 90, 90);
+    GT911_Stub_SetTick(3040);
+    CHECK(GT911_ReadTouchAsync() == GT911_OK);
+    CHECK(GT911_Stub_CompleteTransfer(GT911_OK));
+    CHECK(GT911_Stub_CompleteTransfer(GT911_I2C_Error));
+    CHECK(!GT911_Stub_CompleteTransfer(GT911_OK));
+    CHECK(GT911_GetSample(&s));
+    CHECK(s.tick == 3040 && s.points[0].x == 90);
+
+    CHECK(!GT911_GetSample(&s));
+    CHECK(GT911_GetDroppedSamples() == dropped);
+}
+
+int main(void)
+{
+    test_ring_order();
+    drain();
+    test_pending_reread();
+    drain();
+    test_full_ring_drops();
+    drain();
+    test_error_path();
+
+    if (failures != 0) {
+        printf("gt911_async_test: %d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("gt911_async_test: OK\n");
+    return 0;
+}
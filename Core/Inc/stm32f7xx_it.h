@@ -50,6 +50,8 @@
 void SysTick_Handler(void);
 void EXTI9_5_IRQHandler(void);
 void DMA2_Stream0_IRQHandler(void);
+void I2C4_EV_IRQHandler(void);
+void I2C4_ER_IRQHandler(void);
 /* USER CODE BEGIN EFP */
 
 /* USER CODE END EFP */
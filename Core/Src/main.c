@@ -33,6 +33,8 @@
 #include "demos/lv_demos.h"
 #include "lv_port_disp.h"
 #include "lv_port_indev.h"
+#include "lv_port_tick.h"
+#include "lv_port_trace.h"
 #include "stm32746g_lcd.h"
 #include "stm32746g_sdram.h"
 #include "GT911.h"
@@ -57,7 +59,6 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
-uint8_t TS_flag;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -68,6 +69,34 @@ void SystemClock_Config(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/**
+ * SDRAM (framebuffers + LVGL bulk heap) as normal write-back memory.
+ * By default 0xD0000000 is device memory: uncached and unaligned access faults.
+ * The DMA2D driver of LVGL cleans the D-cache before a transfer and invalidates
+ * the written memory when it's ready, so the CPU doesn't read stale lines.
+ */
+static void SDRAM_MPU_Config(void)
+{
+	MPU_Region_InitTypeDef MPU_InitStruct = { 0 };
+
+	HAL_MPU_Disable();
+
+	MPU_InitStruct.Enable = MPU_REGION_ENABLE;
+	MPU_InitStruct.Number = MPU_REGION_NUMBER0;
+	MPU_InitStruct.BaseAddress = 0xD0000000;
+	MPU_InitStruct.Size = MPU_REGION_SIZE_8MB;
+	MPU_InitStruct.SubRegionDisable = 0x00;
+	MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL1;
+	MPU_InitStruct.AccessPermission = MPU_REGION_FULL_ACCESS;
+	MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+	MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+	MPU_InitStruct.IsCacheable = MPU_ACCESS_CACHEABLE;
+	MPU_InitStruct.IsBufferable = MPU_ACCESS_BUFFERABLE;
+	HAL_MPU_ConfigRegion(&MPU_InitStruct);
+
+	HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+}
+
 void TP_INT_Init()
 {
 	GPIO_InitTypeDef GPIO_InitStruct = { 0 };
@@ -89,7 +118,7 @@ void TP_INT_Init()
 int main(void)
 {
 	/* USER CODE BEGIN 1 */
-
+	SDRAM_MPU_Config();
 	/* USER CODE END 1 */
 
 	/* Enable I-Cache---------------------------------------------------------*/
@@ -141,6 +170,8 @@ int main(void)
 	lv_port_disp_init();
 	lv_port_indev_init();
 	lv_demo_widgets();
+	lv_port_tick_init();
+	lv_port_trace_init();
 
 	/* USER CODE END 2 */
 
@@ -151,8 +182,10 @@ int main(void)
 		/* USER CODE END WHILE */
 
 		/* USER CODE BEGIN 3 */
-		lv_task_handler();
-		HAL_Delay(50);
+		/* Sleep until the next LVGL timer or until an interrupt (e.g. touch) */
+		lv_port_indev_check_touch();
+		uint32_t time_till_next = lv_timer_handler();
+		lv_port_tick_sleep(time_till_next);
 	}
 	/* USER CODE END 3 */
 }
@@ -231,12 +264,40 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 	{
 		if (HAL_GPIO_ReadPin(GPIOD, GPIO_PIN_7) == GPIO_PIN_RESET)
 		{
-			TS_flag = 1;
-			printf("click\r\n");
+			/* Read the touch points in the background, the I2C4 interrupts complete it */
+			lv_port_trace_input_irq();
+			GT911_ReadTouchAsync();
 		}
 	}
 }
 
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance == I2C4)
+	{
+		lv_port_trace_input_acquired();
+		GT911_I2C_TransferDone(GT911_OK);
+		/* A sample may have been queued for the touchpad */
+		lv_port_tick_wake();
+	}
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance == I2C4)
+	{
+		GT911_I2C_TransferDone(GT911_OK);
+	}
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance == I2C4)
+	{
+		GT911_I2C_TransferDone(GT911_I2C_Error);
+	}
+}
+
 #ifdef __GNUC__
 #define PUTCHAR_PROTOTYPE int __io_putchar(int ch)
 #else
@@ -59,6 +59,20 @@
         #undef LV_MEM_POOL_ALLOC
     #endif
 
+    /*Use a second, "bulk" memory pool (e.g. in external SDRAM) for large or rarely used data
+     *such as layers, decoded images, caches and table cells. Small objects stay in the main pool above.*/
+    #define LV_MEM_EXT 0
+    #if LV_MEM_EXT
+        /*Size of the bulk memory pool in bytes*/
+        #define LV_MEM_EXT_SIZE (1024U * 1024U)
+
+        /*Set an address for the bulk pool instead of allocating it as a normal array.*/
+        #define LV_MEM_EXT_ADR 0     /*0: unused*/
+
+        /*Allocations without explicit hint and at least this large go to the bulk pool*/
+        #define LV_MEM_EXT_THRESHOLD (2U * 1024U)
+    #endif
+
 #else       /*LV_MEM_CUSTOM*/
     #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
     #define LV_MEM_CUSTOM_ALLOC   malloc
@@ -70,6 +84,18 @@
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
 
+/*Size of a scratch arena used by `lv_mem_buf_get()` while an area is being rendered.
+ *Buffers are bump allocated from it and all of them are dropped when the area is ready,
+ *so rendering doesn't touch the heap at all. Requests which don't fit use the buffers above.
+ *0: disable the arena*/
+#define LV_MEM_SCRATCH_SIZE 0
+
+/*Size of the region used by the slab allocator in bytes.
+ *Small allocations (objects, style arrays, animations, timers, event descriptors, ...) are served
+ *from 1 kB pages cut into fixed size blocks, so they are allocated and freed in O(1) and don't fragment the heap.
+ *Larger ones and the ones which don't fit go to the heap. 0: disable the slab allocator*/
+#define LV_MEM_SLAB_SIZE 0
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD 0
 
@@ -80,9 +106,41 @@
 /*Default display refresh period. LVG will redraw changed areas with this period time*/
 #define LV_DISP_DEF_REFR_PERIOD 30      /*[ms]*/
 
+/*1: In `direct_mode` move the rendered pixels of the objects with `LV_OBJ_FLAG_SCROLL_BLIT` when they are scrolled
+ *and redraw only the exposed part. With two buffers LVGL also copies the changes of the last frame to the other buffer.*/
+#define LV_USE_SCROLL_BLIT 0
+
+/*1: Show the horizontal `LV_SCR_LOAD_ANIM_MOVE_LEFT/RIGHT` screen loads and the scrolling of full-screen objects
+ *with `LV_OBJ_FLAG_SCROLL_PAN` (e.g. tileviews) by panning pre-rendered screens with the `pan_cb` of the display driver*/
+#define LV_USE_DISP_PAN 0
+
+/*1: Render the top and system layers into the ARGB4444 `overlay_buf` of the display driver instead of the screen.
+ *The display controller blends it onto the screen (e.g. with a second LTDC layer), so overlays don't redraw the screen*/
+#define LV_USE_DISP_OVERLAY 0
+
+/*1: Show the `LV_SCR_LOAD_ANIM_FADE_IN/OUT` screen loads by rendering both screens once and
+ *changing only the opacity of a display controller layer with the `fade_cb` of the display driver*/
+#define LV_USE_DISP_FADE 0
+
+/*1: With `direct_mode` and one buffer render the invalidated areas in horizontal bands right behind the scanning
+ *of the display (see `scan_line_cb` of the display driver), so a single frame buffer is enough without tearing*/
+#define LV_USE_DISP_BEAM 0
+#if LV_USE_DISP_BEAM
+    /*Height of a band in lines*/
+    #define LV_DISP_BEAM_BAND_H 64
+#endif
+
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*1: Add a One-Euro filter and a linear prediction stage to the pointer input devices.
+ *Enable it for an input device by setting `filter` in its `lv_indev_drv_t`*/
+#define LV_USE_INDEV_FILTER 0
+
+/*Max. number of touch points read from the pointer input devices (e.g. 5 for GT911), 0: disable.
+ *Pinch, rotate and pan with two fingers are sent as `LV_EVENT_MULTI_GESTURE` once in every refresh period*/
+#define LV_INDEV_MULTI_TOUCH_MAX 0
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 0
@@ -280,6 +338,25 @@
     #define LV_USE_MEM_MONITOR_POS LV_ALIGN_BOTTOM_LEFT
 #endif
 
+/*1: Record every `lv_mem_alloc/realloc/free` with the caller's address, size and frame number
+ *as a binary stream. Start it with `lv_mem_profiler_start(write_cb)` and process the output
+ *with `scripts/lv_mem_profile.py` to see peak usage, churn and leaks per call site*/
+#define LV_USE_MEM_PROFILER 0
+#if LV_USE_MEM_PROFILER
+    /*Size of the buffer collecting the records before they are passed to the write callback [bytes]*/
+    #define LV_MEM_PROFILER_BUF_SIZE 256
+#endif
+
+/*1: Measure the latency from an input event to the display showing its result (e.g. touch-to-photon).
+ *LVGL and the port mark the steps of the path with `lv_latency_trace_point()` and
+ *`lv_latency_trace_report()` prints the min/mean/max and a histogram of the latency of each step*/
+#define LV_USE_LATENCY_TRACE 0
+#if LV_USE_LATENCY_TRACE
+    #define LV_LATENCY_TRACE_TIME_INCLUDE <stdint.h>    /*Header for the time stamp expression*/
+    #define LV_LATENCY_TRACE_TIME_EXPR (lv_tick_get())  /*Expression evaluating to a free running 32 bit time stamp*/
+    #define LV_LATENCY_TRACE_TIME_FREQ 1000             /*Frequency of the time stamp [Hz]*/
+#endif
+
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
@@ -295,6 +372,38 @@
 
 #define LV_USE_USER_DATA 1
 
+/*Cache the resolved style properties of the objects to speed up `lv_obj_get_style_...()`.
+ *The number of entries per object (power of 2), 0: disable.*/
+#define LV_OBJ_STYLE_CACHE_SIZE 0
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*Number of objects which can have a cache at the same time. The least recently read object loses it first.
+     *The caches are a static array of `LV_OBJ_STYLE_CACHE_OBJ_CNT * (12 + 8 * LV_OBJ_STYLE_CACHE_SIZE)` bytes,
+     *they don't use the heap. A change drops only the values of the affected objects and their children.*/
+    #define LV_OBJ_STYLE_CACHE_OBJ_CNT 16
+#endif
+
+/*1: Queue the style refreshes of the objects and apply them once before the next layout update or redraw.
+ *Changing many properties or styles in a row then walks the object tree only once.*/
+#define LV_OBJ_STYLE_REFR_DEFER 0
+
+/*Cache the result of `LV_EVENT_GET_SELF_SIZE` (e.g. the size of a label's text) until the widget's content,
+ *style or size changes. Requires `(1 + 4 * sizeof(lv_coord_t))` bytes per object.*/
+#define LV_OBJ_SELF_SIZE_CACHE 0
+
+/*Index the children of the objects having at least this many children in a grid,
+ *so that finding the pressed object checks only the children around the point. 0: disable.*/
+#define LV_OBJ_HIT_GRID_MIN_CHILD 0
+
+/*1: Keep a bitmap of the event codes having a handler on each object and skip sending an event to an object
+ *if neither its class (see `handled_events` in `lv_obj_class_t`) nor its event callbacks handle it.
+ *The number of sent and skipped events can be read by `lv_event_get_stat()`.*/
+#define LV_OBJ_EVENT_MASK 0
+
+/*1: Cache how the background of the objects covers the areas to redraw (radius, opacity, clip corner, transform size)
+ *so finding the topmost covering object reads the styles only after they changed and doesn't send `LV_EVENT_COVER_CHECK`
+ *to objects whose class and event callbacks don't handle it. Requires `(5 + 3 * sizeof(lv_coord_t))` bytes per object.*/
+#define LV_OBJ_COVER_CACHE 0
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #define LV_ENABLE_GC 0
@@ -573,6 +682,14 @@
 
     /*Default transition time in [ms]*/
     #define LV_THEME_DEFAULT_TRANSITION_TIME 80
+
+    /*Font of the default theme the display is set up with*/
+    #define LV_THEME_DEFAULT_FONT LV_FONT_DEFAULT
+
+    /*1: Use styles precompiled to flash (see lv_theme_default_styles.json) if the theme is initialized
+     *with the light mode, blue/red colors, LV_THEME_DEFAULT_FONT and LV_DPI_DEF on a display wider than 720 px.
+     *Other parameters fall back to building the styles in RAM.*/
+    #define LV_THEME_DEFAULT_CONST 0
 #endif /*LV_USE_THEME_DEFAULT*/
 
 /*A very simple theme that is a good starting point for a custom theme*/
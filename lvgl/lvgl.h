@@ -26,6 +26,9 @@ extern "C" {
 #include "src/misc/lv_timer.h"
 #include "src/misc/lv_math.h"
 #include "src/misc/lv_mem.h"
+#include "src/misc/lv_mem_profiler.h"
+#include "src/misc/lv_latency_trace.h"
+#include "src/misc/lv_point_filter.h"
 #include "src/misc/lv_async.h"
 #include "src/misc/lv_anim_timeline.h"
 #include "src/misc/lv_printf.h"
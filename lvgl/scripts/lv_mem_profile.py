@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+#
+# Process the allocation stream recorded by LV_USE_MEM_PROFILER (see src/misc/lv_mem_profiler.h)
+# and print per call site reports about peak usage, churn and leaks.
+#
+# Usage:
+#   lv_mem_profile.py stream.bin
+#   lv_mem_profile.py stream.bin --elf firmware.elf --addr2line arm-none-eabi-addr2line
+#
+
+import argparse
+import struct
+import subprocess
+import sys
+
+MAGIC = b"LVMP"
+REC_ALLOC = 1
+REC_REALLOC = 2
+REC_FREE = 3
+REC_FRAME = 4
+
+
+class Site:
+    def __init__(self, key):
+        self.key = key
+        self.allocs = 0
+        self.reallocs = 0
+        self.frees = 0
+        self.fails = 0
+        self.bytes_total = 0
+        self.cur_bytes = 0
+        self.cur_blocks = 0
+        self.peak_bytes = 0
+        self.peak_blocks = 0
+        self.bytes_at_peak = 0
+        self.lifetime_sum = 0
+        self.lifetime_cnt = 0
+
+    def add(self, size):
+        self.bytes_total += size
+        self.cur_bytes += size
+        self.cur_blocks += 1
+        self.peak_bytes = max(self.peak_bytes, self.cur_bytes)
+        self.peak_blocks = max(self.peak_blocks, self.cur_blocks)
+
+    def remove(self, size, lifetime):
+        self.cur_bytes -= size
+        self.cur_blocks -= 1
+        self.lifetime_sum += lifetime
+        self.lifetime_cnt += 1
+
+
+class Profile:
+    def __init__(self, by_tag):
+        self.by_tag = by_tag
+        self.sites = {}
+        self.live = {}          # ptr -> (size, site key, frame)
+        self.frame = 0
+        self.first_tick = None
+        self.tick = 0
+        self.cur_bytes = 0
+        self.peak_bytes = 0
+        self.peak_frame = 0
+        self.unknown_frees = 0
+
+    def site(self, addr, tag):
+        key = tag if self.by_tag else addr
+        if key not in self.sites:
+            self.sites[key] = Site(key)
+        return self.sites[key]
+
+    def alloc(self, ptr, size, site, frame=None):
+        # Zero sized allocations all return the same dummy address
+        if ptr == 0 or size == 0:
+            return
+        site.add(size)
+        self.live[ptr] = (size, site.key, self.frame if frame is None else frame)
+        self.cur_bytes += size
+        if self.cur_bytes > self.peak_bytes:
+            self.peak_bytes = self.cur_bytes
+            self.peak_frame = self.frame
+            for s in self.sites.values():
+                s.bytes_at_peak = s.cur_bytes
+
+    def free(self, ptr):
+        blk = self.live.pop(ptr, None)
+        if blk is None:
+            self.unknown_frees += 1
+            return
+        size, key, frame = blk
+        self.sites[key].remove(size, self.frame - frame)
+        self.cur_bytes -= size
+
+    def parse(self, data):
+        if data[0:4] != MAGIC:
+            sys.exit("Not a memory profiler stream (bad magic)")
+        ptr_size = data[5]
+        ptr_fmt = "<I" if ptr_size == 4 else "<Q"
+        pos = 8
+
+        def ptr():
+            nonlocal pos
+            v = struct.unpack_from(ptr_fmt, data, pos)[0]
+            pos += ptr_size
+            return v
+
+        def u32():
+            nonlocal pos
+            v = struct.unpack_from("<I", data, pos)[0]
+            pos += 4
+            return v
+
+        while pos + 2 <= len(data):
+            rec_type = data[pos]
+            tag = data[pos + 1]
+            pos += 2
+            if rec_type == REC_ALLOC:
+                new_p, size, addr = ptr(), u32(), ptr()
+                site = self.site(addr, tag)
+                site.allocs += 1
+                if new_p == 0:
+                    site.fails += 1
+                self.alloc(new_p, size, site)
+            elif rec_type == REC_REALLOC:
+                old_p, new_p, size, addr = ptr(), ptr(), u32(), ptr()
+                site = self.site(addr, tag)
+                site.reallocs += 1
+                if new_p == 0 and size != 0:
+                    site.fails += 1     # The old block is still valid
+                    continue
+                # The lifetime of the data starts with the first allocation
+                frame = None
+                if old_p in self.live:
+                    frame = self.live[old_p][2]
+                    self.free(old_p)
+                self.alloc(new_p, size, site, frame)
+            elif rec_type == REC_FREE:
+                old_p, addr = ptr(), ptr()
+                self.site(addr, tag).frees += 1
+                self.free(old_p)
+            elif rec_type == REC_FRAME:
+                self.frame, self.tick = u32(), u32()
+                if self.first_tick is None:
+                    self.first_tick = self.tick
+            else:
+                sys.exit("Corrupted stream at offset %d (record type %d)" % (pos - 2, rec_type))
+
+
+def resolve(addrs, elf, addr2line, load_base):
+    names = {}
+    if not elf or not addrs:
+        return names
+    # Return addresses point after the call, step back into the calling instruction
+    args = [addr2line, "-f", "-C", "-e", elf] + ["0x%x" % max(a - load_base - 1, 0) for a in addrs]
+    try:
+        out = subprocess.run(args, capture_output=True, text=True, check=True).stdout.splitlines()
+    except (OSError, subprocess.CalledProcessError) as e:
+        print("addr2line failed: %s" % e, file=sys.stderr)
+        return names
+    for i, a in enumerate(addrs):
+        func, loc = out[2 * i], out[2 * i + 1]
+        names[a] = "%s (%s)" % (func, loc.split("/")[-1])
+    return names
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report the output of LV_USE_MEM_PROFILER")
+    parser.add_argument("stream", help="binary stream written by the profiler's write callback")
+    parser.add_argument("--elf", help="firmware image to resolve the call sites")
+    parser.add_argument("--addr2line", default="addr2line", help="addr2line of the toolchain")
+    parser.add_argument("--load-base", type=lambda v: int(v, 0), default=0,
+                        help="address the image was loaded to (position independent host builds)")
+    parser.add_argument("--by-tag", action="store_true", help="group by lv_mem_profiler_set_tag() instead of call site")
+    parser.add_argument("--top", type=int, default=20, help="number of rows in the reports")
+    parser.add_argument("--leak-age", type=int, default=1, help="report blocks alive for at least this many frames")
+    args = parser.parse_args()
+
+    with open(args.stream, "rb") as f:
+        data = f.read()
+
+    prof = Profile(args.by_tag)
+    prof.parse(data)
+
+    names = {} if args.by_tag else resolve(sorted(prof.sites), args.elf, args.addr2line, args.load_base)
+
+    def name(key):
+        if args.by_tag:
+            return "tag %d" % key
+        return names.get(key, "0x%08x" % key)
+
+    frames = max(prof.frame, 1)
+    sites = prof.sites.values()
+    print("%d frames, %d ms, peak %d bytes in frame %d, %d bytes still allocated"
+          % (prof.frame, prof.tick - (prof.first_tick or 0), prof.peak_bytes, prof.peak_frame, prof.cur_bytes))
+    if prof.unknown_frees:
+        print("%d frees of blocks allocated before the recording started" % prof.unknown_frees)
+
+    print("\nPeak usage")
+    print("%10s %10s %8s  %s" % ("at peak", "site peak", "blocks", "site"))
+    for s in sorted(sites, key=lambda s: (s.bytes_at_peak, s.peak_bytes), reverse=True)[:args.top]:
+        print("%10d %10d %8d  %s" % (s.bytes_at_peak, s.peak_bytes, s.peak_blocks, name(s.key)))
+
+    print("\nChurn")
+    print("%10s %10s %10s %8s %10s  %s" % ("allocs", "frees", "bytes", "per frame", "lifetime", "site"))
+    for s in sorted(sites, key=lambda s: s.allocs + s.reallocs, reverse=True)[:args.top]:
+        lifetime = "%.1f" % (s.lifetime_sum / s.lifetime_cnt) if s.lifetime_cnt else "-"
+        print("%10d %10d %10d %8.1f %10s  %s" % (s.allocs + s.reallocs, s.frees, s.bytes_total,
+                                                (s.allocs + s.reallocs) / frames, lifetime, name(s.key)))
+
+    leaks = {}
+    for size, key, frame in prof.live.values():
+        if prof.frame - frame >= args.leak_age:
+            cnt, total, oldest = leaks.get(key, (0, 0, prof.frame))
+            leaks[key] = (cnt + 1, total + size, min(oldest, frame))
+
+    print("\nAlive at the end (possible leaks)")
+    print("%10s %8s %10s  %s" % ("bytes", "blocks", "since", "site"))
+    for key, (cnt, total, oldest) in sorted(leaks.items(), key=lambda i: i[1][1], reverse=True)[:args.top]:
+        print("%10d %8d %10d  %s" % (total, cnt, oldest, name(key)))
+
+    fails = [s for s in sites if s.fails]
+    if fails:
+        print("\nFailed allocations")
+        for s in sorted(fails, key=lambda s: s.fails, reverse=True):
+            print("%10d  %s" % (s.fails, name(s.key)))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,5 +1,8 @@
 #!/usr/bin/env python3
 
+import argparse
+import collections
+import json
 import os
 import re
 import sys
@@ -475,7 +478,92 @@ def docs(p):
   print("</ul>")
 
 
+def prop_ids(style_h):
+  """Read the IDs of the built-in properties from the enum in lv_style.h"""
+  ids = {}
+  with open(style_h) as f:
+    for m in re.finditer(r"^\s*LV_STYLE_(\w+)\s*=\s*(\d+)\s*,", f.read(), re.MULTILINE):
+      ids[m.group(1)] = int(m.group(2))
+  return ids
+
+
+def const_styles(dsc_path, style_h, static):
+  """
+  Print const styles whose property arrays are sorted by ID so that `lv_style_get_prop()`
+  can use binary search on them. The description is a JSON file like:
+    { "style_card": { "RADIUS": 8, "BG_COLOR": "LV_COLOR_MAKE(0xff, 0xff, 0xff)" } }
+  Values are C constant expressions (or numbers).
+  A value can be also given as `[value, condition]` to add the property only `#if condition`
+  and a style can have an `"_if": condition` key to be generated only `#if condition`.
+  With a `"_struct": { "type": "my_styles_t", "name": "my_styles" }` entry the styles are
+  generated as the fields of a const struct instead of separate variables.
+  """
+  ids = prop_ids(style_h)
+  types = {p['name']: p['style_type'] for p in props if 'name' in p}
+  with open(dsc_path) as f:
+    styles = json.load(f, object_pairs_hook=collections.OrderedDict)
+
+  struct = styles.pop("_struct", None)
+  storage = "static " if static else ""
+
+  print("/**")
+  print(" * @file " + os.path.basename(dsc_path).rsplit('.', 1)[0] + "_gen.h")
+  print(" * Generated by `scripts/style_api_gen.py --const-styles " + os.path.basename(dsc_path) + "`. Don't edit.")
+  print(" * The properties of the styles are sorted by their ID.")
+  print(" */")
+
+  inits = []
+  for name, style in styles.items():
+    cond = style.pop("_if", None)
+    if len(style) > 255:
+      sys.exit(name + ": too many properties")
+    for prop in style:
+      if prop not in types:
+        sys.exit(name + ": unknown property " + prop)
+
+    array = (struct["name"] + "_" if struct else "") + name + "_props"
+    group_mask = 0
+    print("")
+    if cond: print("#if " + cond)
+    print(storage + "const lv_style_const_prop_t " + array + "[] = {")
+    for prop in sorted(style, key=lambda pr: ids[pr]):
+      value, prop_cond = style[prop] if isinstance(style[prop], list) else (style[prop], None)
+      group_mask |= 1 << min(ids[prop] >> 4, 7)
+      if prop_cond: print("#if " + prop_cond)
+      print("    LV_STYLE_CONST_" + prop + "(" + str(value) + "),")
+      if prop_cond: print("#endif")
+    print("    LV_STYLE_CONST_PROPS_END")
+    print("};")
+    if struct:
+      inits.append((name, array, group_mask, cond))
+    else:
+      print(storage + "LV_STYLE_CONST_SORTED_INIT(" + name + ", " + array + ", 0x%02X);" % group_mask)
+    if cond: print("#endif")
+
+  if struct:
+    print("")
+    print(storage + "const " + struct["type"] + " " + struct["name"] + " = {")
+    for name, array, group_mask, cond in inits:
+      if cond: print("#if " + cond)
+      print("    ." + name + " = LV_STYLE_CONST_SORTED(" + array + ", 0x%02X)," % group_mask)
+      if cond: print("#endif")
+    print("};")
+
+
 base_dir = os.path.abspath(os.path.dirname(__file__))
+
+if len(sys.argv) > 1:
+  parser = argparse.ArgumentParser(description="Generate the style API or const styles")
+  parser.add_argument("--const-styles", metavar="JSON", required=True,
+                      help="generate const styles with sorted properties from a description")
+  parser.add_argument("-o", "--output", help="output file (stdout by default)")
+  parser.add_argument("--extern", action="store_true", help="don't declare the styles as static")
+  args = parser.parse_args()
+  if args.output:
+    sys.stdout = open(args.output, 'w')
+  const_styles(args.const_styles, base_dir + '/../src/misc/lv_style.h', not args.extern)
+  sys.exit(0)
+
 sys.stdout = open(base_dir + '/../src/core/lv_obj_style_gen.h', 'w')
 
 for p in props:
@@ -1,10 +1,14 @@
 CSRCS += lv_disp.c
+CSRCS += lv_disp_fade.c
+CSRCS += lv_disp_pan.c
 CSRCS += lv_group.c
 CSRCS += lv_indev.c
 CSRCS += lv_indev_scroll.c
+CSRCS += lv_indev_multi_touch.c
 CSRCS += lv_obj.c
 CSRCS += lv_obj_class.c
 CSRCS += lv_obj_draw.c
+CSRCS += lv_obj_hit_grid.c
 CSRCS += lv_obj_pos.c
 CSRCS += lv_obj_scroll.c
 CSRCS += lv_obj_style.c
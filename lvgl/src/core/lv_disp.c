@@ -9,6 +9,8 @@
 #include "lv_disp.h"
 #include "../misc/lv_math.h"
 #include "../core/lv_refr.h"
+#include "../core/lv_disp_pan.h"
+#include "../core/lv_disp_fade.h"
 
 /*********************
  *      DEFINES
@@ -23,6 +25,12 @@
  **********************/
 static void scr_load_internal(lv_obj_t * scr);
 static void scr_load_anim_start(lv_anim_t * a);
+#if LV_USE_DISP_PAN
+static void scr_load_anim_pan_start(lv_anim_t * a);
+#endif
+#if LV_USE_DISP_FADE
+static void scr_load_anim_fade_start(lv_anim_t * a);
+#endif
 static void opa_scale_anim(void * obj, int32_t v);
 static void set_x_anim(void * obj, int32_t v);
 static void set_y_anim(void * obj, int32_t v);
@@ -227,6 +235,9 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
     /*If an other screen load animation is in progress
      *make target screen loaded immediately. */
     if(d->scr_to_load && act_scr != d->scr_to_load) {
+#if LV_USE_DISP_PAN
+        _lv_disp_pan_end(d);
+#endif
         scr_load_internal(d->scr_to_load);
         lv_anim_del(d->scr_to_load, NULL);
         lv_obj_set_pos(d->scr_to_load, 0, 0);
@@ -238,6 +249,11 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
         act_scr = d->scr_to_load;
     }
 
+#if LV_USE_DISP_FADE
+    /*The screens of an earlier fade can be changed or deleted below*/
+    _lv_disp_fade_end(d);
+#endif
+
     d->scr_to_load = new_scr;
 
     if(d->prev_scr && d->del_prev) {
@@ -307,6 +323,9 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
 
             lv_anim_set_exec_cb(&a_old, set_x_anim);
             lv_anim_set_values(&a_old, 0, -lv_disp_get_hor_res(d));
+#if LV_USE_DISP_PAN
+            lv_anim_set_start_cb(&a_new, scr_load_anim_pan_start);
+#endif
             break;
         case LV_SCR_LOAD_ANIM_MOVE_RIGHT:
             lv_anim_set_exec_cb(&a_new, set_x_anim);
@@ -314,6 +333,9 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
 
             lv_anim_set_exec_cb(&a_old, set_x_anim);
             lv_anim_set_values(&a_old, 0, lv_disp_get_hor_res(d));
+#if LV_USE_DISP_PAN
+            lv_anim_set_start_cb(&a_new, scr_load_anim_pan_start);
+#endif
             break;
         case LV_SCR_LOAD_ANIM_MOVE_TOP:
             lv_anim_set_exec_cb(&a_new, set_y_anim);
@@ -332,10 +354,16 @@ void lv_scr_load_anim(lv_obj_t * new_scr, lv_scr_load_anim_t anim_type, uint32_t
         case LV_SCR_LOAD_ANIM_FADE_IN:
             lv_anim_set_exec_cb(&a_new, opa_scale_anim);
             lv_anim_set_values(&a_new, LV_OPA_TRANSP, LV_OPA_COVER);
+#if LV_USE_DISP_FADE
+            lv_anim_set_start_cb(&a_new, scr_load_anim_fade_start);
+#endif
             break;
         case LV_SCR_LOAD_ANIM_FADE_OUT:
             lv_anim_set_exec_cb(&a_old, opa_scale_anim);
             lv_anim_set_values(&a_old, LV_OPA_COVER, LV_OPA_TRANSP);
+#if LV_USE_DISP_FADE
+            lv_anim_set_start_cb(&a_new, scr_load_anim_fade_start);
+#endif
             break;
         case LV_SCR_LOAD_ANIM_OUT_LEFT:
             lv_anim_set_exec_cb(&a_old, set_x_anim);
@@ -494,14 +522,51 @@ static void scr_load_anim_start(lv_anim_t * a)
     lv_event_send(d->act_scr, LV_EVENT_SCREEN_LOAD_START, NULL);
 }
 
+#if LV_USE_DISP_PAN
+static void scr_load_anim_pan_start(lv_anim_t * a)
+{
+    /*Both screens are rendered once and only panned while they slide*/
+    lv_disp_t * d = lv_obj_get_disp(a->var);
+    _lv_disp_pan_scr_load(d, a->var, a->start_value > 0 ? 1 : -1);
+
+    scr_load_anim_start(a);
+}
+#endif
+
+#if LV_USE_DISP_FADE
+static void scr_load_anim_fade_start(lv_anim_t * a)
+{
+    /*Both screens are rendered once and only their blending changes while they fade*/
+    lv_disp_t * d = lv_obj_get_disp(a->var);
+    if(d->draw_prev_over_act) _lv_disp_fade_scr_load(d, a->var, lv_scr_act());
+    else _lv_disp_fade_scr_load(d, lv_scr_act(), a->var);
+
+    scr_load_anim_start(a);
+}
+#endif
+
 static void opa_scale_anim(void * obj, int32_t v)
 {
+#if LV_USE_DISP_FADE
+    /*The display controller shows the change*/
+    lv_disp_t * d = lv_obj_get_disp(obj);
+    if(d->fade_obj == obj) {
+        _lv_disp_fade_set(d, v);
+        return;
+    }
+#endif
+
     lv_obj_set_style_opa(obj, v, 0);
 }
 
 static void set_x_anim(void * obj, int32_t v)
 {
     lv_obj_set_x(obj, v);
+
+#if LV_USE_DISP_PAN
+    lv_disp_t * d = lv_obj_get_disp(obj);
+    if(d->pan_obj == obj) _lv_disp_pan_set(d, lv_disp_get_hor_res(d) - LV_ABS(v));
+#endif
 }
 
 static void set_y_anim(void * obj, int32_t v)
@@ -516,6 +581,13 @@ static void scr_anim_ready(lv_anim_t * a)
     lv_event_send(d->act_scr, LV_EVENT_SCREEN_LOADED, NULL);
     lv_event_send(d->prev_scr, LV_EVENT_SCREEN_UNLOADED, NULL);
 
+#if LV_USE_DISP_PAN
+    _lv_disp_pan_end(d);
+#endif
+#if LV_USE_DISP_FADE
+    _lv_disp_fade_end(d);
+#endif
+
     if(d->prev_scr && d->del_prev) lv_obj_del(d->prev_scr);
     d->prev_scr = NULL;
     d->draw_prev_over_act = false;
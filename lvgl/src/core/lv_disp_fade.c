@@ -0,0 +1,187 @@
+/**
+ * @file lv_disp_fade.c
+ * Fade pre-rendered screens instead of rendering every frame of a fading screen load.
+ *
+ * The screen which stays opaque and the fading screen are rendered once, after each other,
+ * into a buffer of two screens. While the fade lasts, the display controller blends them with
+ * the current opacity (`fade_cb` of the display driver) and LVGL doesn't render.
+ * If anything is invalidated meanwhile, the screens are dynamic and the rest of the fade is rendered as usual.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_disp_fade.h"
+#include "lv_disp.h"
+#include "lv_refr.h"
+#if LV_USE_DISP_FADE
+
+#include "../misc/lv_anim.h"
+#include "../misc/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void render_scr(lv_disp_t * disp, lv_obj_t * scr, lv_color_t * buf);
+static void set_opa_silent(lv_disp_t * disp, lv_obj_t * scr, lv_opa_t opa);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool _lv_disp_fade_scr_load(lv_disp_t * disp, lv_obj_t * under, lv_obj_t * over)
+{
+    lv_disp_drv_t * drv = disp->driver;
+    if(drv->fade_cb == NULL) return false;
+    if(drv->rotated != LV_DISP_ROT_NONE || drv->sw_rotate) return false;
+    if(disp->fade_obj || disp->prev_scr) return false;
+#if LV_USE_DISP_PAN
+    if(disp->pan_obj) return false;
+#endif
+
+    uint32_t px_cnt = (uint32_t)lv_disp_get_hor_res(disp) * lv_disp_get_ver_res(disp);
+    if(disp->fade_buf == NULL) {
+        disp->fade_buf = lv_mem_alloc_hint(2 * px_cnt * sizeof(lv_color_t), LV_MEM_HINT_BULK);
+        if(disp->fade_buf == NULL) {
+            LV_LOG_WARN("not enough memory to fade the display");
+            return false;
+        }
+    }
+
+    lv_obj_update_layout(under);
+    lv_obj_update_layout(over);
+    render_scr(disp, under, disp->fade_buf);
+    render_scr(disp, over, disp->fade_buf + px_cnt);
+
+    /*The buffers have everything, only the changes from now on mean that the screens are dynamic*/
+    disp->inv_p = 0;
+#if LV_USE_SCROLL_BLIT
+    disp->blit_pending = 0;
+#endif
+
+    disp->fade_obj = over;
+    _lv_disp_fade_set(disp, lv_obj_get_style_opa(over, LV_PART_MAIN));
+    return true;
+}
+
+void _lv_disp_fade_set(lv_disp_t * disp, lv_opa_t opa)
+{
+    if(disp->fade_obj == NULL) return;
+
+    /*Keep the style up to date for the software fallback*/
+    set_opa_silent(disp, disp->fade_obj, opa);
+
+    uint32_t px_cnt = (uint32_t)lv_disp_get_hor_res(disp) * lv_disp_get_ver_res(disp);
+    disp->driver->fade_cb(disp->driver, disp->fade_buf, disp->fade_buf + px_cnt, opa);
+
+    /*Nothing is invalidated while fading, but the end of the fade needs to be noticed*/
+    if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+}
+
+void _lv_disp_fade_end(lv_disp_t * disp)
+{
+    if(disp->fade_obj == NULL) return;
+
+    disp->fade_obj = NULL;
+    disp->driver->fade_cb(disp->driver, NULL, NULL, 0);
+
+    /*The buffers of the display are outdated*/
+    lv_area_t a;
+    lv_area_set(&a, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    _lv_inv_area(disp, &a);
+}
+
+bool _lv_disp_fade_refr(lv_disp_t * disp)
+{
+    lv_obj_t * obj = disp->fade_obj;
+    if(obj == NULL) return false;
+
+    /*Something has changed on the screens or on the overlay*/
+    bool changed = disp->inv_p != 0;
+#if LV_USE_SCROLL_BLIT
+    if(disp->blit_pending) changed = true;
+#endif
+#if LV_USE_DISP_OVERLAY
+    if(disp->overlay_inv_p) changed = true;
+#endif
+
+    /*Wait until the screen load is finished*/
+    if(!changed && lv_anim_get(obj, NULL)) return true;
+
+    _lv_disp_fade_end(disp);
+    return false;
+}
+
+void _lv_disp_fade_release(lv_disp_t * disp)
+{
+    if(disp->fade_buf == NULL || disp->fade_obj) return;
+
+    /*The screens are shown until the first normal frame is flushed*/
+    if(disp->driver->draw_buf->flushing) return;
+
+    lv_mem_free(disp->fade_buf);
+    disp->fade_buf = NULL;
+}
+
+void _lv_disp_fade_reset(lv_obj_t * obj)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(disp && disp->fade_obj == obj) _lv_disp_fade_end(disp);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Render a screen opaque with the top and system layers, its opacity is applied by the display controller
+ * @param disp      pointer to a display
+ * @param scr       the screen to render
+ * @param buf       a buffer of `hor_res` x `ver_res` pixels
+ */
+static void render_scr(lv_disp_t * disp, lv_obj_t * scr, lv_color_t * buf)
+{
+    lv_opa_t opa = lv_obj_get_style_opa(scr, LV_PART_MAIN);
+    if(opa != LV_OPA_COVER) set_opa_silent(disp, scr, LV_OPA_COVER);
+
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    _lv_refr_scr_to_buf(disp, scr, buf, &buf_area, true);
+
+    if(opa != LV_OPA_COVER) set_opa_silent(disp, scr, opa);
+}
+
+/**
+ * Set the opacity of a screen without invalidating it
+ * @param disp      pointer to a display
+ * @param scr       pointer to a screen
+ * @param opa       the new opacity
+ */
+static void set_opa_silent(lv_disp_t * disp, lv_obj_t * scr, lv_opa_t opa)
+{
+    /*The queued changes of other objects still need to be invalidated*/
+    lv_obj_refresh_style_pending();
+
+    lv_disp_enable_invalidation(disp, false);
+    lv_obj_set_style_opa(scr, opa, 0);
+    lv_obj_refresh_style_pending();
+    lv_disp_enable_invalidation(disp, true);
+}
+
+#endif /*LV_USE_DISP_FADE*/
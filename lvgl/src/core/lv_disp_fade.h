@@ -0,0 +1,85 @@
+/**
+ * @file lv_disp_fade.h
+ *
+ */
+
+#ifndef LV_DISP_FADE_H
+#define LV_DISP_FADE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj.h"
+
+#if LV_USE_DISP_FADE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start fading a screen over an other one. Called by LVGL when a
+ * `LV_SCR_LOAD_ANIM_FADE_IN/OUT` animation starts.
+ * @param disp      pointer to a display
+ * @param under     the screen which stays opaque
+ * @param over      the screen whose opacity is animated
+ * @return          true: the screens are faded by `fade_cb`; false: they need to be rendered in every frame
+ */
+bool _lv_disp_fade_scr_load(lv_disp_t * disp, lv_obj_t * under, lv_obj_t * over);
+
+/**
+ * Set the opacity of the fading screen. Its style is updated too, without invalidating it.
+ * @param disp      pointer to a display
+ * @param opa       the new opacity
+ */
+void _lv_disp_fade_set(lv_disp_t * disp, lv_opa_t opa);
+
+/**
+ * Stop fading and render the display normally again
+ * @param disp      pointer to a display
+ */
+void _lv_disp_fade_end(lv_disp_t * disp);
+
+/**
+ * Check the fading before refreshing a display. Called by LVGL in every refresh.
+ * If something was invalidated the fade is continued in software.
+ * @param disp      pointer to the display being refreshed
+ * @return          true: the display is being faded, don't render now
+ */
+bool _lv_disp_fade_refr(lv_disp_t * disp);
+
+/**
+ * Free the pre-rendered screens when the display doesn't show them anymore. Called by LVGL after a refresh.
+ * @param disp      pointer to the refreshed display
+ */
+void _lv_disp_fade_release(lv_disp_t * disp);
+
+/**
+ * Stop fading if the fading screen is deleted
+ * @param obj       pointer to the object being deleted
+ */
+void _lv_disp_fade_reset(lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DISP_FADE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DISP_FADE_H*/
@@ -0,0 +1,341 @@
+/**
+ * @file lv_disp_pan.c
+ * Pan pre-rendered screens instead of rendering every frame of a horizontal slide.
+ *
+ * The outgoing and the incoming content are rendered once, side by side, into a canvas of
+ * twice the width of the display: `[out | in]` if the new content comes from the right
+ * and `[in | out]` if it comes from the left. While the slide lasts, the display controller
+ * only scans a different window of the canvas (`pan_cb` of the display driver) and LVGL doesn't render.
+ * The outgoing half is copied from the front buffer if it's known to be up to date.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_disp_pan.h"
+#include "lv_disp.h"
+#include "lv_refr.h"
+#include "lv_obj_scroll.h"
+#if LV_USE_DISP_PAN
+
+#include "../misc/lv_anim.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool pan_start(lv_disp_t * disp, lv_obj_t * obj, int8_t dir);
+static void render_half(lv_disp_t * disp, lv_obj_t * scr, lv_coord_t x);
+static lv_color_t * get_front_buf(lv_disp_t * disp);
+static void copy_front_buf(lv_disp_t * disp, lv_color_t * front_buf, lv_coord_t x);
+static bool has_visible_child(lv_obj_t * obj);
+static bool is_on_top(lv_obj_t * obj);
+static void move_obj(lv_obj_t * obj, lv_coord_t x_ofs);
+static void move_content(lv_obj_t * obj, lv_coord_t x_ofs);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool _lv_disp_pan_scr_load(lv_disp_t * disp, lv_obj_t * new_scr, int8_t dir)
+{
+    if(!pan_start(disp, new_scr, dir)) return false;
+
+    /*Render the new screen at its final position*/
+    lv_obj_update_layout(new_scr);
+    lv_coord_t x_ofs = -new_scr->coords.x1;
+    move_obj(new_scr, x_ofs);
+    render_half(disp, new_scr, dir > 0 ? lv_disp_get_hor_res(disp) : 0);
+    move_obj(new_scr, -x_ofs);
+
+    _lv_disp_pan_set(disp, 0);
+    return true;
+}
+
+bool _lv_disp_pan_scroll(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    lv_coord_t w = lv_disp_get_hor_res(disp);
+
+    if(disp->pan_obj == NULL) {
+        if(x == 0 || y != 0) return false;
+        if(!is_on_top(obj)) return false;
+
+        int8_t dir = x < 0 ? 1 : -1;
+        if(!pan_start(disp, obj, dir)) return false;
+
+        /*Render the content scrolled by a whole display*/
+        move_content(obj, -dir * w);
+        render_half(disp, lv_obj_get_screen(obj), dir > 0 ? w : 0);
+        move_content(obj, dir * w);
+    }
+    else if(disp->pan_obj != obj) {
+        return false;
+    }
+
+    disp->pan_sum += x;
+    lv_coord_t p = -disp->pan_sum * disp->pan_dir;
+
+    /*Turned back or went further than the pre-rendered content*/
+    if(y != 0 || p < 0 || p > w) {
+        _lv_disp_pan_end(disp);
+        return false;
+    }
+
+    _lv_disp_pan_set(disp, p);
+    return true;
+}
+
+void _lv_disp_pan_set(lv_disp_t * disp, lv_coord_t p)
+{
+    if(disp->pan_obj == NULL) return;
+
+    lv_coord_t w = lv_disp_get_hor_res(disp);
+    p = LV_CLAMP(0, p, w);
+
+    lv_coord_t x = disp->pan_dir > 0 ? p : w - p;
+    disp->driver->pan_cb(disp->driver, disp->pan_buf + x, 2 * w);
+
+    /*Nothing is invalidated while panning, but the end of the panning needs to be noticed*/
+    if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+}
+
+void _lv_disp_pan_end(lv_disp_t * disp)
+{
+    if(disp->pan_obj == NULL) return;
+
+    disp->pan_obj = NULL;
+    disp->pan_sum = 0;
+    disp->driver->pan_cb(disp->driver, NULL, 0);
+
+    /*The buffers of the display are outdated*/
+    lv_area_t a;
+    lv_area_set(&a, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    _lv_inv_area(disp, &a);
+}
+
+bool _lv_disp_pan_refr(lv_disp_t * disp)
+{
+    lv_obj_t * obj = disp->pan_obj;
+    if(obj == NULL) return false;
+
+    /*Wait until the screen load or the scrolling is finished*/
+    if(disp->scr_to_load == obj || lv_obj_is_scrolling(obj) || lv_anim_get(obj, NULL)) return true;
+
+    _lv_disp_pan_end(disp);
+    return false;
+}
+
+void _lv_disp_pan_release(lv_disp_t * disp)
+{
+    if(disp->pan_buf == NULL || disp->pan_obj) return;
+
+    /*The canvas is shown until the first normal frame is flushed*/
+    if(disp->driver->draw_buf->flushing) return;
+
+    lv_mem_free(disp->pan_buf);
+    disp->pan_buf = NULL;
+}
+
+void _lv_disp_pan_reset(lv_obj_t * obj)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(disp && disp->pan_obj == obj) _lv_disp_pan_end(disp);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Check if the display can be panned, allocate the canvas and put the current content into its outgoing half
+ * @param disp      pointer to a display
+ * @param obj       the object whose animation or scrolling drives the panning
+ * @param dir       1: the new content comes from the right; -1: from the left
+ * @return          true: the panning is started, the incoming half still needs to be rendered
+ */
+static bool pan_start(lv_disp_t * disp, lv_obj_t * obj, int8_t dir)
+{
+    lv_disp_drv_t * drv = disp->driver;
+    if(drv->pan_cb == NULL) return false;
+    if(drv->rotated != LV_DISP_ROT_NONE || drv->sw_rotate) return false;
+    if(disp->pan_obj || disp->prev_scr) return false;
+
+    /*The top layer would slide with the screens, unless it's in the overlay*/
+#if LV_USE_DISP_OVERLAY
+    if(drv->overlay_buf == NULL)
+#endif
+    {
+        if(has_visible_child(disp->top_layer)) return false;
+    }
+
+    lv_coord_t w = lv_disp_get_hor_res(disp);
+    lv_coord_t h = lv_disp_get_ver_res(disp);
+    if(disp->pan_buf == NULL) {
+        disp->pan_buf = lv_mem_alloc_hint(2 * w * h * sizeof(lv_color_t), LV_MEM_HINT_BULK);
+        if(disp->pan_buf == NULL) {
+            LV_LOG_WARN("not enough memory to pan the display");
+            return false;
+        }
+    }
+
+    lv_coord_t out_x = dir > 0 ? 0 : w;
+    lv_color_t * front_buf = get_front_buf(disp);
+    if(front_buf) copy_front_buf(disp, front_buf, out_x);
+    else render_half(disp, disp->act_scr, out_x);
+
+    disp->pan_obj = obj;
+    disp->pan_dir = dir;
+    disp->pan_sum = 0;
+    return true;
+}
+
+/**
+ * Render a screen into a half of the canvas
+ * @param disp      pointer to a display
+ * @param scr       the screen to render
+ * @param x         the first column of the half in the canvas, 0 or hor_res
+ */
+static void render_half(lv_disp_t * disp, lv_obj_t * scr, lv_coord_t x)
+{
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, -x, 0, 2 * lv_disp_get_hor_res(disp) - 1 - x, lv_disp_get_ver_res(disp) - 1);
+    _lv_refr_scr_to_buf(disp, scr, disp->pan_buf, &buf_area, false);
+}
+
+/**
+ * Get the buffer shown by the display if it has the whole current content
+ * @param disp      pointer to a display
+ * @return          the front buffer or NULL if the content needs to be rendered
+ */
+static lv_color_t * get_front_buf(lv_disp_t * disp)
+{
+    /*Something has changed since the last frame*/
+    if(disp->inv_p) return NULL;
+#if LV_USE_SCROLL_BLIT
+    if(disp->blit_pending) return NULL;
+#endif
+
+    lv_disp_drv_t * drv = disp->driver;
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+    if(draw_buf->buf2 == NULL) {
+        return drv->full_refresh || drv->direct_mode ? draw_buf->buf1 : NULL;
+    }
+
+    /*With two buffers only the changes are drawn in direct mode unless they are synchronized*/
+    bool complete = drv->full_refresh;
+#if LV_USE_SCROLL_BLIT
+    complete = complete || drv->direct_mode;
+#endif
+    if(!complete) return NULL;
+
+    return draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+}
+
+/**
+ * Copy the front buffer into a half of the canvas with the draw unit
+ * @param disp      pointer to a display
+ * @param front_buf the buffer shown by the display
+ * @param x         the first column of the half in the canvas, 0 or hor_res
+ */
+static void copy_front_buf(lv_disp_t * disp, lv_color_t * front_buf, lv_coord_t x)
+{
+    lv_coord_t w = lv_disp_get_hor_res(disp);
+    lv_coord_t h = lv_disp_get_ver_res(disp);
+    lv_area_t src_area;
+    lv_area_set(&src_area, 0, 0, w - 1, h - 1);
+    lv_area_t dest_area;
+    lv_area_set(&dest_area, x, 0, x + w - 1, h - 1);
+
+    lv_disp_t * disp_refr_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(disp);
+
+    lv_draw_ctx_t * draw_ctx = disp->driver->draw_ctx;
+    draw_ctx->buffer_copy(draw_ctx, disp->pan_buf, 2 * w, &dest_area, front_buf, w, &src_area);
+    if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+
+    _lv_refr_set_disp_refreshing(disp_refr_ori);
+}
+
+static bool has_visible_child(lv_obj_t * obj)
+{
+    uint32_t i;
+    uint32_t cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < cnt; i++) {
+        if(!lv_obj_has_flag(lv_obj_get_child(obj, i), LV_OBJ_FLAG_HIDDEN)) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Check if an object covers the display and nothing is drawn over it,
+ * so panning its content looks the same as scrolling it
+ * @param obj       pointer to an object
+ * @return          true: the object can be panned
+ */
+static bool is_on_top(lv_obj_t * obj)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(lv_obj_get_screen(obj) != disp->act_scr) return false;
+
+    lv_area_t disp_area;
+    lv_area_set(&disp_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    if(!_lv_area_is_equal(&obj->coords, &disp_area)) return false;
+
+    lv_obj_t * child = obj;
+    while(child) {
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) return false;
+        if(_lv_obj_get_layer_type(child) != LV_LAYER_TYPE_NONE) return false;
+
+        lv_obj_t * parent = lv_obj_get_parent(child);
+        if(parent) {
+            uint32_t i;
+            uint32_t cnt = lv_obj_get_child_cnt(parent);
+            for(i = lv_obj_get_index(child) + 1; i < cnt; i++) {
+                if(!lv_obj_has_flag(lv_obj_get_child(parent, i), LV_OBJ_FLAG_HIDDEN)) return false;
+            }
+        }
+        child = parent;
+    }
+
+    return true;
+}
+
+/**
+ * Move a screen and its children without invalidating them
+ */
+static void move_obj(lv_obj_t * obj, lv_coord_t x_ofs)
+{
+    obj->coords.x1 += x_ofs;
+    obj->coords.x2 += x_ofs;
+    lv_obj_move_children_by(obj, x_ofs, 0, false);
+}
+
+/**
+ * Scroll the content of an object without invalidating it or sending events
+ */
+static void move_content(lv_obj_t * obj, lv_coord_t x_ofs)
+{
+    obj->spec_attr->scroll.x += x_ofs;
+    lv_obj_move_children_by(obj, x_ofs, 0, true);
+}
+
+#endif /*LV_USE_DISP_PAN*/
@@ -0,0 +1,94 @@
+/**
+ * @file lv_disp_pan.h
+ *
+ */
+
+#ifndef LV_DISP_PAN_H
+#define LV_DISP_PAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj.h"
+
+#if LV_USE_DISP_PAN
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start panning from the active screen to a new screen. Called by LVGL when a
+ * `LV_SCR_LOAD_ANIM_MOVE_LEFT/RIGHT` animation starts.
+ * @param disp      pointer to a display
+ * @param new_scr   the screen being loaded
+ * @param dir       1: the new screen comes from the right; -1: from the left
+ * @return          true: the screens are panned; false: they need to be rendered in every frame
+ */
+bool _lv_disp_pan_scr_load(lv_disp_t * disp, lv_obj_t * new_scr, int8_t dir);
+
+/**
+ * Pan the display when an object with `LV_OBJ_FLAG_SCROLL_PAN` is scrolled. Called by LVGL before
+ * the children are moved. The first horizontal step starts the panning, the next ones move the display.
+ * @param obj       pointer to the scrolled object
+ * @param x         pixels to scroll horizontally
+ * @param y         pixels to scroll vertically
+ * @return          true: the display is panned, nothing to invalidate; false: render the change
+ */
+bool _lv_disp_pan_scroll(lv_obj_t * obj, lv_coord_t x, lv_coord_t y);
+
+/**
+ * Set how far the panning got
+ * @param disp      pointer to a display
+ * @param p         pixels of the new content on the display [0..hor_res]
+ */
+void _lv_disp_pan_set(lv_disp_t * disp, lv_coord_t p);
+
+/**
+ * Stop panning and render the display normally again
+ * @param disp      pointer to a display
+ */
+void _lv_disp_pan_end(lv_disp_t * disp);
+
+/**
+ * Check the panning before refreshing a display. Called by LVGL in every refresh.
+ * @param disp      pointer to the display being refreshed
+ * @return          true: the display is being panned, don't render now
+ */
+bool _lv_disp_pan_refr(lv_disp_t * disp);
+
+/**
+ * Free the pre-rendered screens when the display doesn't show them anymore. Called by LVGL after a refresh.
+ * @param disp      pointer to the refreshed display
+ */
+void _lv_disp_pan_release(lv_disp_t * disp);
+
+/**
+ * Stop panning if the panned object is deleted
+ * @param obj       pointer to the object being deleted
+ */
+void _lv_disp_pan_reset(lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DISP_PAN*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DISP_PAN_H*/
@@ -29,12 +29,17 @@ typedef struct _lv_event_dsc_t {
 static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
 static lv_res_t event_send_core(lv_event_t * e);
 static bool event_is_bubbled(lv_event_t * e);
-
+#if LV_OBJ_EVENT_MASK
+    static void event_mask_update(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_event_t * event_head;
+#if LV_OBJ_EVENT_MASK
+    static lv_event_stat_t event_stat[_LV_EVENT_LAST + 1];
+#endif
 
 /**********************
  *      MACROS
@@ -174,6 +179,10 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
 
+#if LV_OBJ_EVENT_MASK
+    event_mask_update(obj);
+#endif
+
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
 
@@ -193,6 +202,9 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+#if LV_OBJ_EVENT_MASK
+            event_mask_update(obj);
+#endif
             return true;
         }
     }
@@ -218,6 +230,9 @@ bool lv_obj_remove_event_cb_with_user_data(lv_obj_t * obj, lv_event_cb_t event_c
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+#if LV_OBJ_EVENT_MASK
+            event_mask_update(obj);
+#endif
             return true;
         }
     }
@@ -243,6 +258,9 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+#if LV_OBJ_EVENT_MASK
+            event_mask_update(obj);
+#endif
             return true;
         }
     }
@@ -409,6 +427,58 @@ void lv_event_set_cover_res(lv_event_t * e, lv_cover_res_t res)
     }
 }
 
+const lv_multi_gesture_t * lv_event_get_multi_gesture(lv_event_t * e)
+{
+    if(e->code == LV_EVENT_MULTI_GESTURE) {
+        return lv_event_get_param(e);
+    }
+    else {
+        LV_LOG_WARN("Not interpreted with this event code");
+        return NULL;
+    }
+}
+
+bool _lv_event_has_handler(const lv_obj_t * obj, lv_event_code_t code, const lv_obj_class_t * except_class)
+{
+    /*Custom event codes which don't fit to the bitmaps are assumed to be handled*/
+    if(code >= 64) return true;
+
+    uint64_t m = LV_EVENT_MASK(code);
+    if(obj->spec_attr) {
+#if LV_OBJ_EVENT_MASK
+        if(obj->spec_attr->event_mask & m) return true;
+#else
+        uint32_t i;
+        for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+            uint32_t filter = obj->spec_attr->event_dsc[i].filter & ~LV_EVENT_PREPROCESS;
+            if(filter == LV_EVENT_ALL || filter == code) return true;
+        }
+#endif
+    }
+
+    /*The class event handlers call their base class so check the whole chain*/
+    const lv_obj_class_t * class_p;
+    for(class_p = obj->class_p; class_p; class_p = class_p->base_class) {
+        if(class_p->event_cb == NULL || class_p == except_class) continue;
+        if(class_p->handled_events == 0 || (class_p->handled_events & m)) return true;
+    }
+
+    return false;
+}
+
+#if LV_OBJ_EVENT_MASK
+void lv_event_get_stat(lv_event_code_t code, lv_event_stat_t * stat)
+{
+    if(code > _LV_EVENT_LAST) code = _LV_EVENT_LAST;
+    *stat = event_stat[code];
+}
+
+void lv_event_reset_stat(void)
+{
+    lv_memset_00(event_stat, sizeof(event_stat));
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -435,6 +505,20 @@ static lv_res_t event_send_core(lv_event_t * e)
         if(e->deleted) return LV_RES_INV;
     }
 
+#if LV_OBJ_EVENT_MASK
+    lv_event_stat_t * stat = &event_stat[LV_MIN(e->code, _LV_EVENT_LAST)];
+    stat->sent_cnt++;
+    if(!_lv_event_has_handler(e->current_target, e->code, NULL)) {
+        /*Neither the class nor an event callback handles this event here, only bubble it*/
+        stat->skipped_cnt++;
+        if(e->current_target->parent && event_is_bubbled(e)) {
+            e->current_target = e->current_target->parent;
+            return event_send_core(e);
+        }
+        return LV_RES_OK;
+    }
+#endif
+
     lv_res_t res = LV_RES_OK;
     lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
 
@@ -484,6 +568,21 @@ static lv_res_t event_send_core(lv_event_t * e)
     return res;
 }
 
+#if LV_OBJ_EVENT_MASK
+static void event_mask_update(lv_obj_t * obj)
+{
+    uint64_t mask = 0;
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        uint32_t filter = obj->spec_attr->event_dsc[i].filter & ~LV_EVENT_PREPROCESS;
+        if(filter == LV_EVENT_ALL) mask = UINT64_MAX;
+        else if(filter < 64) mask |= LV_EVENT_MASK(filter);
+    }
+
+    obj->spec_attr->event_mask = mask;
+}
+#endif
+
 static bool event_is_bubbled(lv_event_t * e)
 {
     if(e->stop_bubbling) return false;
@@ -13,18 +13,28 @@ extern "C" {
 /*********************
  *      INCLUDES
  *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
 #include <stdbool.h>
 
 /*********************
  *      DEFINES
  *********************/
 
+/**
+ * Bit of an event code in the `handled_events` bitmap of the classes, e.g.
+ * `.handled_events = LV_EVENT_MASK(LV_EVENT_PRESSED) | LV_EVENT_MASK(LV_EVENT_DRAW_MAIN)`
+ */
+#define LV_EVENT_MASK(code) ((uint64_t)1 << (code))
+
 /**********************
  *      TYPEDEFS
  **********************/
 
 struct _lv_obj_t;
 struct _lv_event_dsc_t;
+struct _lv_obj_class_t;
 
 /**
  * Type of event being sent to the object.
@@ -84,6 +94,9 @@ typedef enum {
     LV_EVENT_LAYOUT_CHANGED,      /**< The children position has changed due to a layout recalculation*/
     LV_EVENT_GET_SELF_SIZE,       /**< Get the internal size of a widget*/
 
+    /** Input device events added later. Appended here to keep the codes of the others*/
+    LV_EVENT_MULTI_GESTURE,       /**< A two finger gesture is in progress. The event parameter is `lv_multi_gesture_t *`*/
+
     _LV_EVENT_LAST,               /** Number of default events*/
 
 
@@ -132,6 +145,55 @@ typedef struct {
     const lv_area_t * area;
 } lv_cover_check_info_t;
 
+/**
+ * The phases of a two finger gesture
+ */
+enum {
+    LV_MULTI_GESTURE_BEGIN,     /**< The gesture is recognized, the deltas are counted from the first touch*/
+    LV_MULTI_GESTURE_CHANGE,    /**< The touches have moved since the last event*/
+    LV_MULTI_GESTURE_END,       /**< One of the two fingers is lifted*/
+};
+
+typedef uint8_t lv_multi_gesture_state_t;
+
+/**
+ * The components of a two finger gesture. More of them can be recognized at the same time.
+ */
+enum {
+    LV_MULTI_GESTURE_PINCH  = 0x01,
+    LV_MULTI_GESTURE_ROTATE = 0x02,
+    LV_MULTI_GESTURE_PAN    = 0x04,
+};
+
+typedef uint8_t lv_multi_gesture_type_t;
+
+/**
+ * Used as the event parameter of ::LV_EVENT_MULTI_GESTURE. It's sent at most once in a display refresh,
+ * the deltas are the changes since the last event. The components not in `types` are not changed.
+ */
+typedef struct {
+    lv_multi_gesture_state_t state;
+    lv_multi_gesture_type_t types;  /**< The recognized components, OR-ed `LV_MULTI_GESTURE_PINCH/ROTATE/PAN`*/
+    lv_point_t center;              /**< The midpoint of the two touches*/
+    lv_point_t pan;                 /**< Move of the midpoint*/
+    int32_t scale;                  /**< Change of the distance of the touches, 256: unchanged, 512: doubled*/
+    int16_t rotation;               /**< Rotation in degrees, clockwise is positive*/
+    lv_point_t pan_sum;             /**< The same since the first touch*/
+    int32_t scale_sum;
+    int16_t rotation_sum;
+} lv_multi_gesture_t;
+
+#if LV_OBJ_EVENT_MASK
+/**
+ * Number of times an event code was sent to an object.
+ * When an event bubbles each parent counts separately.
+ */
+typedef struct {
+    uint32_t sent_cnt;          /**< Number of times the event reached an object*/
+    uint32_t skipped_cnt;       /**< Number of times no handler was called as nobody handled this event on that object*/
+} lv_event_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -352,6 +414,39 @@ const lv_area_t * lv_event_get_cover_area(lv_event_t * e);
  */
 void lv_event_set_cover_res(lv_event_t * e, lv_cover_res_t res);
 
+/**
+ * Get the two finger gesture. Can be used in `LV_EVENT_MULTI_GESTURE`
+ * @param e     pointer to an event
+ * @return      pointer to the gesture or NULL if called on an unrelated event
+ */
+const lv_multi_gesture_t * lv_event_get_multi_gesture(lv_event_t * e);
+
+/**
+ * Check if an event sent to an object would be processed by anything
+ * @param obj           pointer to an object
+ * @param code          an event code
+ * @param except_class  don't consider the event handler of this class (e.g. because the caller does its job). Can be NULL.
+ * @return              true: an event callback or a class handles the event (or it can't be known);
+ *                      false: sending the event would do nothing
+ */
+bool _lv_event_has_handler(const struct _lv_obj_t * obj, lv_event_code_t code,
+                           const struct _lv_obj_class_t * except_class);
+
+#if LV_OBJ_EVENT_MASK
+/**
+ * Get how many times an event was sent and skipped since the last `lv_event_reset_stat()`
+ * @param code  an event code. The custom event codes (registered by `lv_event_register_id()`) are counted together
+ *              and can be read with `_LV_EVENT_LAST`.
+ * @param stat  store the result here
+ */
+void lv_event_get_stat(lv_event_code_t code, lv_event_stat_t * stat);
+
+/**
+ * Clear the counters of every event code
+ */
+void lv_event_reset_stat(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
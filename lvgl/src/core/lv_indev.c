@@ -10,12 +10,14 @@
 #include "lv_disp.h"
 #include "lv_obj.h"
 #include "lv_indev_scroll.h"
+#include "lv_indev_multi_touch.h"
 #include "lv_group.h"
 #include "lv_refr.h"
 
 #include "../hal/lv_hal_tick.h"
 #include "../misc/lv_timer.h"
 #include "../misc/lv_math.h"
+#include "../misc/lv_latency_trace.h"
 
 /*********************
  *      DEFINES
@@ -32,6 +34,9 @@
  *  STATIC PROTOTYPES
  **********************/
 static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data);
+#if LV_USE_INDEV_FILTER
+static void indev_pointer_filter(lv_indev_t * i, lv_indev_data_t * data);
+#endif
 static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data);
 static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data);
 static void indev_button_proc(lv_indev_t * i, lv_indev_data_t * data);
@@ -47,6 +52,7 @@ static bool indev_reset_check(_lv_indev_proc_t * proc);
  **********************/
 static lv_indev_t * indev_act;
 static lv_obj_t * indev_obj_act = NULL;
+static lv_indev_search_stat_t search_stat;
 
 /**********************
  *      MACROS
@@ -163,6 +169,9 @@ void lv_indev_reset(lv_indev_t * indev, lv_obj_t * obj)
             if(obj == NULL || indev->proc.types.pointer.last_obj == obj) {
                 indev->proc.types.pointer.last_obj = NULL;
             }
+#if LV_INDEV_MULTI_TOUCH_MAX
+            _lv_indev_multi_touch_reset(indev, obj);
+#endif
         }
     }
     else {
@@ -179,6 +188,9 @@ void lv_indev_reset(lv_indev_t * indev, lv_obj_t * obj)
                 if(obj == NULL || i->proc.types.pointer.last_obj == obj) {
                     i->proc.types.pointer.last_obj = NULL;
                 }
+#if LV_INDEV_MULTI_TOUCH_MAX
+                _lv_indev_multi_touch_reset(i, obj);
+#endif
             }
             i = lv_indev_get_next(i);
         }
@@ -301,6 +313,9 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
 {
     lv_obj_t * found_p = NULL;
 
+    if(lv_obj_get_parent(obj) == NULL) search_stat.search_cnt++;
+    search_stat.visit_cnt++;
+
     /*If this obj is hidden the children are hidden too so return immediately*/
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return NULL;
 
@@ -311,6 +326,19 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
 
     /*If the point is on this object or has overflow visible check its children too*/
     if(_lv_area_is_point_on(&obj->coords, &p_trans, 0) || lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+#if LV_OBJ_HIT_GRID_MIN_CHILD
+        /*Check only the children around the point if there are many children*/
+        _lv_obj_hit_grid_iter_t iter;
+        _lv_obj_hit_grid_iter_init(obj, &p_trans, &iter);
+        if(iter.built) search_stat.grid_build_cnt++;
+
+        /*If a child matches use it*/
+        lv_obj_t * child;
+        while((child = _lv_obj_hit_grid_iter_next(&iter)) != NULL) {
+            found_p = lv_indev_search_obj(child, &p_trans);
+            if(found_p) return found_p;
+        }
+#else
         int32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
 
@@ -320,6 +348,7 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
             found_p = lv_indev_search_obj(child, &p_trans);
             if(found_p) return found_p;
         }
+#endif
     }
 
     /*If not return earlier for a clicked child and this obj's hittest was ok use it
@@ -328,6 +357,16 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
     else return NULL;
 }
 
+void lv_indev_get_search_stat(lv_indev_search_stat_t * stat)
+{
+    *stat = search_stat;
+}
+
+void lv_indev_reset_search_stat(void)
+{
+    lv_memset_00(&search_stat, sizeof(search_stat));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -354,6 +393,14 @@ static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
         data->point.x = disp->driver->ver_res - tmp - 1;
     }
 
+#if LV_USE_INDEV_FILTER
+    indev_pointer_filter(i, data);
+#endif
+
+#if LV_INDEV_MULTI_TOUCH_MAX
+    _lv_indev_multi_touch_handler(i, data);
+#endif
+
     /*Simple sanity check*/
     if(data->point.x < 0) {
         LV_LOG_WARN("X is %d which is smaller than zero", data->point.x);
@@ -388,6 +435,29 @@ static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
     i->proc.types.pointer.last_point.y = i->proc.types.pointer.act_point.y;
 }
 
+#if LV_USE_INDEV_FILTER
+/**
+ * Smooth the point and extrapolate it to the expected time of displaying
+ * @param i pointer to an input device
+ * @param data pointer to the data read from the input device
+ */
+static void indev_pointer_filter(lv_indev_t * i, lv_indev_data_t * data)
+{
+    const lv_point_filter_cfg_t * cfg = &i->driver->filter;
+    if(cfg->min_cutoff == 0 && cfg->predict_time == 0) return;
+
+    /*Release where the pointer really was and start again at the next press*/
+    if(data->state == LV_INDEV_STATE_RELEASED) {
+        lv_point_filter_reset(&i->proc.types.pointer.filter);
+        return;
+    }
+
+    uint32_t now = lv_tick_get();
+    uint32_t time = data->timestamp ? data->timestamp : now;
+    lv_point_filter_apply(&i->proc.types.pointer.filter, cfg, &data->point, time, now);
+}
+#endif
+
 /**
  * Process a new point from LV_INDEV_TYPE_KEYPAD input device
  * @param i pointer to an input device
@@ -817,6 +887,7 @@ static void indev_button_proc(lv_indev_t * i, lv_indev_data_t * data)
 static void indev_proc_press(_lv_indev_proc_t * proc)
 {
     LV_LOG_INFO("pressed at x:%d y:%d", proc->types.pointer.act_point.x, proc->types.pointer.act_point.y);
+    LV_LATENCY_TRACE_POINT(LV_LATENCY_TRACE_INDEV_PRESS);
     indev_obj_act = proc->types.pointer.act_obj;
 
     if(proc->wait_until_release != 0) return;
@@ -1020,6 +1091,9 @@ static void indev_proc_reset_query_handler(lv_indev_t * indev)
         indev->proc.types.pointer.scroll_throw_vect.y = 0;
         indev->proc.types.pointer.gesture_sum.x     = 0;
         indev->proc.types.pointer.gesture_sum.y     = 0;
+#if LV_USE_INDEV_FILTER
+        lv_point_filter_reset(&indev->proc.types.pointer.filter);
+#endif
         indev->proc.reset_query                     = 0;
         indev_obj_act                               = NULL;
     }
@@ -25,6 +25,15 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Statistics of `lv_indev_search_obj()`
+ */
+typedef struct {
+    uint32_t search_cnt;        /**< Number of searches started on a screen or layer*/
+    uint32_t visit_cnt;         /**< Number of objects checked*/
+    uint32_t grid_build_cnt;    /**< Number of times a grid of children was (re)built (`LV_OBJ_HIT_GRID_MIN_CHILD`)*/
+} lv_indev_search_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -165,6 +174,17 @@ lv_timer_t * lv_indev_get_read_timer(lv_disp_t * indev);
  */
 lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point);
 
+/**
+ * Get the statistics of the object searches since the last `lv_indev_reset_search_stat()`
+ * @param stat      pointer to a variable to store the result
+ */
+void lv_indev_get_search_stat(lv_indev_search_stat_t * stat);
+
+/**
+ * Reset the statistics of the object searches
+ */
+void lv_indev_reset_search_stat(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,325 @@
+/**
+ * @file lv_indev_multi_touch.c
+ * Recognize pinch, rotate and pan of two fingers.
+ *
+ * The first two touches are tracked by their IDs until one of them is lifted, so the other touches
+ * and the order of the touches in `lv_indev_data_t` don't matter. The samples only update the points,
+ * the distance, angle and midpoint are compared once in every refresh of the display,
+ * so the events don't flood the UI if the touch panel reports faster than the display refreshes.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_indev.h"
+#include "lv_disp.h"
+#include "lv_indev_multi_touch.h"
+#if LV_INDEV_MULTI_TOUCH_MAX
+
+#include "../misc/lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SCALE_UNCHANGED     256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_indev(lv_indev_t * indev);
+static void send(_lv_indev_multi_touch_t * mt, lv_multi_gesture_state_t state, const lv_point_t * center,
+                 int32_t dist, int16_t angle);
+static lv_obj_t * find_gesture_obj(lv_indev_t * indev, const lv_point_t * center);
+static const lv_indev_touch_t * find_touch(const lv_indev_data_t * data, uint8_t cnt, uint8_t id);
+static void rotate_point(const lv_disp_t * disp, lv_point_t * p);
+static void get_center(const _lv_indev_multi_touch_t * mt, lv_point_t * center);
+static int32_t get_dist(const _lv_indev_multi_touch_t * mt);
+static int16_t get_angle(const _lv_indev_multi_touch_t * mt, int16_t ref);
+static int16_t wrap_angle(int32_t angle);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_indev_multi_touch_handler(lv_indev_t * indev, const lv_indev_data_t * data)
+{
+    _lv_indev_multi_touch_t * mt = &indev->proc.types.pointer.multi_touch;
+    uint8_t cnt = 0;
+    if(data->state == LV_INDEV_STATE_PRESSED) cnt = LV_MIN(data->touch_cnt, LV_INDEV_MULTI_TOUCH_MAX);
+
+    if(mt->tracking) {
+        const lv_indev_touch_t * t0 = find_touch(data, cnt, mt->ids[0]);
+        const lv_indev_touch_t * t1 = find_touch(data, cnt, mt->ids[1]);
+        if(t0 && t1) {
+            lv_point_t p0 = t0->point;
+            lv_point_t p1 = t1->point;
+            rotate_point(indev->driver->disp, &p0);
+            rotate_point(indev->driver->disp, &p1);
+            if(p0.x != mt->points[0].x || p0.y != mt->points[0].y ||
+               p1.x != mt->points[1].x || p1.y != mt->points[1].y) {
+                mt->points[0] = p0;
+                mt->points[1] = p1;
+                mt->changed = 1;
+            }
+        }
+        else {
+            /*Finish the gesture in the next refresh, or forget it if it wasn't recognized yet*/
+            mt->tracking = 0;
+            if(mt->began) mt->ended = 1;
+            else mt->changed = 0;
+        }
+    }
+
+    /*Track two new touches. Wait until the end of the last gesture is sent.*/
+    if(!mt->tracking && !mt->ended && cnt >= 2 && data->touches[0].id != data->touches[1].id) {
+        mt->ids[0] = data->touches[0].id;
+        mt->ids[1] = data->touches[1].id;
+        mt->points[0] = data->touches[0].point;
+        mt->points[1] = data->touches[1].point;
+        rotate_point(indev->driver->disp, &mt->points[0]);
+        rotate_point(indev->driver->disp, &mt->points[1]);
+
+        get_center(mt, &mt->start_center);
+        mt->last_center = mt->start_center;
+        mt->start_dist = get_dist(mt);
+        mt->last_dist = mt->start_dist;
+        mt->start_angle = get_angle(mt, 0);
+        mt->last_angle = mt->start_angle;
+        mt->obj = NULL;
+        mt->types = 0;
+        mt->began = 0;
+        mt->changed = 0;
+        mt->tracking = 1;
+    }
+
+    /*The display's refresh timer is paused if there is nothing to redraw*/
+    if(mt->changed || mt->ended) {
+        lv_disp_t * disp = indev->driver->disp;
+        if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+    }
+}
+
+void _lv_indev_multi_touch_flush(lv_disp_t * disp)
+{
+    lv_indev_t * indev = lv_indev_get_next(NULL);
+    while(indev) {
+        if(indev->driver->type == LV_INDEV_TYPE_POINTER && indev->driver->disp == disp) {
+            flush_indev(indev);
+        }
+        indev = lv_indev_get_next(indev);
+    }
+}
+
+void _lv_indev_multi_touch_reset(lv_indev_t * indev, lv_obj_t * obj)
+{
+    if(indev->driver->type != LV_INDEV_TYPE_POINTER) return;
+
+    _lv_indev_multi_touch_t * mt = &indev->proc.types.pointer.multi_touch;
+    if(obj == NULL || mt->obj == obj) {
+        lv_memset_00(mt, sizeof(_lv_indev_multi_touch_t));
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_indev(lv_indev_t * indev)
+{
+    _lv_indev_multi_touch_t * mt = &indev->proc.types.pointer.multi_touch;
+    if(!mt->changed && !mt->ended) return;
+    mt->changed = 0;
+
+    lv_point_t center;
+    get_center(mt, &center);
+    int32_t dist = get_dist(mt);
+    int16_t angle = get_angle(mt, mt->last_angle);
+
+    /*Recognize the components compared to the first touch, so slow movements are detected too*/
+    if(!(mt->types & LV_MULTI_GESTURE_PINCH) &&
+       LV_ABS(dist - mt->start_dist) >= ((int32_t)indev->driver->pinch_limit << 8)) {
+        mt->types |= LV_MULTI_GESTURE_PINCH;
+    }
+    if(!(mt->types & LV_MULTI_GESTURE_ROTATE) && LV_ABS(angle - mt->start_angle) >= indev->driver->rotate_limit) {
+        mt->types |= LV_MULTI_GESTURE_ROTATE;
+    }
+    if(!(mt->types & LV_MULTI_GESTURE_PAN) &&
+       (LV_ABS(center.x - mt->start_center.x) >= indev->driver->scroll_limit ||
+        LV_ABS(center.y - mt->start_center.y) >= indev->driver->scroll_limit)) {
+        mt->types |= LV_MULTI_GESTURE_PAN;
+    }
+
+    if(!mt->began) {
+        if(mt->types == 0) return;
+
+        mt->obj = find_gesture_obj(indev, &center);
+        if(mt->obj == NULL) {
+            _lv_indev_multi_touch_reset(indev, NULL);
+            return;
+        }
+
+        /*It's not a click or scroll of the first finger anymore*/
+        lv_indev_wait_release(indev);
+        mt->began = 1;
+        send(mt, LV_MULTI_GESTURE_BEGIN, &center, dist, angle);
+        /*The object might be deleted in the event*/
+        if(mt->obj == NULL) return;
+    }
+    else if(mt->tracking) {
+        send(mt, LV_MULTI_GESTURE_CHANGE, &center, dist, angle);
+        if(mt->obj == NULL) return;
+    }
+
+    if(mt->ended) {
+        send(mt, LV_MULTI_GESTURE_END, &center, dist, angle);
+        _lv_indev_multi_touch_reset(indev, NULL);
+    }
+}
+
+/**
+ * Send the changes since the last event and save the new state as the last one
+ */
+static void send(_lv_indev_multi_touch_t * mt, lv_multi_gesture_state_t state, const lv_point_t * center,
+                 int32_t dist, int16_t angle)
+{
+    lv_multi_gesture_t g;
+    lv_memset_00(&g, sizeof(g));
+    g.state = state;
+    g.types = mt->types;
+    g.center = *center;
+    g.scale = SCALE_UNCHANGED;
+
+    if(mt->types & LV_MULTI_GESTURE_PAN) {
+        g.pan.x = center->x - mt->last_center.x;
+        g.pan.y = center->y - mt->last_center.y;
+        mt->last_center = *center;
+    }
+    if(mt->types & LV_MULTI_GESTURE_PINCH) {
+        g.scale = (dist * SCALE_UNCHANGED) / LV_MAX(mt->last_dist, 1);
+        mt->last_dist = dist;
+    }
+    if(mt->types & LV_MULTI_GESTURE_ROTATE) {
+        g.rotation = angle - mt->last_angle;
+        mt->last_angle = angle;
+    }
+
+    g.pan_sum.x = mt->last_center.x - mt->start_center.x;
+    g.pan_sum.y = mt->last_center.y - mt->start_center.y;
+    g.scale_sum = (mt->last_dist * SCALE_UNCHANGED) / LV_MAX(mt->start_dist, 1);
+    g.rotation_sum = mt->last_angle - mt->start_angle;
+
+    lv_event_send(mt->obj, LV_EVENT_MULTI_GESTURE, &g);
+}
+
+/**
+ * Get the object which receives the gesture: the pressed object or the object under the midpoint,
+ * or their first parent without `LV_OBJ_FLAG_GESTURE_BUBBLE`
+ */
+static lv_obj_t * find_gesture_obj(lv_indev_t * indev, const lv_point_t * center)
+{
+    lv_obj_t * obj = indev->proc.types.pointer.act_obj;
+    if(obj == NULL) {
+        lv_disp_t * disp = indev->driver->disp;
+        obj = lv_indev_search_obj(lv_disp_get_layer_sys(disp), (lv_point_t *)center);
+        if(obj == NULL) obj = lv_indev_search_obj(lv_disp_get_layer_top(disp), (lv_point_t *)center);
+        if(obj == NULL) obj = lv_indev_search_obj(lv_disp_get_scr_act(disp), (lv_point_t *)center);
+    }
+
+    while(obj && lv_obj_has_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE)) {
+        obj = lv_obj_get_parent(obj);
+    }
+
+    return obj;
+}
+
+static const lv_indev_touch_t * find_touch(const lv_indev_data_t * data, uint8_t cnt, uint8_t id)
+{
+    uint8_t i;
+    for(i = 0; i < cnt; i++) {
+        if(data->touches[i].id == id) return &data->touches[i];
+    }
+
+    return NULL;
+}
+
+/**
+ * Rotate a point of the touch panel the same way as `lv_indev_data_t`'s `point`
+ */
+static void rotate_point(const lv_disp_t * disp, lv_point_t * p)
+{
+    if(disp->driver->rotated == LV_DISP_ROT_180 || disp->driver->rotated == LV_DISP_ROT_270) {
+        p->x = disp->driver->hor_res - p->x - 1;
+        p->y = disp->driver->ver_res - p->y - 1;
+    }
+    if(disp->driver->rotated == LV_DISP_ROT_90 || disp->driver->rotated == LV_DISP_ROT_270) {
+        lv_coord_t tmp = p->y;
+        p->y = p->x;
+        p->x = disp->driver->ver_res - tmp - 1;
+    }
+}
+
+static void get_center(const _lv_indev_multi_touch_t * mt, lv_point_t * center)
+{
+    center->x = (mt->points[0].x + mt->points[1].x) / 2;
+    center->y = (mt->points[0].y + mt->points[1].y) / 2;
+}
+
+/**
+ * Get the distance of the two touches
+ * @return      the distance [1/256 px]
+ */
+static int32_t get_dist(const _lv_indev_multi_touch_t * mt)
+{
+    uint32_t dx = LV_ABS(mt->points[1].x - mt->points[0].x);
+    uint32_t dy = LV_ABS(mt->points[1].y - mt->points[0].y);
+    lv_sqrt_res_t res;
+    lv_sqrt(dx * dx + dy * dy, &res, 0x8000);
+    return ((int32_t)res.i << 8) + res.f;
+}
+
+/**
+ * Get the angle of the line from the first touch to the second one
+ * @param mt        the tracked touches
+ * @param ref       return the angle closest to this [deg], e.g. 370 instead of 10 if it's 350
+ * @return          the angle [deg], clockwise from the X axis
+ */
+static int16_t get_angle(const _lv_indev_multi_touch_t * mt, int16_t ref)
+{
+    int32_t dx = mt->points[1].x - mt->points[0].x;
+    int32_t dy = mt->points[1].y - mt->points[0].y;
+    if(dx == 0 && dy == 0) return ref;
+
+    /*`lv_atan2` works only in +-1456*/
+    while(LV_ABS(dx) > 1456 || LV_ABS(dy) > 1456) {
+        dx /= 2;
+        dy /= 2;
+    }
+
+    int16_t angle = lv_atan2(dy, dx);
+    return ref + wrap_angle(angle - ref);
+}
+
+/**
+ * Wrap an angle to [-180..180)
+ */
+static int16_t wrap_angle(int32_t angle)
+{
+    angle %= 360;
+    if(angle >= 180) angle -= 360;
+    else if(angle < -180) angle += 360;
+    return (int16_t)angle;
+}
+
+#endif /*LV_INDEV_MULTI_TOUCH_MAX*/
@@ -0,0 +1,63 @@
+/**
+ * @file lv_indev_multi_touch.h
+ *
+ */
+
+#ifndef LV_INDEV_MULTI_TOUCH_H
+#define LV_INDEV_MULTI_TOUCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj.h"
+
+#if LV_INDEV_MULTI_TOUCH_MAX
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Track the touches of a new sample. Called by LVGL for every sample of a pointer input device.
+ * The changes are only collected here, the events are sent by `_lv_indev_multi_touch_flush()`.
+ * @param indev     pointer to an input device
+ * @param data      the data read from the input device
+ */
+void _lv_indev_multi_touch_handler(lv_indev_t * indev, const lv_indev_data_t * data);
+
+/**
+ * Send `LV_EVENT_MULTI_GESTURE` with the changes since the last refresh. Called by LVGL before refreshing a display.
+ * @param disp      pointer to the display being refreshed
+ */
+void _lv_indev_multi_touch_flush(lv_disp_t * disp);
+
+/**
+ * Forget the two finger gesture of an input device without sending `LV_MULTI_GESTURE_END`
+ * @param indev     pointer to an input device
+ * @param obj       forget the gesture only if it's sent to this object, NULL: forget it anyway
+ */
+void _lv_indev_multi_touch_reset(lv_indev_t * indev, lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_INDEV_MULTI_TOUCH_MAX*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_INDEV_MULTI_TOUCH_H*/
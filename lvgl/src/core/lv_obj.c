@@ -60,6 +60,7 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_scrollbar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static lv_res_t scrollbar_init_draw_dsc(lv_obj_t * obj, lv_draw_rect_dsc_t * dsc);
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find);
+static bool depends_on_parent_size(lv_obj_t * obj, bool w_changed, bool h_changed);
 static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state);
 
 /**********************
@@ -76,6 +77,14 @@ const lv_obj_class_t lv_obj_class = {
     .group_def = LV_OBJ_CLASS_GROUP_DEF_FALSE,
     .instance_size = (sizeof(lv_obj_t)),
     .base_class = NULL,
+    .handled_events = LV_EVENT_MASK(LV_EVENT_PRESSED) | LV_EVENT_MASK(LV_EVENT_RELEASED) |
+                      LV_EVENT_MASK(LV_EVENT_PRESS_LOST) | LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) |
+                      LV_EVENT_MASK(LV_EVENT_KEY) | LV_EVENT_MASK(LV_EVENT_FOCUSED) |
+                      LV_EVENT_MASK(LV_EVENT_SCROLL_BEGIN) | LV_EVENT_MASK(LV_EVENT_SCROLL_END) |
+                      LV_EVENT_MASK(LV_EVENT_DEFOCUSED) | LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) |
+                      LV_EVENT_MASK(LV_EVENT_CHILD_CHANGED) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                      LV_EVENT_MASK(LV_EVENT_DRAW_MAIN) | LV_EVENT_MASK(LV_EVENT_DRAW_POST) |
+                      LV_EVENT_MASK(LV_EVENT_COVER_CHECK),
 };
 
 /**********************
@@ -231,6 +240,10 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
         lv_obj_invalidate(obj);
     }
 
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        _lv_obj_child_map_changed(lv_obj_get_parent(obj));
+    }
+
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
         lv_obj_mark_layout_as_dirty(obj);
@@ -258,6 +271,10 @@ void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        _lv_obj_child_map_changed(lv_obj_get_parent(obj));
+    }
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         if(lv_obj_is_layout_positioned(obj)) {
@@ -438,6 +455,7 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+    _lv_obj_style_refr_remove(obj);
 
     /*Remove the animations from this object*/
     lv_anim_del(obj, NULL);
@@ -447,6 +465,7 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     if(group) lv_group_remove_obj(obj);
 
     if(obj->spec_attr) {
+        _lv_obj_hit_grid_free(obj);
         if(obj->spec_attr->children) {
             lv_mem_free(obj->spec_attr->children);
             obj->spec_attr->children = NULL;
@@ -459,6 +478,8 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         lv_mem_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
+
+    _lv_obj_style_cache_release(obj);
 }
 
 static void lv_obj_draw(lv_event_t * e)
@@ -468,34 +489,7 @@ static void lv_obj_draw(lv_event_t * e)
     if(code == LV_EVENT_COVER_CHECK) {
         lv_cover_check_info_t * info = lv_event_get_param(e);
         if(info->res == LV_COVER_RES_MASKED) return;
-        if(lv_obj_get_style_clip_corner(obj, LV_PART_MAIN)) {
-            info->res = LV_COVER_RES_MASKED;
-            return;
-        }
-
-        /*Most trivial test. Is the mask fully IN the object? If no it surely doesn't cover it*/
-        lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
-        lv_coord_t w = lv_obj_get_style_transform_width(obj, LV_PART_MAIN);
-        lv_coord_t h = lv_obj_get_style_transform_height(obj, LV_PART_MAIN);
-        lv_area_t coords;
-        lv_area_copy(&coords, &obj->coords);
-        coords.x1 -= w;
-        coords.x2 += w;
-        coords.y1 -= h;
-        coords.y2 += h;
-
-        if(_lv_area_is_in(info->area, &coords, r) == false) {
-            info->res = LV_COVER_RES_NOT_COVER;
-            return;
-        }
-
-        if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) {
-            info->res = LV_COVER_RES_NOT_COVER;
-            return;
-        }
-
-        info->res = LV_COVER_RES_COVER;
-
+        info->res = _lv_obj_check_cover(obj, info->area);
     }
     else if(code == LV_EVENT_DRAW_MAIN) {
         lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
@@ -822,11 +816,16 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
             lv_obj_mark_layout_as_dirty(obj);
         }
 
+        /*Update only the children which depend on the changed dimension*/
+        const lv_area_t * ori = lv_event_get_param(e);
+        bool w_changed = ori == NULL || lv_area_get_width(ori) != lv_obj_get_width(obj);
+        bool h_changed = ori == NULL || lv_area_get_height(ori) != lv_obj_get_height(obj);
+
         uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
         for(i = 0; i < child_cnt; i++) {
             lv_obj_t * child = obj->spec_attr->children[i];
-            lv_obj_mark_layout_as_dirty(child);
+            if(depends_on_parent_size(child, w_changed, h_changed)) lv_obj_mark_layout_as_dirty(child);
         }
     }
     else if(code == LV_EVENT_CHILD_CHANGED) {
@@ -866,6 +865,9 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == _LV_STYLE_STATE_CMP_SAME) return;
 
+    /*The children might inherit the changed values*/
+    _lv_obj_style_cache_invalidate_obj(obj);
+
     _lv_obj_style_transition_dsc_t * ts = lv_mem_buf_get(sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     lv_memset_00(ts, sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
@@ -926,6 +928,46 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     }
 }
 
+/**
+ * Check if the size or position of an object is calculated from its parent's size
+ * @param obj       pointer to an object
+ * @param w_changed true: the width of the parent has changed
+ * @param h_changed true: the height of the parent has changed
+ * @return          true: the object needs to be updated
+ */
+static bool depends_on_parent_size(lv_obj_t * obj, bool w_changed, bool h_changed)
+{
+    if(obj->w_layout || obj->h_layout) return true;
+
+    if(w_changed) {
+        if(LV_COORD_IS_PCT(lv_obj_get_style_width(obj, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_min_width(obj, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_max_width(obj, LV_PART_MAIN))) return true;
+    }
+    if(h_changed) {
+        if(LV_COORD_IS_PCT(lv_obj_get_style_height(obj, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_min_height(obj, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_max_height(obj, LV_PART_MAIN))) return true;
+    }
+
+    /*The position of the layout positioned children is set by the layout of the parent*/
+    if(lv_obj_is_layout_positioned(obj)) return false;
+
+    lv_align_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
+    if(align != LV_ALIGN_DEFAULT && align != LV_ALIGN_TOP_LEFT) return true;
+    if(w_changed) {
+        if(lv_obj_get_style_base_dir(obj, LV_PART_MAIN) != LV_BASE_DIR_LTR) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_x(obj, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_translate_x(obj, LV_PART_MAIN))) return true;
+    }
+    if(h_changed) {
+        if(LV_COORD_IS_PCT(lv_obj_get_style_y(obj, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_translate_y(obj, LV_PART_MAIN))) return true;
+    }
+
+    return false;
+}
+
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find)
 {
     /*Check all children of `parent`*/
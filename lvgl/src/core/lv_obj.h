@@ -108,6 +108,8 @@ enum {
     LV_OBJ_FLAG_IGNORE_LAYOUT   = (1L << 17), /**< Make the object position-able by the layouts*/
     LV_OBJ_FLAG_FLOATING        = (1L << 18), /**< Do not scroll the object when the parent scrolls and ignore layout*/
     LV_OBJ_FLAG_OVERFLOW_VISIBLE = (1L << 19), /**< Do not clip the children's content to the parent's boundary*/
+    LV_OBJ_FLAG_SCROLL_BLIT     = (1L << 20), /**< Move the rendered pixels when scrolled. Only the content, a plain background and the scrollbars can be drawn on the object.*/
+    LV_OBJ_FLAG_SCROLL_PAN      = (1L << 21), /**< Pan the pre-rendered screen when a full-screen object is scrolled horizontally*/
 
     LV_OBJ_FLAG_LAYOUT_1        = (1L << 23), /**< Custom flag, free to use by layouts*/
     LV_OBJ_FLAG_LAYOUT_2        = (1L << 24), /**< Custom flag, free to use by layouts*/
@@ -140,6 +142,7 @@ typedef enum {
 #include "lv_obj_style.h"
 #include "lv_obj_draw.h"
 #include "lv_obj_class.h"
+#include "lv_obj_hit_grid.h"
 #include "lv_event.h"
 #include "lv_group.h"
 
@@ -169,6 +172,13 @@ typedef struct {
     lv_dir_t scroll_dir : 4;                /**< The allowed scroll direction(s)*/
     uint8_t event_dsc_cnt : 6;              /**< Number of event callbacks stored in `event_dsc` array*/
     uint8_t layer_type : 2;    /**< Cache the layer type here. Element of @lv_intermediate_layer_type_t */
+    uint32_t child_map_ver;    /**< Changes when the children are added, removed, reordered, moved or resized*/
+#if LV_OBJ_HIT_GRID_MIN_CHILD
+    struct _lv_obj_hit_grid_t * hit_grid;   /**< Index of the children to find the pressed one faster*/
+#endif
+#if LV_OBJ_EVENT_MASK
+    uint64_t event_mask;                    /**< Bitmap of the event codes having a callback in `event_dsc`*/
+#endif
 } _lv_obj_spec_attr_t;
 
 typedef struct _lv_obj_t {
@@ -176,6 +186,12 @@ typedef struct _lv_obj_t {
     struct _lv_obj_t * parent;
     _lv_obj_spec_attr_t * spec_attr;
     _lv_obj_style_t * styles;
+#if LV_OBJ_STYLE_CACHE_SIZE
+    _lv_obj_style_cache_t * style_cache;
+#endif
+#if LV_OBJ_STYLE_CACHE_SIZE || LV_OBJ_COVER_CACHE
+    uint32_t style_version;         /*Incremented when a resolved style value of the object might change*/
+#endif
 #if LV_USE_USER_DATA
     void * user_data;
 #endif
@@ -188,6 +204,24 @@ typedef struct _lv_obj_t {
     uint16_t style_cnt  : 6;
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
+    uint16_t style_refr_queued : 1;
+    uint16_t child_layout_inv : 1;  /*A descendant has `layout_inv` or `layout_pos_inv` set*/
+    uint16_t layout_pos_inv : 1;    /*Only the position needs to be updated*/
+#if LV_OBJ_STYLE_REFR_DEFER
+    uint8_t style_refr_flags;       /*What to do in the queued style refresh*/
+#endif
+#if LV_OBJ_SELF_SIZE_CACHE
+    uint8_t self_size_flags;        /*Validity and the layout flags the self size was measured with*/
+    lv_point_t self_size_key;       /*Size of the object when the self size was measured*/
+    lv_point_t self_size;           /*Cached result of `LV_EVENT_GET_SELF_SIZE`*/
+#endif
+#if LV_OBJ_COVER_CACHE
+    uint32_t cover_version;         /*Style version the cover fields were read with*/
+    lv_coord_t cover_radius;        /*Radius of the background*/
+    lv_coord_t cover_ext_w;         /*The background is larger than `coords` by this horizontally (transform width)...*/
+    lv_coord_t cover_ext_h;         /*...and vertically*/
+    uint8_t cover_flags;            /*Clip corner and opaque background flags*/
+#endif
 } lv_obj_t;
 
 
@@ -60,6 +60,8 @@ typedef struct _lv_obj_class_t {
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
     uint32_t instance_size : 16;
+    uint64_t handled_events;           /**< Bitmap of the event codes `event_cb` reacts to, see `LV_EVENT_MASK()`.
+                                            0: not specified, every event is sent to `event_cb`*/
 } lv_obj_class_t;
 
 /**********************
@@ -16,6 +16,9 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#define COVER_MASKED    0x01    /*`clip_corner` is set*/
+#define COVER_OPAQUE    0x02    /*The background is opaque*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -23,6 +26,9 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_OBJ_COVER_CACHE
+    static void cover_cache_update(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -394,6 +400,42 @@ lv_coord_t _lv_obj_get_ext_draw_size(const lv_obj_t * obj)
     else return 0;
 }
 
+lv_cover_res_t _lv_obj_check_cover(lv_obj_t * obj, const lv_area_t * area)
+{
+#if LV_OBJ_COVER_CACHE
+    cover_cache_update(obj);
+    uint8_t flags = obj->cover_flags;
+    lv_coord_t r = obj->cover_radius;
+    lv_coord_t w = obj->cover_ext_w;
+    lv_coord_t h = obj->cover_ext_h;
+#else
+    uint8_t flags = 0;
+    if(lv_obj_get_style_clip_corner(obj, LV_PART_MAIN)) flags |= COVER_MASKED;
+    lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    lv_coord_t w = lv_obj_get_style_transform_width(obj, LV_PART_MAIN);
+    lv_coord_t h = lv_obj_get_style_transform_height(obj, LV_PART_MAIN);
+#endif
+
+    if(flags & COVER_MASKED) return LV_COVER_RES_MASKED;
+
+    /*Most trivial test. Is the mask fully IN the object? If no it surely doesn't cover it*/
+    lv_area_t coords;
+    lv_area_copy(&coords, &obj->coords);
+    coords.x1 -= w;
+    coords.x2 += w;
+    coords.y1 -= h;
+    coords.y2 += h;
+    if(_lv_area_is_in(area, &coords, r) == false) return LV_COVER_RES_NOT_COVER;
+
+#if LV_OBJ_COVER_CACHE
+    if((flags & COVER_OPAQUE) == 0) return LV_COVER_RES_NOT_COVER;
+#else
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return LV_COVER_RES_NOT_COVER;
+#endif
+
+    return LV_COVER_RES_COVER;
+}
+
 lv_layer_type_t _lv_obj_get_layer_type(const lv_obj_t * obj)
 {
 
@@ -404,3 +446,25 @@ lv_layer_type_t _lv_obj_get_layer_type(const lv_obj_t * obj)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_OBJ_COVER_CACHE
+/**
+ * Read the styles affecting the cover check again if they might have changed since the last time.
+ * Only relative values are stored so moving or scrolling the object keeps the cache valid.
+ * @param obj       pointer to an object
+ */
+static void cover_cache_update(lv_obj_t * obj)
+{
+    uint32_t version = _lv_obj_style_get_version(obj);
+    if(obj->cover_version == version) return;
+
+    uint8_t flags = 0;
+    if(lv_obj_get_style_clip_corner(obj, LV_PART_MAIN)) flags |= COVER_MASKED;
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) >= LV_OPA_MAX) flags |= COVER_OPAQUE;
+    obj->cover_flags = flags;
+    obj->cover_radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    obj->cover_ext_w = lv_obj_get_style_transform_width(obj, LV_PART_MAIN);
+    obj->cover_ext_h = lv_obj_get_style_transform_height(obj, LV_PART_MAIN);
+    obj->cover_version = version;
+}
+#endif
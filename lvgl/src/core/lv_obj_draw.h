@@ -159,6 +159,15 @@ void lv_obj_refresh_ext_draw_size(struct _lv_obj_t * obj);
 lv_coord_t _lv_obj_get_ext_draw_size(const struct _lv_obj_t * obj);
 
 
+/**
+ * Check if the background of an object covers an area, the way the base object does it on `LV_EVENT_COVER_CHECK`.
+ * With `LV_OBJ_COVER_CACHE` the style values are read only if they might have changed since the last check.
+ * @param obj       pointer to an object
+ * @param area      the area to check in absolute coordinates
+ * @return          `LV_COVER_RES_MASKED` if the corners are clipped, else whether `area` is covered
+ */
+lv_cover_res_t _lv_obj_check_cover(struct _lv_obj_t * obj, const lv_area_t * area);
+
 lv_layer_type_t _lv_obj_get_layer_type(const struct _lv_obj_t * obj);
 
 /**********************
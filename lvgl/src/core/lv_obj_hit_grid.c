@@ -0,0 +1,338 @@
+/**
+ * @file lv_obj_hit_grid.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_hit_grid.h"
+#include "lv_obj.h"
+
+#if LV_OBJ_HIT_GRID_MIN_CHILD
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MAX_CELL_SIDE       128     /*Max number of columns and rows*/
+#define MAX_CHILD_CNT       0xFFFF  /*The children are stored on 16 bit*/
+#define MAX_ITEMS_PER_CHILD 8       /*Don't use a grid if the children overlap too many cells on average*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    CHILD_SKIP,     /*Never under a point (hidden)*/
+    CHILD_ALWAYS,   /*Might be anywhere (floating, transformed, has visible overflow or covers many cells)*/
+    CHILD_CELLS,    /*Only in the cells of its click area*/
+} child_kind_t;
+
+/**
+ * The click areas are stored relative to the top left corner of the object's scrolled content.
+ * Scrolling moves all (not floating) children together, and moving the object moves its children too,
+ * so these coordinates change only if a child is moved relative to the object.
+ */
+typedef struct _lv_obj_hit_grid_t {
+    lv_area_t bounds;       /*The area covered by the cells*/
+    lv_coord_t cell_w;
+    lv_coord_t cell_h;
+    uint16_t col_cnt;       /*0: the children overlap too much, use no grid*/
+    uint16_t row_cnt;
+    uint32_t always_cnt;
+    uint32_t * cell_start;  /*Index of the first child of each cell in `items` and the total count at the end*/
+    uint16_t * items;       /*Child indices per cell, the topmost first*/
+    uint16_t * always;      /*Child indices which are checked at every point, the topmost first*/
+    void * buf;             /*Holds `cell_start`, `items` and `always`*/
+    uint32_t buf_size;
+    uint32_t child_map_ver; /*The version of the children the grid was built for*/
+} _lv_obj_hit_grid_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void grid_build(lv_obj_t * obj, _lv_obj_hit_grid_t * grid);
+static void get_origin(const lv_obj_t * obj, lv_point_t * origin);
+static child_kind_t get_child_area(const lv_obj_t * child, const lv_point_t * origin, lv_area_t * area);
+static bool get_cell_range(const _lv_obj_hit_grid_t * grid, const lv_area_t * area, lv_area_t * range);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_obj_hit_grid_iter_init(lv_obj_t * obj, const lv_point_t * point, _lv_obj_hit_grid_iter_t * iter)
+{
+    lv_memset_00(iter, sizeof(_lv_obj_hit_grid_iter_t));
+    iter->obj = obj;
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    iter->next = (int32_t)child_cnt - 1;
+    if(child_cnt < LV_OBJ_HIT_GRID_MIN_CHILD || child_cnt > MAX_CHILD_CNT) {
+        _lv_obj_hit_grid_free(obj);
+        return;
+    }
+
+    _lv_obj_hit_grid_t * grid = obj->spec_attr->hit_grid;
+    if(grid == NULL) {
+        grid = lv_mem_alloc(sizeof(_lv_obj_hit_grid_t));
+        LV_ASSERT_MALLOC(grid);
+        if(grid == NULL) return;
+        lv_memset_00(grid, sizeof(_lv_obj_hit_grid_t));
+        grid->child_map_ver = _lv_obj_get_child_map_ver(obj) - 1;
+        obj->spec_attr->hit_grid = grid;
+    }
+
+    if(grid->child_map_ver != _lv_obj_get_child_map_ver(obj)) {
+        grid_build(obj, grid);
+        iter->built = 1;
+    }
+    if(grid->col_cnt == 0) return;
+
+    iter->use_grid = 1;
+    iter->always = grid->always;
+    iter->always_cnt = grid->always_cnt;
+
+    lv_point_t origin;
+    get_origin(obj, &origin);
+    lv_point_t p;
+    p.x = point->x - origin.x;
+    p.y = point->y - origin.y;
+    if(!_lv_area_is_point_on(&grid->bounds, &p, 0)) return;
+
+    uint32_t col = (p.x - grid->bounds.x1) / grid->cell_w;
+    uint32_t row = (p.y - grid->bounds.y1) / grid->cell_h;
+    uint32_t cell = row * grid->col_cnt + col;
+    iter->cell = &grid->items[grid->cell_start[cell]];
+    iter->cell_cnt = grid->cell_start[cell + 1] - grid->cell_start[cell];
+}
+
+lv_obj_t * _lv_obj_hit_grid_iter_next(_lv_obj_hit_grid_iter_t * iter)
+{
+    lv_obj_t ** children = iter->obj->spec_attr ? iter->obj->spec_attr->children : NULL;
+
+    if(!iter->use_grid) {
+        if(iter->next < 0) return NULL;
+        lv_obj_t * child = children[iter->next];
+        iter->next--;
+        return child;
+    }
+
+    /*Both lists are ordered from the topmost child so merge them to keep the order*/
+    uint32_t id;
+    if(iter->cell_cnt && iter->always_cnt) {
+        if(iter->cell[0] > iter->always[0]) {
+            id = iter->cell[0];
+            iter->cell++;
+            iter->cell_cnt--;
+        }
+        else {
+            id = iter->always[0];
+            iter->always++;
+            iter->always_cnt--;
+        }
+    }
+    else if(iter->cell_cnt) {
+        id = iter->cell[0];
+        iter->cell++;
+        iter->cell_cnt--;
+    }
+    else if(iter->always_cnt) {
+        id = iter->always[0];
+        iter->always++;
+        iter->always_cnt--;
+    }
+    else {
+        return NULL;
+    }
+
+    return children[id];
+}
+
+#endif /*LV_OBJ_HIT_GRID_MIN_CHILD*/
+
+void _lv_obj_hit_grid_free(lv_obj_t * obj)
+{
+#if LV_OBJ_HIT_GRID_MIN_CHILD
+    if(obj->spec_attr == NULL || obj->spec_attr->hit_grid == NULL) return;
+
+    lv_mem_free(obj->spec_attr->hit_grid->buf);
+    lv_mem_free(obj->spec_attr->hit_grid);
+    obj->spec_attr->hit_grid = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_OBJ_HIT_GRID_MIN_CHILD
+
+static void grid_build(lv_obj_t * obj, _lv_obj_hit_grid_t * grid)
+{
+    grid->child_map_ver = _lv_obj_get_child_map_ver(obj);
+    grid->col_cnt = 0;
+
+    lv_obj_t ** children = obj->spec_attr->children;
+    uint32_t child_cnt = obj->spec_attr->child_cnt;
+    lv_point_t origin;
+    get_origin(obj, &origin);
+
+    /*Get the area covered by the children*/
+    uint32_t cells_child_cnt = 0;
+    lv_area_t a;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        if(get_child_area(children[i], &origin, &a) != CHILD_CELLS) continue;
+        if(cells_child_cnt == 0) grid->bounds = a;
+        else _lv_area_join(&grid->bounds, &grid->bounds, &a);
+        cells_child_cnt++;
+    }
+
+    /*Have about as many cells as children, with the aspect ratio of the covered area*/
+    if(cells_child_cnt == 0) {
+        lv_area_set(&grid->bounds, 0, 0, 0, 0);
+        cells_child_cnt = 1;
+    }
+    uint32_t w = lv_area_get_width(&grid->bounds);
+    uint32_t h = lv_area_get_height(&grid->bounds);
+    uint32_t col_cnt = 1;
+    while(col_cnt < MAX_CELL_SIDE && (uint64_t)col_cnt * col_cnt * h < (uint64_t)cells_child_cnt * w) col_cnt++;
+    uint32_t row_cnt = LV_MIN((cells_child_cnt + col_cnt - 1) / col_cnt, MAX_CELL_SIDE);
+    grid->cell_w = (w + col_cnt - 1) / col_cnt;
+    grid->cell_h = (h + row_cnt - 1) / row_cnt;
+    grid->col_cnt = col_cnt;
+    grid->row_cnt = row_cnt;
+
+    /*Count the children per cell. The ones covering many cells are checked at every point instead.*/
+    uint32_t cell_cnt = col_cnt * row_cnt;
+    uint32_t max_cell_per_child = LV_MAX(8, cell_cnt / 8);
+    uint32_t item_cnt = 0;
+    uint32_t always_cnt = 0;
+    uint32_t * cell_item_cnt = lv_mem_buf_get(cell_cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(cell_item_cnt);
+    if(cell_item_cnt == NULL) {
+        grid->col_cnt = 0;
+        return;
+    }
+    lv_memset_00(cell_item_cnt, cell_cnt * sizeof(uint32_t));
+    for(i = 0; i < child_cnt; i++) {
+        child_kind_t kind = get_child_area(children[i], &origin, &a);
+        if(kind == CHILD_SKIP) continue;
+
+        lv_area_t range;
+        if(kind == CHILD_ALWAYS || !get_cell_range(grid, &a, &range) ||
+           (uint32_t)lv_area_get_size(&range) > max_cell_per_child) {
+            always_cnt++;
+            continue;
+        }
+
+        lv_coord_t col, row;
+        for(row = range.y1; row <= range.y2; row++) {
+            for(col = range.x1; col <= range.x2; col++) cell_item_cnt[row * col_cnt + col]++;
+        }
+        item_cnt += lv_area_get_size(&range);
+    }
+
+    if(item_cnt > MAX_ITEMS_PER_CHILD * child_cnt) {
+        lv_mem_buf_release(cell_item_cnt);
+        grid->col_cnt = 0;
+        return;
+    }
+
+    uint32_t buf_size = (cell_cnt + 1) * sizeof(uint32_t) + (item_cnt + always_cnt) * sizeof(uint16_t);
+    if(grid->buf_size < buf_size) {
+        void * buf = lv_mem_realloc(grid->buf, buf_size);
+        LV_ASSERT_MALLOC(buf);
+        if(buf == NULL) {
+            lv_mem_buf_release(cell_item_cnt);
+            grid->col_cnt = 0;
+            return;
+        }
+        grid->buf = buf;
+        grid->buf_size = buf_size;
+    }
+    grid->cell_start = grid->buf;
+    grid->items = (uint16_t *)&grid->cell_start[cell_cnt + 1];
+    grid->always = &grid->items[item_cnt];
+    grid->always_cnt = always_cnt;
+
+    /*Start with the end of the cells and put the children backward so the topmost will be the first.
+     *At the end the cells' counters point to their first child.*/
+    uint32_t sum = 0;
+    for(i = 0; i < cell_cnt; i++) {
+        sum += cell_item_cnt[i];
+        grid->cell_start[i] = sum;
+    }
+    grid->cell_start[cell_cnt] = sum;
+    lv_mem_buf_release(cell_item_cnt);
+
+    for(i = 0; i < child_cnt; i++) {
+        child_kind_t kind = get_child_area(children[i], &origin, &a);
+        if(kind == CHILD_SKIP) continue;
+
+        lv_area_t range;
+        if(kind == CHILD_ALWAYS || !get_cell_range(grid, &a, &range) ||
+           (uint32_t)lv_area_get_size(&range) > max_cell_per_child) {
+            always_cnt--;
+            grid->always[always_cnt] = i;
+            continue;
+        }
+
+        lv_coord_t col, row;
+        for(row = range.y1; row <= range.y2; row++) {
+            for(col = range.x1; col <= range.x2; col++) {
+                uint32_t cell = row * col_cnt + col;
+                grid->cell_start[cell]--;
+                grid->items[grid->cell_start[cell]] = i;
+            }
+        }
+    }
+}
+
+/**
+ * Get the top left corner of the scrolled content. The children move together with it.
+ */
+static void get_origin(const lv_obj_t * obj, lv_point_t * origin)
+{
+    origin->x = obj->coords.x1 + obj->spec_attr->scroll.x;
+    origin->y = obj->coords.y1 + obj->spec_attr->scroll.y;
+}
+
+static child_kind_t get_child_area(const lv_obj_t * child, const lv_point_t * origin, lv_area_t * area)
+{
+    if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) return CHILD_SKIP;
+
+    /*Floating children don't scroll, the others can have clickable descendants or a transformed
+     *click area outside of their click area*/
+    if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return CHILD_ALWAYS;
+    if(_lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) return CHILD_ALWAYS;
+
+    /*The children are checked only if the point is on the coordinates,
+     *and the click area contains the coordinates*/
+    lv_obj_get_click_area(child, area);
+    lv_area_move(area, -origin->x, -origin->y);
+    return CHILD_CELLS;
+}
+
+static bool get_cell_range(const _lv_obj_hit_grid_t * grid, const lv_area_t * area, lv_area_t * range)
+{
+    lv_area_t a;
+    if(!_lv_area_intersect(&a, area, &grid->bounds)) return false;
+
+    range->x1 = (a.x1 - grid->bounds.x1) / grid->cell_w;
+    range->y1 = (a.y1 - grid->bounds.y1) / grid->cell_h;
+    range->x2 = (a.x2 - grid->bounds.x1) / grid->cell_w;
+    range->y2 = (a.y2 - grid->bounds.y1) / grid->cell_h;
+    return true;
+}
+
+#endif /*LV_OBJ_HIT_GRID_MIN_CHILD*/
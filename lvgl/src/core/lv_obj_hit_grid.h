@@ -0,0 +1,90 @@
+/**
+ * @file lv_obj_hit_grid.h
+ * Index the children of objects with many children in a uniform grid
+ * to find the candidates under a point without checking every child.
+ */
+
+#ifndef LV_OBJ_HIT_GRID_H
+#define LV_OBJ_HIT_GRID_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_area.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_obj_t;
+
+#if LV_OBJ_HIT_GRID_MIN_CHILD
+
+/**
+ * Iterates over the children which might be under a point, the topmost (last) child first.
+ * The children are returned in the same order as in the children array,
+ * only the ones which surely can't be under the point are skipped.
+ */
+typedef struct {
+    struct _lv_obj_t * obj;
+    const uint16_t * cell;      /**< Children whose click area intersects the cell of the point*/
+    const uint16_t * always;    /**< Children which are checked at every point (floating, transformed, etc)*/
+    uint32_t cell_cnt;
+    uint32_t always_cnt;
+    int32_t next;               /**< Without grid: index of the next child to return*/
+    uint8_t use_grid : 1;
+    uint8_t built : 1;          /**< The grid was (re)built for this query*/
+} _lv_obj_hit_grid_iter_t;
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_OBJ_HIT_GRID_MIN_CHILD
+/**
+ * Prepare iterating over the children of an object which might be under a point.
+ * The grid is (re)built here if the object has enough children and `_lv_obj_child_map_changed()`
+ * was called on the object since the last build.
+ * @param obj       pointer to an object
+ * @param point     the point in the same coordinate system as the children (already transformed)
+ * @param iter      the iterator to initialize
+ */
+void _lv_obj_hit_grid_iter_init(struct _lv_obj_t * obj, const lv_point_t * point, _lv_obj_hit_grid_iter_t * iter);
+
+/**
+ * Get the next candidate child
+ * @param iter      an iterator initialized by `_lv_obj_hit_grid_iter_init()`
+ * @return          the next child or NULL if there are no more candidates
+ */
+struct _lv_obj_t * _lv_obj_hit_grid_iter_next(_lv_obj_hit_grid_iter_t * iter);
+
+#endif /*LV_OBJ_HIT_GRID_MIN_CHILD*/
+
+/**
+ * Free the grid of an object
+ * @param obj       pointer to an object
+ */
+void _lv_obj_hit_grid_free(struct _lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_HIT_GRID_H*/
@@ -16,6 +16,10 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#define SELF_SIZE_VALID     0x01
+#define SELF_SIZE_W_LAYOUT  0x02
+#define SELF_SIZE_H_LAYOUT  0x04
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -26,12 +30,17 @@
 static lv_coord_t calc_content_width(lv_obj_t * obj);
 static lv_coord_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void mark_ancestors_dirty(lv_obj_t * obj);
+static void get_self_size(const lv_obj_t * obj, lv_point_t * size);
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t layout_cnt;
+static lv_obj_layout_stat_t layout_stat;
+static lv_obj_layout_stat_t layout_stat_frame_start;
+static lv_obj_layout_stat_t layout_stat_frame;
 
 /**********************
  *      MACROS
@@ -186,10 +195,13 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     obj->coords.y2 = obj->coords.y1 + h - 1;
     if(lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL) {
         obj->coords.x1 = obj->coords.x2 - w + 1;
+        /*The children are not moved with the left side*/
+        _lv_obj_child_map_changed(obj);
     }
     else {
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
+    _lv_obj_child_map_changed(parent);
 
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_event_send(obj, LV_EVENT_SIZE_CHANGED, &ori);
@@ -288,14 +300,14 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    mark_ancestors_dirty(obj);
+}
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
-    scr->scr_layout_inv = 1;
-
-    /*Make the display refreshing*/
-    lv_disp_t * disp = lv_obj_get_disp(scr);
-    if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+void _lv_obj_mark_pos_as_dirty(lv_obj_t * obj)
+{
+    if(obj->layout_inv) return;
+    obj->layout_pos_inv = 1;
+    mark_ancestors_dirty(obj);
 }
 
 void lv_obj_update_layout(const lv_obj_t * obj)
@@ -309,17 +321,50 @@ void lv_obj_update_layout(const lv_obj_t * obj)
 
     lv_obj_t * scr = lv_obj_get_screen(obj);
 
+    /*The queued style refreshes might invalidate the layout*/
+    lv_obj_refresh_style_pending();
+
     /*Repeat until there where layout invalidations*/
     while(scr->scr_layout_inv) {
         LV_LOG_INFO("Layout update begin");
         scr->scr_layout_inv = 0;
+        layout_stat.pass_cnt++;
         layout_update_core(scr);
         LV_LOG_TRACE("Layout update end");
+        lv_obj_refresh_style_pending();
     }
 
     mutex = false;
 }
 
+void lv_obj_get_layout_stat(lv_obj_layout_stat_t * stat)
+{
+    *stat = layout_stat;
+}
+
+void lv_obj_get_layout_frame_stat(lv_obj_layout_stat_t * stat)
+{
+    *stat = layout_stat_frame;
+}
+
+void lv_obj_reset_layout_stat(void)
+{
+    lv_memset_00(&layout_stat, sizeof(layout_stat));
+    lv_memset_00(&layout_stat_frame_start, sizeof(layout_stat_frame_start));
+    lv_memset_00(&layout_stat_frame, sizeof(layout_stat_frame));
+}
+
+void _lv_obj_layout_stat_next_frame(void)
+{
+    layout_stat_frame.pass_cnt = layout_stat.pass_cnt - layout_stat_frame_start.pass_cnt;
+    layout_stat_frame.visit_cnt = layout_stat.visit_cnt - layout_stat_frame_start.visit_cnt;
+    layout_stat_frame.refr_cnt = layout_stat.refr_cnt - layout_stat_frame_start.refr_cnt;
+    layout_stat_frame.pos_refr_cnt = layout_stat.pos_refr_cnt - layout_stat_frame_start.pos_refr_cnt;
+    layout_stat_frame.self_size_cnt = layout_stat.self_size_cnt - layout_stat_frame_start.self_size_cnt;
+    layout_stat_frame.self_size_hit_cnt = layout_stat.self_size_hit_cnt - layout_stat_frame_start.self_size_hit_cnt;
+    layout_stat_frame_start = layout_stat;
+}
+
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
 {
     layout_cnt++;
@@ -604,20 +649,24 @@ void lv_obj_get_content_coords(const lv_obj_t * obj, lv_area_t * area)
 
 lv_coord_t lv_obj_get_self_width(const lv_obj_t * obj)
 {
-    lv_point_t p = {0, LV_COORD_MIN};
-    lv_event_send((lv_obj_t *)obj, LV_EVENT_GET_SELF_SIZE, &p);
+    lv_point_t p;
+    get_self_size(obj, &p);
     return p.x;
 }
 
 lv_coord_t lv_obj_get_self_height(const lv_obj_t * obj)
 {
-    lv_point_t p = {LV_COORD_MIN, 0};
-    lv_event_send((lv_obj_t *)obj, LV_EVENT_GET_SELF_SIZE, &p);
+    lv_point_t p;
+    get_self_size(obj, &p);
     return p.y;
 }
 
 bool lv_obj_refresh_self_size(lv_obj_t * obj)
 {
+#if LV_OBJ_SELF_SIZE_CACHE
+    obj->self_size_flags = 0;
+#endif
+
     lv_coord_t w_set = lv_obj_get_style_width(obj, LV_PART_MAIN);
     lv_coord_t h_set = lv_obj_get_style_height(obj, LV_PART_MAIN);
     if(w_set != LV_SIZE_CONTENT && h_set != LV_SIZE_CONTENT) return false;
@@ -764,6 +813,7 @@ void lv_obj_move_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     obj->coords.y2 += diff.y;
 
     lv_obj_move_children_by(obj, diff.x, diff.y, false);
+    _lv_obj_child_map_changed(parent);
 
     /*Call the ancestor's event handler to the parent too*/
     if(parent) lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -845,6 +895,17 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
     lv_area_copy(&area_tmp, area);
     if(!lv_obj_area_is_visible(obj, &area_tmp)) return;
 
+#if LV_USE_DISP_OVERLAY
+    /*The top and system layers are rendered into the overlay*/
+    if(disp->driver->overlay_buf) {
+        lv_obj_t * scr = lv_obj_get_screen(obj);
+        if(scr == disp->top_layer || scr == disp->sys_layer) {
+            _lv_inv_overlay_area(disp, &area_tmp);
+            return;
+        }
+    }
+#endif
+
     _lv_inv_area(lv_obj_get_disp(obj),  &area_tmp);
 }
 
@@ -937,6 +998,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, lv_coord_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+    _lv_obj_child_map_changed(lv_obj_get_parent(obj));
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -1130,16 +1192,32 @@ static lv_coord_t calc_content_height(lv_obj_t * obj)
 
 static void layout_update_core(lv_obj_t * obj)
 {
+    layout_stat.visit_cnt++;
+
+    /*Go down only into the branches having something to update.
+     *Clear the flag first as the updates below can mark the ancestors again.*/
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->layout_pos_inv || child->child_layout_inv) layout_update_core(child);
+        }
     }
 
-    if(obj->layout_inv == 0) return;
+    if(obj->layout_inv == 0) {
+        if(obj->layout_pos_inv) {
+            obj->layout_pos_inv = 0;
+            layout_stat.pos_refr_cnt++;
+            lv_obj_refr_pos(obj);
+        }
+        return;
+    }
 
     obj->layout_inv = 0;
+    obj->layout_pos_inv = 0;
+    layout_stat.refr_cnt++;
 
     lv_obj_refr_size(obj);
     lv_obj_refr_pos(obj);
@@ -1153,6 +1231,64 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+/**
+ * Mark the ancestors that they have a child to update, and the screen that it has something to update.
+ * @param obj       pointer to an object whose layout or position is invalid
+ */
+static void mark_ancestors_dirty(lv_obj_t * obj)
+{
+    lv_obj_t * scr = obj;
+    lv_obj_t * parent = obj->parent;
+    while(parent) {
+        parent->child_layout_inv = 1;
+        scr = parent;
+        parent = parent->parent;
+    }
+
+    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
+    scr->scr_layout_inv = 1;
+
+    /*Make the display refreshing*/
+    lv_disp_t * disp = lv_obj_get_disp(scr);
+    if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+}
+
+/**
+ * Get the size of the object's content with `LV_EVENT_GET_SELF_SIZE` or from the cache
+ * @param obj       pointer to an object
+ * @param size      store the self width and height here
+ */
+static void get_self_size(const lv_obj_t * obj, lv_point_t * size)
+{
+#if LV_OBJ_SELF_SIZE_CACHE
+    /*The self size can depend on the size of the object (e.g. wrapped text) and if the layout sets the size*/
+    lv_obj_t * obj_mut = (lv_obj_t *)obj;
+    uint8_t flags = SELF_SIZE_VALID;
+    if(obj->w_layout) flags |= SELF_SIZE_W_LAYOUT;
+    if(obj->h_layout) flags |= SELF_SIZE_H_LAYOUT;
+    lv_coord_t w = lv_area_get_width(&obj->coords);
+    lv_coord_t h = lv_area_get_height(&obj->coords);
+
+    if(obj->self_size_flags == flags && obj->self_size_key.x == w && obj->self_size_key.y == h) {
+        layout_stat.self_size_hit_cnt++;
+        *size = obj->self_size;
+        return;
+    }
+#endif
+
+    layout_stat.self_size_cnt++;
+    size->x = 0;
+    size->y = 0;
+    lv_event_send((lv_obj_t *)obj, LV_EVENT_GET_SELF_SIZE, size);
+
+#if LV_OBJ_SELF_SIZE_CACHE
+    obj_mut->self_size = *size;
+    obj_mut->self_size_key.x = w;
+    obj_mut->self_size_key.y = h;
+    obj_mut->self_size_flags = flags;
+#endif
+}
+
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv)
 {
     int16_t angle = lv_obj_get_style_transform_angle(obj, 0);
@@ -30,6 +30,18 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
+/**
+ * Statistics of the layout updates
+ */
+typedef struct {
+    uint32_t pass_cnt;          /**< Number of layout passes started from a screen*/
+    uint32_t visit_cnt;         /**< Number of objects visited by the layout passes*/
+    uint32_t refr_cnt;          /**< Number of objects whose size and position were recalculated*/
+    uint32_t pos_refr_cnt;      /**< Number of objects whose position only was recalculated*/
+    uint32_t self_size_cnt;     /**< Number of times the self size was measured with `LV_EVENT_GET_SELF_SIZE`*/
+    uint32_t self_size_hit_cnt; /**< Number of self size queries served from the cache (`LV_OBJ_SELF_SIZE_CACHE`)*/
+} lv_obj_layout_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -146,12 +158,40 @@ bool lv_obj_is_layout_positioned(const struct _lv_obj_t * obj);
  */
 void lv_obj_mark_layout_as_dirty(struct _lv_obj_t * obj);
 
+/**
+ * Mark only the position of the object for layout update. Its size and its children's layout are kept.
+ * @param obj      pointer to an object whose position needs to be updated
+ */
+void _lv_obj_mark_pos_as_dirty(struct _lv_obj_t * obj);
+
 /**
  * Update the layout of an object.
  * @param obj      pointer to an object whose children needs to be updated
  */
 void lv_obj_update_layout(const struct _lv_obj_t * obj);
 
+/**
+ * Get the statistics of the layout updates since the last `lv_obj_reset_layout_stat()`
+ * @param stat      pointer to a variable to store the result
+ */
+void lv_obj_get_layout_stat(lv_obj_layout_stat_t * stat);
+
+/**
+ * Get the statistics of the layout updates done between the last two display refreshes
+ * @param stat      pointer to a variable to store the result
+ */
+void lv_obj_get_layout_frame_stat(lv_obj_layout_stat_t * stat);
+
+/**
+ * Reset the statistics of the layout updates
+ */
+void lv_obj_reset_layout_stat(void);
+
+/**
+ * Close the statistics of the current frame. Called by the display refresh.
+ */
+void _lv_obj_layout_stat_next_frame(void);
+
 /**
  * Register a new layout
  * @param cb        the layout update callback
@@ -11,6 +11,8 @@
 #include "lv_indev.h"
 #include "lv_disp.h"
 #include "lv_indev_scroll.h"
+#include "lv_refr.h"
+#include "lv_disp_pan.h"
 
 /*********************
  *      DEFINES
@@ -36,6 +38,12 @@ static void scroll_y_anim(void * obj, int32_t v);
 static void scroll_anim_ready_cb(lv_anim_t * a);
 static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_point_t * scroll_value,
                                   lv_anim_enable_t anim_en);
+#if LV_USE_SCROLL_BLIT
+static bool scroll_blit(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, const lv_area_t * hor_old,
+                        const lv_area_t * ver_old);
+static bool get_blit_area(lv_obj_t * obj, lv_area_t * area, lv_area_t * inner);
+static bool is_covered_by_children(lv_obj_t * parent, uint32_t start_id, const lv_area_t * area);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -415,12 +423,34 @@ lv_res_t _lv_obj_scroll_by_raw(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 
     lv_obj_allocate_spec_attr(obj);
 
+#if LV_USE_SCROLL_BLIT
+    /*The old scrollbars are moved with the content if the pixels are moved*/
+    lv_area_t hor_old;
+    lv_area_t ver_old;
+    bool blit = lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLL_BLIT);
+    if(blit) lv_obj_get_scrollbar_area(obj, &hor_old, &ver_old);
+#endif
+
+#if LV_USE_DISP_PAN
+    /*The display shows the pre-rendered content, nothing to redraw*/
+    bool pan = lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLL_PAN) && _lv_disp_pan_scroll(obj, x, y);
+#endif
+
     obj->spec_attr->scroll.x += x;
     obj->spec_attr->scroll.y += y;
 
     lv_obj_move_children_by(obj, x, y, true);
     lv_res_t res = lv_event_send(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RES_OK) return res;
+
+#if LV_USE_DISP_PAN
+    if(pan) return LV_RES_OK;
+#endif
+
+#if LV_USE_SCROLL_BLIT
+    if(blit && scroll_blit(obj, x, y, &hor_old, &ver_old)) return LV_RES_OK;
+#endif
+
     lv_obj_invalidate(obj);
     return LV_RES_OK;
 }
@@ -798,3 +828,141 @@ static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_p
     scroll_value->y += anim_en == LV_ANIM_OFF ? 0 : y_scroll;
     lv_obj_scroll_by(parent, x_scroll, y_scroll, anim_en);
 }
+
+#if LV_USE_SCROLL_BLIT
+/**
+ * Move the rendered pixels of a scrolled object instead of redrawing it
+ * @param obj       pointer to an object which was scrolled
+ * @param x         the content was moved by this many pixels horizontally
+ * @param y         the content was moved by this many pixels vertically
+ * @param hor_old   the horizontal scrollbar's area before scrolling
+ * @param ver_old   the vertical scrollbar's area before scrolling
+ * @return          true: the pixels will be moved; false: the object needs to be invalidated
+ */
+static bool scroll_blit(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, const lv_area_t * hor_old,
+                        const lv_area_t * ver_old)
+{
+    lv_area_t blit_area;
+    lv_area_t inner;
+    if(!get_blit_area(obj, &blit_area, &inner)) return false;
+    if(!_lv_inv_area_move(lv_obj_get_disp(obj), &blit_area, x, y)) return false;
+
+    /*Redraw the border and the rounded corners around the moved area*/
+    lv_area_t a;
+    lv_area_set(&a, obj->coords.x1, obj->coords.y1, obj->coords.x2, inner.y1 - 1);
+    lv_obj_invalidate_area(obj, &a);
+    lv_area_set(&a, obj->coords.x1, inner.y2 + 1, obj->coords.x2, obj->coords.y2);
+    lv_obj_invalidate_area(obj, &a);
+    lv_area_set(&a, obj->coords.x1, inner.y1, inner.x1 - 1, inner.y2);
+    lv_obj_invalidate_area(obj, &a);
+    lv_area_set(&a, inner.x2 + 1, inner.y1, obj->coords.x2, inner.y2);
+    lv_obj_invalidate_area(obj, &a);
+
+    /*The old scrollbars were moved with the pixels and the new ones need to be drawn*/
+    lv_area_copy(&a, hor_old);
+    lv_area_move(&a, x, y);
+    lv_obj_invalidate_area(obj, &a);
+    lv_area_copy(&a, ver_old);
+    lv_area_move(&a, x, y);
+    lv_obj_invalidate_area(obj, &a);
+    lv_obj_scrollbar_invalidate(obj);
+
+    return true;
+}
+
+/**
+ * Get the area whose pixels can be moved when the object is scrolled
+ * @param obj       pointer to an object
+ * @param area      store the visible part of the area here
+ * @param inner     store the whole area inside the border and the rounded corners here
+ * @return          true: the pixels can be moved; false: something else is drawn on the object
+ */
+static bool get_blit_area(lv_obj_t * obj, lv_area_t * area, lv_area_t * inner)
+{
+    /*Only a plain background is left behind the content*/
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    /*Floating children don't move with the content*/
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING) && !lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) return false;
+    }
+
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(lv_obj_get_screen(obj) != lv_disp_get_scr_act(disp)) return false;
+
+    lv_coord_t pad = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    r = LV_MIN(r, LV_MIN(lv_obj_get_width(obj), lv_obj_get_height(obj)) / 2);
+    pad = LV_MAX(pad, r);
+    lv_area_copy(inner, &obj->coords);
+    lv_area_increase(inner, -pad, -pad);
+    lv_area_copy(area, inner);
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+
+    /*Nothing can be drawn on the area by the parents, the later siblings or the layers*/
+    lv_obj_t * child = obj;
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(child) {
+        if(_lv_obj_get_layer_type(child) != LV_LAYER_TYPE_NONE) return false;
+        if(parent) {
+            /*Keep only the visible part. There is no transformation so the coordinates can be used directly.*/
+            if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) return false;
+            if(!lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+                if(!_lv_area_intersect(area, area, &parent->coords)) return false;
+            }
+            if(lv_obj_get_style_clip_corner(parent, LV_PART_MAIN)) return false;
+
+            lv_area_t hor;
+            lv_area_t ver;
+            lv_area_t tmp;
+            lv_obj_get_scrollbar_area(parent, &hor, &ver);
+            if(_lv_area_intersect(&tmp, &hor, area) || _lv_area_intersect(&tmp, &ver, area)) return false;
+
+            if(is_covered_by_children(parent, lv_obj_get_index(child) + 1, area)) return false;
+        }
+        child = parent;
+        parent = parent ? lv_obj_get_parent(parent) : NULL;
+    }
+
+#if LV_USE_DISP_OVERLAY
+    /*The layers are not drawn on the screen if they are in the overlay*/
+    if(disp->driver->overlay_buf) return true;
+#endif
+    if(is_covered_by_children(lv_disp_get_layer_top(disp), 0, area)) return false;
+    if(is_covered_by_children(lv_disp_get_layer_sys(disp), 0, area)) return false;
+
+    return true;
+}
+
+/**
+ * Tell if a child from `start_id` can draw on an area
+ * @param parent    pointer to an object
+ * @param start_id  check the children from this index
+ * @param area      the area to check
+ * @return          true: a child is drawn on the area
+ */
+static bool is_covered_by_children(lv_obj_t * parent, uint32_t start_id, const lv_area_t * area)
+{
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+    for(i = start_id; i < child_cnt; i++) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        lv_area_t child_area;
+        lv_area_t tmp;
+        lv_area_copy(&child_area, &child->coords);
+        lv_coord_t ext = _lv_obj_get_ext_draw_size(child);
+        lv_area_increase(&child_area, ext, ext);
+        if(_lv_area_intersect(&tmp, &child_area, area)) return true;
+    }
+
+    return false;
+}
+#endif
@@ -15,6 +15,25 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+#if (LV_OBJ_STYLE_CACHE_SIZE & (LV_OBJ_STYLE_CACHE_SIZE - 1)) != 0 || LV_OBJ_STYLE_CACHE_SIZE < 2
+    #error "LV_OBJ_STYLE_CACHE_SIZE must be a power of 2 and at least 2"
+#endif
+#if LV_OBJ_STYLE_CACHE_OBJ_CNT < 1
+    #error "LV_OBJ_STYLE_CACHE_OBJ_CNT must be at least 1"
+#endif
+#define STYLE_CACHE_MASK    (LV_OBJ_STYLE_CACHE_SIZE - 1)
+#endif
+
+/*Max. number of different styles whose change is queued. If there are more, all objects are refreshed.*/
+#define REPORT_QUEUE_SIZE   8
+
+/*The objects count the changes of their resolved style values for the caches built from them*/
+#define OBJ_STYLE_VERSION   (LV_OBJ_STYLE_CACHE_SIZE || LV_OBJ_COVER_CACHE)
+
+/*Max. number of changed styles whose users are not searched yet. If there are more, all caches are dropped.*/
+#define CHANGED_STYLE_MAX   8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -27,6 +46,22 @@ typedef struct {
     lv_style_value_t end_value;
 } trans_t;
 
+/*What to do when the style of an object is refreshed. Refreshes of the same object are merged by OR-ing them.*/
+typedef enum {
+    REFR_LAYOUT         = 0x01,  /*Send `LV_EVENT_STYLE_CHANGED` and update the layout*/
+    REFR_LAYOUT_CONTENT = 0x02,  /*As `REFR_LAYOUT` but only if the object's size depends on the content*/
+    REFR_PARENT_LAYOUT  = 0x04,
+    REFR_LAYER          = 0x08,
+    REFR_EXT_DRAW       = 0x10,
+    REFR_CHILDREN       = 0x20,
+    REFR_POS            = 0x40,  /*Send `LV_EVENT_STYLE_CHANGED` and update only the position*/
+} refr_flag_t;
+
+/*The flags of the queued refresh are stored in the object to merge the refreshes without searching the queue*/
+typedef struct {
+    lv_obj_t * obj;
+} style_refr_t;
+
 typedef enum {
     CACHE_ZERO = 0,
     CACHE_TRUE = 1,
@@ -44,9 +79,20 @@ typedef enum {
  **********************/
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
+static lv_style_value_t resolve_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
+static uint8_t get_refr_flags(lv_part_t part, lv_style_prop_t prop);
+static void refresh_style_core(lv_obj_t * obj, uint8_t flags);
+#if LV_OBJ_STYLE_REFR_DEFER == 0
 static void report_style_change_core(void * style, lv_obj_t * obj);
+#endif
 static void refresh_children_style(lv_obj_t * obj);
+#if LV_OBJ_STYLE_REFR_DEFER
+static void style_refr_queue(lv_obj_t * obj, uint8_t flags);
+static void report_style_change_queue(lv_style_t * style);
+static bool has_queued_style(const lv_obj_t * obj);
+static void report_queued_style_change_core(lv_obj_t * obj);
+#endif
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
@@ -54,11 +100,40 @@ static void trans_anim_ready_cb(lv_anim_t * a);
 static lv_layer_type_t calculate_layer_type(lv_obj_t * obj);
 static void fade_anim_cb(void * obj, int32_t v);
 static void fade_in_anim_ready(lv_anim_t * a);
+#if LV_OBJ_STYLE_CACHE_SIZE
+static _lv_obj_style_cache_t * style_cache_take(lv_obj_t * obj);
+#endif
+static void style_version_inc(lv_obj_t * obj, bool children);
+#if OBJ_STYLE_VERSION
+static void style_change_cb(const lv_style_t * style);
+static void changed_styles_apply(void);
+static void changed_styles_apply_core(lv_obj_t * obj, bool parent_changed);
+#endif
+static void own_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
+static bool own_style_remove_prop(lv_style_t * style, lv_style_prop_t prop);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+static uint32_t style_cache_gen = 1;
+static lv_obj_style_cache_stat_t style_cache_stat;
+#if LV_OBJ_STYLE_CACHE_SIZE
+static _lv_obj_style_cache_t style_cache_pool[LV_OBJ_STYLE_CACHE_OBJ_CNT];
+static uint32_t style_cache_use_cnt;
+#endif
+#if OBJ_STYLE_VERSION
+static const lv_style_t * changed_styles[CHANGED_STYLE_MAX];
+static uint32_t changed_style_cnt;
+#endif
+static bool own_style_write;    /*A local or transition style is modified, its object is invalidated directly*/
+static lv_obj_style_refr_stat_t style_refr_stat;
+#if LV_OBJ_STYLE_REFR_DEFER
+static lv_style_t * report_queue[REPORT_QUEUE_SIZE];
+static uint32_t report_queue_cnt;
+static bool report_all;
+static bool refr_flushing;
+#endif
 
 /**********************
  *      MACROS
@@ -71,6 +146,132 @@ static bool style_refr = true;
 void _lv_obj_style_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_obj_style_trans_ll), sizeof(trans_t));
+    _lv_ll_init(&LV_GC_ROOT(_lv_obj_style_refr_ll), sizeof(style_refr_t));
+#if LV_OBJ_STYLE_REFR_DEFER
+    report_queue_cnt = 0;
+    report_all = false;
+    refr_flushing = false;
+#endif
+#if OBJ_STYLE_VERSION
+    changed_style_cnt = 0;
+    _lv_style_set_change_cb(style_change_cb);
+#endif
+}
+
+void _lv_obj_style_cache_invalidate(void)
+{
+    style_cache_gen++;
+}
+
+void _lv_obj_style_cache_invalidate_obj(lv_obj_t * obj)
+{
+    style_version_inc(obj, true);
+}
+
+uint32_t _lv_obj_style_get_version(const lv_obj_t * obj)
+{
+#if OBJ_STYLE_VERSION
+    if(changed_style_cnt) changed_styles_apply();
+
+    /*Both counters only grow so the sum changes if any of them changes*/
+    return style_cache_gen + obj->style_version;
+#else
+    LV_UNUSED(obj);
+    return style_cache_gen;
+#endif
+}
+
+void _lv_obj_style_cache_release(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    if(obj->style_cache) {
+        obj->style_cache->owner = NULL;
+        obj->style_cache = NULL;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void lv_obj_get_style_cache_stat(lv_obj_style_cache_stat_t * stat)
+{
+    *stat = style_cache_stat;
+}
+
+void lv_obj_reset_style_cache_stat(void)
+{
+    lv_memset_00(&style_cache_stat, sizeof(style_cache_stat));
+}
+
+void lv_obj_refresh_style_pending(void)
+{
+#if LV_OBJ_STYLE_REFR_DEFER
+    /*Refreshing can queue new refreshes, they are handled by the running loop*/
+    if(refr_flushing) return;
+    refr_flushing = true;
+
+    /*Walk the tree once for all reported styles. It queues the refresh of the affected objects.*/
+    if(report_all || report_queue_cnt) {
+        style_refr_stat.walk_cnt++;
+        lv_disp_t * d = lv_disp_get_next(NULL);
+        while(d) {
+            uint32_t i;
+            for(i = 0; i < d->screen_cnt; i++) {
+                report_queued_style_change_core(d->screens[i]);
+            }
+            d = lv_disp_get_next(d);
+        }
+        report_queue_cnt = 0;
+        report_all = false;
+    }
+
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_obj_style_refr_ll);
+    style_refr_t * refr = _lv_ll_get_head(ll);
+    while(refr) {
+        lv_obj_t * obj = refr->obj;
+        uint8_t flags = obj->style_refr_flags;
+        _lv_ll_remove(ll, refr);
+        lv_mem_free(refr);
+
+        obj->style_refr_queued = 0;
+        obj->style_refr_flags = 0;
+        if(flags & REFR_CHILDREN) style_refr_stat.walk_cnt++;
+        refresh_style_core(obj, flags);
+
+        refr = _lv_ll_get_head(ll);
+    }
+
+    refr_flushing = false;
+#endif
+}
+
+void _lv_obj_style_refr_remove(lv_obj_t * obj)
+{
+    if(!obj->style_refr_queued) return;
+
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_obj_style_refr_ll);
+    style_refr_t * refr;
+    _LV_LL_READ_BACK(ll, refr) {
+        if(refr->obj == obj) {
+            _lv_ll_remove(ll, refr);
+            lv_mem_free(refr);
+            break;
+        }
+    }
+    obj->style_refr_queued = 0;
+#if LV_OBJ_STYLE_REFR_DEFER
+    obj->style_refr_flags = 0;
+#endif
+}
+
+void lv_obj_get_style_refr_stat(lv_obj_style_refr_stat_t * stat)
+{
+    *stat = style_refr_stat;
+}
+
+void lv_obj_reset_style_refr_stat(void)
+{
+    lv_memset_00(&style_refr_stat, sizeof(style_refr_stat));
 }
 
 void lv_obj_add_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t selector)
@@ -127,7 +328,9 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
         }
 
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
+            own_style_write = true;
             lv_style_reset(obj->styles[i].style);
+            own_style_write = false;
             lv_mem_free(obj->styles[i].style);
             obj->styles[i].style = NULL;
         }
@@ -152,7 +355,15 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+    /*The caches of the users of a modified style are already dropped by `lv_style_set_...()`*/
+    if(style == NULL) _lv_obj_style_cache_invalidate();
     if(!style_refr) return;
+    style_refr_stat.walk_req_cnt++;
+
+#if LV_OBJ_STYLE_REFR_DEFER
+    report_style_change_queue(style);
+#else
+    style_refr_stat.walk_cnt++;
     lv_disp_t * d = lv_disp_get_next(NULL);
 
     while(d) {
@@ -162,57 +373,36 @@ void lv_obj_report_style_change(lv_style_t * style)
         }
         d = lv_disp_get_next(d);
     }
+#endif
 }
 
 void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The children's inherited values might change too*/
+    style_version_inc(obj, lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT));
     if(!style_refr) return;
 
-    lv_obj_invalidate(obj);
+#if LV_OBJ_SELF_SIZE_CACHE
+    /*E.g. the font or the padding might be changed*/
+    obj->self_size_flags = 0;
+#endif
 
     lv_part_t part = lv_obj_style_get_selector_part(selector);
+    uint8_t flags = get_refr_flags(part, prop);
+    style_refr_stat.refr_cnt++;
+    if(flags & REFR_CHILDREN) style_refr_stat.walk_req_cnt++;
 
-    bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYOUT_REFR);
-    bool is_ext_draw = lv_style_prop_has_flag(prop, LV_STYLE_PROP_EXT_DRAW);
-    bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
-    bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYER_REFR);
-
-    if(is_layout_refr) {
-        if(part == LV_PART_ANY ||
-           part == LV_PART_MAIN ||
-           lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
-           lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
-            lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
-            lv_obj_mark_layout_as_dirty(obj);
-        }
-    }
-    if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
-        lv_obj_t * parent = lv_obj_get_parent(obj);
-        if(parent) lv_obj_mark_layout_as_dirty(parent);
-    }
-
-    /*Cache the layer type*/
-    if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layer_refr) {
-        lv_layer_type_t layer_type = calculate_layer_type(obj);
-        if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
-        else if(layer_type != LV_LAYER_TYPE_NONE) {
-            lv_obj_allocate_spec_attr(obj);
-            obj->spec_attr->layer_type = layer_type;
-        }
-    }
-
-    if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
-        lv_obj_refresh_ext_draw_size(obj);
-    }
+#if LV_OBJ_STYLE_REFR_DEFER
+    /*Invalidate the current area now, the new one is invalidated when the refresh is applied*/
     lv_obj_invalidate(obj);
-
-    if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
-        if(part != LV_PART_SCROLLBAR) {
-            refresh_children_style(obj);
-        }
-    }
+    if(flags) style_refr_queue(obj, flags);
+#else
+    if(flags & REFR_CHILDREN) style_refr_stat.walk_cnt++;
+    lv_obj_invalidate(obj);
+    refresh_style_core(obj, flags);
+#endif
 }
 
 void lv_obj_enable_style_refresh(bool en)
@@ -222,56 +412,60 @@ void lv_obj_enable_style_refresh(bool en)
 
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
-    lv_style_value_t value_act;
-    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
-    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
-    while(obj) {
-        found = get_prop_core(obj, part, prop, &value_act);
-        if(found == LV_STYLE_RES_FOUND) break;
-        if(!inheritable) break;
-
-        /*If not found, check the `MAIN` style first*/
-        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
-            part = LV_PART_MAIN;
-            continue;
-        }
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*While a transition is created the state is changed temporarily and the result is not cached.
+     *Custom properties are not cached either as their ID doesn't fit into the entries.*/
+    if(obj->skip_trans || prop == LV_STYLE_PROP_INV || prop > 0xFF) return resolve_prop(obj, part, prop);
+
+    /*The values inherited from the parents depend on the parents' styles and state too, so changing them
+     *drops the caches of the children as well.*/
+    uint32_t version = _lv_obj_style_get_version(obj);
+    _lv_obj_style_cache_t * cache = obj->style_cache;
+    if(cache == NULL) {
+        cache = style_cache_take((lv_obj_t *)obj);
+        cache->version = version - 1;
+    }
+    cache->last_use = ++style_cache_use_cnt;
 
-        /*Check the parent too.*/
-        obj = lv_obj_get_parent(obj);
+    if(cache->version != version) {
+        lv_memset_00(cache->entries, sizeof(cache->entries));
+        cache->version = version;
+        style_cache_stat.flush_cnt++;
     }
 
-    if(found != LV_STYLE_RES_FOUND) {
-        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
-            const lv_obj_class_t * cls = obj->class_p;
-            while(cls) {
-                if(prop == LV_STYLE_WIDTH) {
-                    if(cls->width_def != 0) break;
-                }
-                else {
-                    if(cls->height_def != 0) break;
-                }
-                cls = cls->base_class;
-            }
+    /*2-way set associative: the recently used entry of a set is kept first*/
+    uint8_t part_id = (uint8_t)(part >> 16);
+    _lv_obj_style_cache_entry_t * e = &cache->entries[((prop + part_id * 7) << 1) & STYLE_CACHE_MASK];
+    if(e[0].prop == prop && e[0].part == part_id && e[0].state == obj->state) {
+        style_cache_stat.hit_cnt++;
+        return e[0].value;
+    }
 
-            if(cls) {
-                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
-            }
-            else {
-                value_act.num = 0;
-            }
-        }
-        else {
-            value_act = lv_style_prop_get_default(prop);
-        }
+    _lv_obj_style_cache_entry_t tmp = e[1];
+    e[1] = e[0];
+    if(tmp.prop == prop && tmp.part == part_id && tmp.state == obj->state) {
+        e[0] = tmp;
+        style_cache_stat.hit_cnt++;
+        return tmp.value;
     }
-    return value_act;
+
+    style_cache_stat.miss_cnt++;
+    lv_style_value_t value = resolve_prop(obj, part, prop);
+    e->value = value;
+    e->prop = (uint8_t)prop;
+    e->part = part_id;
+    e->state = obj->state;
+    return value;
+#else
+    return resolve_prop(obj, part, prop);
+#endif
 }
 
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value,
                                  lv_style_selector_t selector)
 {
     lv_style_t * style = get_local_style(obj, selector);
-    lv_style_set_prop(style, prop, value);
+    own_style_set_prop(style, prop, value);
     lv_obj_refresh_style(obj, selector, prop);
 }
 
@@ -279,7 +473,9 @@ void lv_obj_set_local_style_prop_meta(lv_obj_t * obj, lv_style_prop_t prop, uint
                                       lv_style_selector_t selector)
 {
     lv_style_t * style = get_local_style(obj, selector);
+    own_style_write = true;
     lv_style_set_prop_meta(style, prop, meta);
+    own_style_write = false;
     lv_obj_refresh_style(obj, selector, prop);
 }
 
@@ -314,7 +510,8 @@ bool lv_obj_remove_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_sty
     /*The style is not found*/
     if(i == obj->style_cnt) return false;
 
-    return lv_style_remove_prop(obj->styles[i].style, prop);
+    style_version_inc(obj, lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT));
+    return own_style_remove_prop(obj->styles[i].style, prop);
 }
 
 void _lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t prev_state, lv_state_t new_state,
@@ -336,7 +533,8 @@ void _lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t
     obj->state = new_state;
 
     _lv_obj_style_t * style_trans = get_trans_style(obj, part);
-    lv_style_set_prop(style_trans->style, tr_dsc->prop, v1);   /*Be sure `trans_style` has a valid value*/
+    own_style_set_prop(style_trans->style, tr_dsc->prop, v1);   /*Be sure `trans_style` has a valid value*/
+    style_version_inc(obj, lv_style_prop_has_flag(tr_dsc->prop, LV_STYLE_PROP_INHERIT));
 
     if(tr_dsc->prop == LV_STYLE_RADIUS) {
         if(v1.num == LV_RADIUS_CIRCLE || v2.num == LV_RADIUS_CIRCLE) {
@@ -525,7 +723,9 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     lv_memset_00(&obj->styles[i], sizeof(_lv_obj_style_t));
     obj->styles[i].style = lv_mem_alloc(sizeof(lv_style_t));
+    own_style_write = true;
     lv_style_init(obj->styles[i].style);
+    own_style_write = false;
     obj->styles[i].is_local = 1;
     obj->styles[i].selector = selector;
     return obj->styles[i].style;
@@ -557,13 +757,63 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
 
     lv_memset_00(&obj->styles[0], sizeof(_lv_obj_style_t));
     obj->styles[0].style = lv_mem_alloc(sizeof(lv_style_t));
+    own_style_write = true;
     lv_style_init(obj->styles[0].style);
+    own_style_write = false;
     obj->styles[0].is_trans = 1;
     obj->styles[0].selector = selector;
     return &obj->styles[0];
 }
 
 
+static lv_style_value_t resolve_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_value_t value_act;
+    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
+    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
+    while(obj) {
+        found = get_prop_core(obj, part, prop, &value_act);
+        if(found == LV_STYLE_RES_FOUND) break;
+        if(!inheritable) break;
+
+        /*If not found, check the `MAIN` style first*/
+        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
+            part = LV_PART_MAIN;
+            continue;
+        }
+
+        /*Check the parent too.*/
+        obj = lv_obj_get_parent(obj);
+    }
+
+    if(found != LV_STYLE_RES_FOUND) {
+        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
+            const lv_obj_class_t * cls = obj->class_p;
+            while(cls) {
+                if(prop == LV_STYLE_WIDTH) {
+                    if(cls->width_def != 0) break;
+                }
+                else {
+                    if(cls->height_def != 0) break;
+                }
+                cls = cls->base_class;
+            }
+
+            if(cls) {
+                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
+            }
+            else {
+                value_act.num = 0;
+            }
+        }
+        else {
+            value_act = lv_style_prop_get_default(prop);
+        }
+    }
+    return value_act;
+}
+
+
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
 {
     uint8_t group = 1 << _lv_style_get_prop_group(prop);
@@ -631,6 +881,175 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_sty
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Get what to refresh if a property of a part has changed
+ * @param part      the changed part or `LV_PART_ANY`
+ * @param prop      the changed property or `LV_STYLE_PROP_ANY`
+ * @return          OR-ed `REFR_...` flags
+ */
+static uint8_t get_refr_flags(lv_part_t part, lv_style_prop_t prop)
+{
+    bool is_any = prop == LV_STYLE_PROP_ANY;
+    bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYOUT_REFR);
+    bool is_ext_draw = lv_style_prop_has_flag(prop, LV_STYLE_PROP_EXT_DRAW);
+    bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
+    bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYER_REFR);
+    bool is_main = part == LV_PART_ANY || part == LV_PART_MAIN;
+    bool is_pos = prop == LV_STYLE_X || prop == LV_STYLE_Y || prop == LV_STYLE_ALIGN ||
+                  prop == LV_STYLE_TRANSLATE_X || prop == LV_STYLE_TRANSLATE_Y;
+
+    uint8_t flags = 0;
+    if(is_layout_refr) {
+        if(!is_main) flags |= REFR_LAYOUT_CONTENT;
+        else flags |= is_pos ? REFR_POS : REFR_LAYOUT;
+    }
+    if(is_main && (is_any || is_layout_refr)) flags |= REFR_PARENT_LAYOUT;
+    if(is_main && is_layer_refr) flags |= REFR_LAYER;
+    if(is_any || is_ext_draw) flags |= REFR_EXT_DRAW;
+    if((is_any || (is_inheritable && (is_ext_draw || is_layout_refr))) && part != LV_PART_SCROLLBAR) {
+        flags |= REFR_CHILDREN;
+    }
+
+    return flags;
+}
+
+/**
+ * Update an object after its style has changed
+ * @param obj       pointer to an object
+ * @param flags     OR-ed `REFR_...` flags
+ */
+static void refresh_style_core(lv_obj_t * obj, uint8_t flags)
+{
+    if((flags & REFR_LAYOUT) ||
+       ((flags & REFR_LAYOUT_CONTENT) &&
+        (lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT || lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT))) {
+        lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
+        lv_obj_mark_layout_as_dirty(obj);
+    }
+    else if(flags & REFR_POS) {
+        lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
+        _lv_obj_mark_pos_as_dirty(obj);
+    }
+    if(flags & REFR_PARENT_LAYOUT) {
+        lv_obj_t * parent = lv_obj_get_parent(obj);
+        if(parent) lv_obj_mark_layout_as_dirty(parent);
+    }
+
+    /*Cache the layer type*/
+    if(flags & REFR_LAYER) {
+        lv_layer_type_t layer_type = calculate_layer_type(obj);
+        /*A transformed object can be pressed outside of its area*/
+        if((layer_type == LV_LAYER_TYPE_TRANSFORM) != (_lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM)) {
+            _lv_obj_child_map_changed(lv_obj_get_parent(obj));
+        }
+        if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
+        else if(layer_type != LV_LAYER_TYPE_NONE) {
+            lv_obj_allocate_spec_attr(obj);
+            obj->spec_attr->layer_type = layer_type;
+        }
+    }
+
+    if(flags & REFR_EXT_DRAW) {
+        lv_obj_refresh_ext_draw_size(obj);
+    }
+    lv_obj_invalidate(obj);
+
+    if(flags & REFR_CHILDREN) {
+        refresh_children_style(obj);
+    }
+}
+
+#if LV_OBJ_STYLE_REFR_DEFER
+/**
+ * Queue the refresh of an object or merge it into its already queued refresh
+ * @param obj       pointer to an object
+ * @param flags     OR-ed `REFR_...` flags
+ */
+static void style_refr_queue(lv_obj_t * obj, uint8_t flags)
+{
+    if(obj->style_refr_queued) {
+        obj->style_refr_flags |= flags;
+        style_refr_stat.refr_merged_cnt++;
+        return;
+    }
+
+    style_refr_t * refr = _lv_ll_ins_tail(&LV_GC_ROOT(_lv_obj_style_refr_ll));
+    LV_ASSERT_MALLOC(refr);
+    if(refr == NULL) {
+        refresh_style_core(obj, flags);
+        return;
+    }
+    refr->obj = obj;
+    obj->style_refr_flags = flags;
+    obj->style_refr_queued = 1;
+
+    /*The refresh is applied before the next redraw, make sure there will be one*/
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(disp && disp->refr_timer) lv_timer_resume(disp->refr_timer);
+}
+
+/**
+ * Remember that the objects having a style need to be refreshed
+ * @param style     pointer to a style or NULL to refresh all objects
+ */
+static void report_style_change_queue(lv_style_t * style)
+{
+    if(report_all) return;
+    if(style == NULL || report_queue_cnt >= REPORT_QUEUE_SIZE) {
+        report_all = true;
+    }
+    else {
+        uint32_t i;
+        for(i = 0; i < report_queue_cnt; i++) {
+            if(report_queue[i] == style) return;
+        }
+        report_queue[report_queue_cnt] = style;
+        report_queue_cnt++;
+    }
+
+    lv_disp_t * d = lv_disp_get_next(NULL);
+    while(d) {
+        if(d->refr_timer) lv_timer_resume(d->refr_timer);
+        d = lv_disp_get_next(d);
+    }
+}
+
+/**
+ * Check if an object has any of the styles whose change is queued
+ * @param obj       pointer to an object
+ * @return          true: the object needs to be refreshed
+ */
+static bool has_queued_style(const lv_obj_t * obj)
+{
+    if(report_all) return obj->style_cnt > 0;
+
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        uint32_t j;
+        for(j = 0; j < report_queue_cnt; j++) {
+            if(obj->styles[i].style == report_queue[j]) return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Refresh the objects having any of the queued styles. (Called recursively)
+ * @param obj pointer to an object
+ */
+static void report_queued_style_change_core(lv_obj_t * obj)
+{
+    if(has_queued_style(obj)) lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        report_queued_style_change_core(obj->spec_attr->children[i]);
+    }
+}
+#endif /*LV_OBJ_STYLE_REFR_DEFER*/
+
+#if LV_OBJ_STYLE_REFR_DEFER == 0
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -651,6 +1070,7 @@ static void report_style_change_core(void * style, lv_obj_t * obj)
         report_style_change_core(style, obj->spec_attr->children[i]);
     }
 }
+#endif
 
 /**
  * Recursively refresh the style of the children. Go deeper until a not NULL style is found
@@ -663,6 +1083,9 @@ static void refresh_children_style(lv_obj_t * obj)
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
+#if LV_OBJ_SELF_SIZE_CACHE
+        child->self_size_flags = 0;
+#endif
         lv_obj_invalidate(child);
         lv_event_send(child, LV_EVENT_STYLE_CHANGED, NULL);
         lv_obj_invalidate(child);
@@ -698,9 +1121,10 @@ static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, tran
             uint32_t i;
             for(i = 0; i < obj->style_cnt; i++) {
                 if(obj->styles[i].is_trans && (part == LV_PART_ANY || obj->styles[i].selector == part)) {
-                    lv_style_remove_prop(obj->styles[i].style, tr->prop);
+                    own_style_remove_prop(obj->styles[i].style, tr->prop);
                 }
             }
+            style_version_inc(obj, lv_style_prop_has_flag(tr->prop, LV_STYLE_PROP_INHERIT));
 
             /*Free the transition descriptor too*/
             lv_anim_del(tr, NULL);
@@ -769,7 +1193,7 @@ static void trans_anim_cb(void * _tr, int32_t v)
                 refr = false;
             }
         }
-        lv_style_set_prop(obj->styles[i].style, tr->prop, value_final);
+        own_style_set_prop(obj->styles[i].style, tr->prop, value_final);
         if(refr) lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
         break;
 
@@ -794,7 +1218,8 @@ static void trans_anim_start_cb(lv_anim_t * a)
     tr->prop = prop_tmp;
 
     _lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
-    lv_style_set_prop(style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
+    own_style_set_prop(style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
+    style_version_inc(tr->obj, lv_style_prop_has_flag(tr->prop, LV_STYLE_PROP_INHERIT));
 
 }
 
@@ -824,7 +1249,8 @@ static void trans_anim_ready_cb(lv_anim_t * a)
                 lv_mem_free(tr);
 
                 _lv_obj_style_t * obj_style = &obj->styles[i];
-                lv_style_remove_prop(obj_style->style, prop);
+                own_style_remove_prop(obj_style->style, prop);
+                style_version_inc(obj, lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT));
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, obj_style->style, obj_style->selector);
@@ -859,3 +1285,157 @@ static void fade_in_anim_ready(lv_anim_t * a)
 }
 
 
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+/**
+ * Get a style cache for an object from the pool.
+ * If all of them are used the one read least recently is taken from its object.
+ * @param obj       pointer to an object without cache
+ * @return          the cache of the object, its entries need to be cleared
+ */
+static _lv_obj_style_cache_t * style_cache_take(lv_obj_t * obj)
+{
+    _lv_obj_style_cache_t * cache = &style_cache_pool[0];
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_STYLE_CACHE_OBJ_CNT; i++) {
+        _lv_obj_style_cache_t * c = &style_cache_pool[i];
+        if(c->owner == NULL) {
+            cache = c;
+            break;
+        }
+        /*Compare the age to handle the overflow of the counter*/
+        if(style_cache_use_cnt - c->last_use > style_cache_use_cnt - cache->last_use) cache = c;
+    }
+
+    if(cache->owner) {
+        cache->owner->style_cache = NULL;
+        style_cache_stat.evict_cnt++;
+    }
+
+    cache->owner = obj;
+    obj->style_cache = cache;
+    return cache;
+}
+#endif
+
+/**
+ * Increment the style version of an object to drop the caches built from its style values
+ * @param obj       pointer to an object
+ * @param children  true: increment the version of the children too (e.g. an inherited value has changed)
+ */
+static void style_version_inc(lv_obj_t * obj, bool children)
+{
+#if OBJ_STYLE_VERSION
+    obj->style_version++;
+    if(!children) return;
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        style_version_inc(obj->spec_attr->children[i], true);
+    }
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(children);
+#endif
+}
+
+#if OBJ_STYLE_VERSION
+/**
+ * Called when a style is initialized, reset or modified.
+ * Only remember the style, its users are searched once before the next style read.
+ * @param style     pointer to the changed style
+ */
+static void style_change_cb(const lv_style_t * style)
+{
+    if(own_style_write) return;
+
+    uint32_t i;
+    for(i = 0; i < changed_style_cnt; i++) {
+        if(changed_styles[i] == style) return;
+    }
+
+    if(changed_style_cnt >= CHANGED_STYLE_MAX) {
+        /*Too many styles, e.g. a theme is initialized. Drop all caches instead.*/
+        _lv_obj_style_cache_invalidate();
+        changed_style_cnt = 0;
+        return;
+    }
+
+    changed_styles[changed_style_cnt] = style;
+    changed_style_cnt++;
+}
+
+/**
+ * Increment the style version of the objects using the changed styles and of their children
+ */
+static void changed_styles_apply(void)
+{
+    lv_disp_t * d = lv_disp_get_next(NULL);
+    while(d) {
+        uint32_t i;
+        for(i = 0; i < d->screen_cnt; i++) {
+            changed_styles_apply_core(d->screens[i], false);
+        }
+        d = lv_disp_get_next(d);
+    }
+
+    changed_style_cnt = 0;
+}
+
+/**
+ * Increment the style version of an object if it uses a changed style. (Called recursively)
+ * @param obj               pointer to an object
+ * @param parent_changed    true: a parent uses a changed style
+ */
+static void changed_styles_apply_core(lv_obj_t * obj, bool parent_changed)
+{
+    bool changed = parent_changed;
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt && !changed; i++) {
+        uint32_t j;
+        for(j = 0; j < changed_style_cnt; j++) {
+            if(obj->styles[i].style == changed_styles[j]) {
+                changed = true;
+                break;
+            }
+        }
+    }
+
+    if(changed) obj->style_version++;
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        changed_styles_apply_core(obj->spec_attr->children[i], changed);
+    }
+}
+#endif
+
+/**
+ * Set a property in the local or transition style of an object.
+ * The style has no other users, so the caller increments the style version of the object.
+ * @param style     pointer to a local or transition style
+ * @param prop      the property to set
+ * @param value     the new value
+ */
+static void own_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
+{
+    own_style_write = true;
+    lv_style_set_prop(style, prop, value);
+    own_style_write = false;
+}
+
+/**
+ * Remove a property from the local or transition style of an object.
+ * The style has no other users, so the caller increments the style version of the object.
+ * @param style     pointer to a local or transition style
+ * @param prop      the property to remove
+ * @return          true: the property was found and removed
+ */
+static bool own_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
+{
+    own_style_write = true;
+    bool res = lv_style_remove_prop(style, prop);
+    own_style_write = false;
+    return res;
+}
@@ -54,6 +54,47 @@ typedef struct {
 #endif
 } _lv_obj_style_transition_dsc_t;
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+typedef struct {
+    lv_style_value_t value;
+    uint8_t prop;           /*Only the built-in properties are cached. 0: empty entry*/
+    uint8_t part;           /*The part shifted to the lowest byte*/
+    lv_state_t state;       /*The object's state when the value was resolved*/
+} _lv_obj_style_cache_entry_t;
+
+/**
+ * Resolved style values of an object.
+ * Valid only while the style version of the object (`_lv_obj_style_get_version()`) doesn't change.
+ * There are `LV_OBJ_STYLE_CACHE_OBJ_CNT` of them, the least recently used one is taken from its object.
+ */
+typedef struct {
+    struct _lv_obj_t * owner;   /*The object using the cache, NULL: free*/
+    uint32_t version;
+    uint32_t last_use;
+    _lv_obj_style_cache_entry_t entries[LV_OBJ_STYLE_CACHE_SIZE];
+} _lv_obj_style_cache_t;
+#endif
+
+/**
+ * Statistics of the per-object style cache (`LV_OBJ_STYLE_CACHE_SIZE`)
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of style reads served from the cache*/
+    uint32_t miss_cnt;      /**< Number of style reads resolved from the styles*/
+    uint32_t flush_cnt;     /**< Number of times an object's cache was dropped because something has changed*/
+    uint32_t evict_cnt;     /**< Number of times a cache was taken from the least recently used object*/
+} lv_obj_style_cache_stat_t;
+
+/**
+ * Statistics of the deferred style refresh (`LV_OBJ_STYLE_REFR_DEFER`)
+ */
+typedef struct {
+    uint32_t refr_cnt;          /**< Number of style refreshes requested on objects*/
+    uint32_t refr_merged_cnt;   /**< Number of refreshes merged into an already queued refresh of the same object*/
+    uint32_t walk_req_cnt;      /**< Number of object tree walks which would have been done without deferring*/
+    uint32_t walk_cnt;          /**< Number of object tree walks done*/
+} lv_obj_style_refr_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -64,6 +105,69 @@ typedef struct {
  */
 void _lv_obj_style_init(void);
 
+/**
+ * Drop the resolved style values cached in all objects.
+ * Called when it's not known which objects are affected by a change.
+ */
+void _lv_obj_style_cache_invalidate(void);
+
+/**
+ * Drop the resolved style values cached in an object and in its children.
+ * Called when something changes which affects the style values but not the styles themselves,
+ * e.g. the state or the parent of an object.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_cache_invalidate_obj(struct _lv_obj_t * obj);
+
+/**
+ * Get a number which changes whenever a resolved style value of an object might change.
+ * Caches built from style values can compare it to see if they are still valid.
+ * @param obj       pointer to an object
+ * @return          the current style version of the object
+ */
+uint32_t _lv_obj_style_get_version(const struct _lv_obj_t * obj);
+
+/**
+ * Give back the style cache of an object to the pool. Called when the object is deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_cache_release(struct _lv_obj_t * obj);
+
+/**
+ * Get the statistics of the per-object style cache
+ * @param stat      pointer to a variable to store the result
+ */
+void lv_obj_get_style_cache_stat(lv_obj_style_cache_stat_t * stat);
+
+/**
+ * Reset the statistics of the per-object style cache
+ */
+void lv_obj_reset_style_cache_stat(void);
+
+/**
+ * Apply the queued style refreshes. Called before the layout update and the redraw,
+ * so it's required only to get e.g. the sizes depending on the new styles right away.
+ * Does nothing if `LV_OBJ_STYLE_REFR_DEFER` is disabled.
+ */
+void lv_obj_refresh_style_pending(void);
+
+/**
+ * Drop the queued style refreshes of an object. Called when the object is deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_refr_remove(struct _lv_obj_t * obj);
+
+/**
+ * Get the statistics of the deferred style refresh
+ * @param stat      pointer to a variable to store the result
+ */
+void lv_obj_get_style_refr_stat(lv_obj_style_refr_stat_t * stat);
+
+/**
+ * Reset the statistics of the deferred style refresh
+ */
+void lv_obj_reset_style_refr_stat(void);
+
 /**
  * Add a style to an object.
  * @param obj       pointer to an object
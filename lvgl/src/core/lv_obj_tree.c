@@ -10,6 +10,9 @@
 
 #include "lv_obj.h"
 #include "lv_indev.h"
+#include "lv_indev_multi_touch.h"
+#include "lv_disp_pan.h"
+#include "lv_disp_fade.h"
 #include "../misc/lv_anim.h"
 #include "../misc/lv_gc.h"
 #include "../misc/lv_async.h"
@@ -171,6 +174,11 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     parent->spec_attr->children[lv_obj_get_child_cnt(parent) - 1] = obj;
 
     obj->parent = parent;
+    _lv_obj_child_map_changed(old_parent);
+    _lv_obj_child_map_changed(parent);
+
+    /*The inherited style properties might be different with the new parent*/
+    _lv_obj_style_cache_invalidate_obj(obj);
 
     /*Notify the original parent because one of its children is lost*/
     lv_obj_readjust_scroll(old_parent, LV_ANIM_OFF);
@@ -218,6 +226,7 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+    _lv_obj_child_map_changed(parent);
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -238,6 +247,8 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
 
     parent->spec_attr->children[index1] = obj2;
     parent2->spec_attr->children[index2] = obj1;
+    _lv_obj_child_map_changed(parent);
+    _lv_obj_child_map_changed(parent2);
 
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_event_send(parent, LV_EVENT_CHILD_CREATED, obj2);
@@ -343,6 +354,17 @@ void lv_obj_tree_walk(lv_obj_t * start_obj, lv_obj_tree_walk_cb_t cb, void * use
     walk_core(start_obj, cb, user_data);
 }
 
+void _lv_obj_child_map_changed(lv_obj_t * obj)
+{
+    if(obj == NULL || obj->spec_attr == NULL) return;
+    obj->spec_attr->child_map_ver++;
+}
+
+uint32_t _lv_obj_get_child_map_ver(const lv_obj_t * obj)
+{
+    return obj->spec_attr ? obj->spec_attr->child_map_ver : 0;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -378,6 +400,10 @@ static void obj_del_core(lv_obj_t * obj)
         if(indev->proc.types.pointer.last_pressed == obj) {
             indev->proc.types.pointer.last_pressed = NULL;
         }
+#if LV_INDEV_MULTI_TOUCH_MAX
+        /*Stop sending the two finger gesture to the object*/
+        _lv_indev_multi_touch_reset(indev, obj);
+#endif
 
         if(indev->group == group && obj == lv_indev_get_obj_act()) {
             lv_indev_reset(indev, obj);
@@ -385,6 +411,15 @@ static void obj_del_core(lv_obj_t * obj)
         indev = lv_indev_get_next(indev);
     }
 
+#if LV_USE_DISP_PAN
+    /*Render the display normally again if the panned object is deleted*/
+    _lv_disp_pan_reset(obj);
+#endif
+#if LV_USE_DISP_FADE
+    /*Render the display normally again if the fading screen is deleted*/
+    _lv_disp_fade_reset(obj);
+#endif
+
     /*All children deleted. Now clean up the object specific data*/
     _lv_obj_destruct(obj);
 
@@ -412,6 +447,7 @@ static void obj_del_core(lv_obj_t * obj)
             obj->parent->spec_attr->children[i] = obj->parent->spec_attr->children[i + 1];
         }
         obj->parent->spec_attr->child_cnt--;
+        _lv_obj_child_map_changed(obj->parent);
         obj->parent->spec_attr->children = lv_mem_realloc(obj->parent->spec_attr->children,
                                                           obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
     }
@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
 
 /*********************
@@ -160,6 +161,22 @@ uint32_t lv_obj_get_index(const struct _lv_obj_t * obj);
  */
 void lv_obj_tree_walk(struct _lv_obj_t * start_obj, lv_obj_tree_walk_cb_t cb, void * user_data);
 
+/**
+ * Tell that the children of an object were added, removed, reordered, moved relative to the object or resized,
+ * or their hidden, floating, overflow or transformation settings have changed.
+ * Scrolling the object or moving it together with its children doesn't count.
+ * The indices built on the children's positions (hit-test grid, gridnav) check it to know when to update.
+ * @param obj       pointer to an object, can be NULL
+ */
+void _lv_obj_child_map_changed(struct _lv_obj_t * obj);
+
+/**
+ * Get a number which changes on every `_lv_obj_child_map_changed()` call on the object
+ * @param obj       pointer to an object
+ * @return          the version of the children's placement
+ */
+uint32_t _lv_obj_get_child_map_ver(const struct _lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
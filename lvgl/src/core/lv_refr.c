@@ -9,13 +9,19 @@
 #include <stddef.h>
 #include "lv_refr.h"
 #include "lv_disp.h"
+#include "lv_indev_multi_touch.h"
+#include "lv_disp_pan.h"
+#include "lv_disp_fade.h"
 #include "../hal/lv_hal_tick.h"
 #include "../hal/lv_hal_disp.h"
 #include "../misc/lv_timer.h"
 #include "../misc/lv_mem.h"
+#include "../misc/lv_mem_profiler.h"
+#include "../misc/lv_latency_trace.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
 #include "../draw/lv_draw.h"
+#include "../draw/sw/lv_draw_sw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
 
@@ -52,10 +58,29 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+#if LV_USE_SCROLL_BLIT
+static void refr_sync_and_move(void);
+static void refr_move_area(lv_draw_ctx_t * draw_ctx, lv_color_t * dest_buf, lv_color_t * src_buf, lv_coord_t stride);
+#endif
+#if LV_USE_DISP_OVERLAY
+static void refr_overlay(void);
+static void overlay_copy(lv_disp_drv_t * drv, const uint8_t * buf, const lv_area_t * area);
+static bool overlay_get_content_area(lv_disp_t * disp, lv_area_t * area);
+static void overlay_join_children(lv_obj_t * parent, lv_area_t * area, bool * found);
+#endif
+#if LV_USE_DISP_BEAM
+static bool beam_is_active(lv_disp_t * disp);
+static void beam_sort_areas(void);
+static void refr_area_beam(lv_draw_ctx_t * draw_ctx, const lv_area_t * area_p);
+static uint32_t beam_wait(lv_coord_t y2);
+static void beam_check(const lv_area_t * area_p, uint32_t frame_start);
+#endif
 static void refr_invalid_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
+static void refr_disp_bg(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
+static lv_cover_res_t cover_check(lv_obj_t * obj, const lv_area_t * area_p);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
@@ -216,6 +241,9 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+#if LV_USE_SCROLL_BLIT
+        disp->blit_pending = 0;
+#endif
         return;
     }
 
@@ -231,6 +259,8 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     suc = _lv_area_intersect(&com_area, area_p, &scr_area);
     if(suc == false)  return; /*Out of the screen*/
 
+    LV_LATENCY_TRACE_POINT(LV_LATENCY_TRACE_INVALIDATE);
+
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->driver->full_refresh) {
         disp->inv_areas[0] = scr_area;
@@ -259,6 +289,187 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
 }
 
+#if LV_USE_DISP_OVERLAY
+/**
+ * Invalidate an area of the overlay to render the top and system layers there again
+ * @param disp      pointer to a display (NULL: the default display)
+ * @param area_p    the area to redraw (NULL: delete the invalidated areas)
+ */
+void _lv_inv_overlay_area(lv_disp_t * disp, const lv_area_t * area_p)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return;
+    if(!lv_disp_is_invalidation_enabled(disp)) return;
+
+    if(disp->rendering_in_progress) {
+        LV_LOG_ERROR("detected modifying dirty areas in render");
+        return;
+    }
+
+    if(area_p == NULL) {
+        disp->overlay_inv_p = 0;
+        return;
+    }
+
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+
+    lv_area_t com_area;
+    if(!_lv_area_intersect(&com_area, area_p, &scr_area)) return;
+
+    /*Save only if this area is not in one of the saved areas*/
+    uint16_t i;
+    for(i = 0; i < disp->overlay_inv_p; i++) {
+        if(_lv_area_is_in(&com_area, &disp->overlay_inv_areas[i], 0)) return;
+    }
+
+    if(disp->overlay_inv_p < LV_INV_BUF_SIZE) {
+        lv_area_copy(&disp->overlay_inv_areas[disp->overlay_inv_p], &com_area);
+    }
+    else {   /*If no place for the area add the screen*/
+        disp->overlay_inv_p = 0;
+        lv_area_copy(&disp->overlay_inv_areas[disp->overlay_inv_p], &scr_area);
+    }
+    disp->overlay_inv_p++;
+    if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+}
+#endif
+
+#if LV_USE_SCROLL_BLIT
+/**
+ * Move the rendered pixels of an area instead of redrawing it, e.g. when its content is scrolled.
+ * The pixels are moved before the next refresh and the exposed part of the area is invalidated.
+ * @param disp      pointer to a display (NULL: the default display)
+ * @param area_p    the visible area whose content moves, nothing else can be drawn on it
+ * @param x_ofs     move the content by this many pixels horizontally
+ * @param y_ofs     move the content by this many pixels vertically
+ * @return          true: the pixels will be moved; false: it's not possible, invalidate the area instead
+ */
+bool _lv_inv_area_move(lv_disp_t * disp, const lv_area_t * area_p, lv_coord_t x_ofs, lv_coord_t y_ofs)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return false;
+    if(!lv_disp_is_invalidation_enabled(disp)) return true;
+    if(disp->rendering_in_progress) return false;
+
+    /*The buffer has to keep the last frame*/
+    lv_disp_drv_t * drv = disp->driver;
+    if(!drv->direct_mode || drv->full_refresh || drv->rotated != LV_DISP_ROT_NONE) return false;
+    if(drv->draw_ctx == NULL || drv->draw_ctx->buffer_copy == NULL) return false;
+#if LV_COLOR_SCREEN_TRANSP
+    if(drv->screen_transp) return false;
+#endif
+
+    /*During a screen load animation both screens are drawn*/
+    if(disp->prev_scr) return false;
+
+    lv_area_t area;
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    if(!_lv_area_intersect(&area, area_p, &scr_area)) return true;
+
+    /*Only one area can be moved in a frame, but it can be scrolled more times*/
+    lv_point_t ofs = {x_ofs, y_ofs};
+    if(disp->blit_pending) {
+        if(!_lv_area_is_equal(&area, &disp->blit_area)) return false;
+        ofs.x += disp->blit_ofs.x;
+        ofs.y += disp->blit_ofs.y;
+    }
+
+    /*The invalidated areas were drawn from the old state, their moved copies are invalid too.
+     *It also moves the exposed parts of the earlier scrolls in this frame.*/
+    uint16_t inv_p = disp->inv_p;
+    uint16_t i;
+    for(i = 0; i < inv_p; i++) {
+        lv_area_t moved;
+        if(!_lv_area_intersect(&moved, &disp->inv_areas[i], &area)) continue;
+        lv_area_move(&moved, x_ofs, y_ofs);
+        if(_lv_area_intersect(&moved, &moved, &area)) _lv_inv_area(disp, &moved);
+    }
+
+    /*Nothing remains from the old pixels*/
+    if(LV_ABS(ofs.x) >= lv_area_get_width(&area) || LV_ABS(ofs.y) >= lv_area_get_height(&area)) {
+        disp->blit_pending = 0;
+        _lv_inv_area(disp, &area);
+        return true;
+    }
+
+    disp->blit_area = area;
+    disp->blit_ofs = ofs;
+    disp->blit_pending = 1;
+
+    /*Invalidate the exposed parts*/
+    lv_area_t exposed = area;
+    if(x_ofs > 0) exposed.x2 = area.x1 + x_ofs - 1;
+    else if(x_ofs < 0) exposed.x1 = area.x2 + x_ofs + 1;
+    if(x_ofs != 0) _lv_inv_area(disp, &exposed);
+
+    exposed = area;
+    if(y_ofs > 0) exposed.y2 = area.y1 + y_ofs - 1;
+    else if(y_ofs < 0) exposed.y1 = area.y2 + y_ofs + 1;
+    if(y_ofs != 0) _lv_inv_area(disp, &exposed);
+
+    return true;
+}
+#endif
+
+#if LV_USE_DISP_PAN || LV_USE_DISP_FADE
+/**
+ * Render a screen with the top and system layers into a buffer without flushing it
+ * @param disp      pointer to a display
+ * @param scr       the screen to render
+ * @param buf       the buffer to render into
+ * @param buf_area  the area of the buffer in display coordinates, it can be larger than the display
+ * @param overlay   true: render the top and system layers even if they are in the overlay
+ */
+void _lv_refr_scr_to_buf(lv_disp_t * disp, lv_obj_t * scr, lv_color_t * buf, const lv_area_t * buf_area,
+                         bool overlay)
+{
+    LV_UNUSED(overlay);
+
+    lv_disp_t * disp_refr_ori = disp_refr;
+    disp_refr = disp;
+
+    lv_draw_ctx_t * draw_ctx = disp->driver->draw_ctx;
+    void * buf_ori = draw_ctx->buf;
+    const lv_area_t * buf_area_ori = draw_ctx->buf_area;
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+
+    lv_area_t disp_area;
+    lv_area_set(&disp_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    draw_ctx->buf = buf;
+    draw_ctx->buf_area = buf_area;
+    draw_ctx->clip_area = &disp_area;
+
+    disp->rendering_in_progress = true;
+    _lv_mem_scratch_begin();
+
+    lv_obj_t * top_obj = lv_refr_get_top_obj(&disp_area, scr);
+    if(top_obj == NULL) {
+        refr_disp_bg(draw_ctx);
+        top_obj = scr;
+    }
+    refr_obj_and_children(draw_ctx, top_obj);
+#if LV_USE_DISP_OVERLAY
+    if(disp->driver->overlay_buf == NULL || overlay)
+#endif
+    {
+        refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp));
+        refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp));
+    }
+
+    if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+
+    _lv_mem_scratch_end();
+    disp->rendering_in_progress = false;
+
+    draw_ctx->buf = buf_ori;
+    draw_ctx->buf_area = buf_area_ori;
+    draw_ctx->clip_area = clip_area_ori;
+    disp_refr = disp_refr_ori;
+}
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -287,6 +498,11 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 {
     REFR_TRACE("begin");
 
+#if LV_USE_MEM_PROFILER
+    _lv_mem_profiler_frame();
+#endif
+    _lv_obj_layout_stat_next_frame();
+
     uint32_t start = lv_tick_get();
     volatile uint32_t elaps = 0;
 
@@ -304,6 +520,11 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         disp_refr = lv_disp_get_default();
     }
 
+#if LV_INDEV_MULTI_TOUCH_MAX
+    /*Send the two finger gestures once in a frame so the changes are drawn in this refresh*/
+    _lv_indev_multi_touch_flush(disp_refr);
+#endif
+
     /*Refresh the screen's layout if required*/
     lv_obj_update_layout(disp_refr->act_scr);
     if(disp_refr->prev_scr) lv_obj_update_layout(disp_refr->prev_scr);
@@ -319,8 +540,33 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+#if LV_USE_DISP_FADE
+    /*The display fades the pre-rendered screens. If anything has changed, continue in software.*/
+    if(_lv_disp_fade_refr(disp_refr)) {
+        REFR_TRACE("fading");
+        return;
+    }
+#endif
+
+#if LV_USE_DISP_OVERLAY
+    /*The overlay is independent of the screens, it's updated even while panning*/
+    refr_overlay();
+#endif
+
+#if LV_USE_DISP_PAN
+    /*The display shows the pre-rendered screens, keep the invalid areas for later*/
+    if(_lv_disp_pan_refr(disp_refr)) {
+        REFR_TRACE("panning");
+        return;
+    }
+#endif
+
     lv_refr_join_area();
 
+#if LV_USE_SCROLL_BLIT
+    refr_sync_and_move();
+#endif
+
     refr_invalid_areas();
 
 
@@ -344,6 +590,13 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         if(disp_refr->driver->monitor_cb) {
             disp_refr->driver->monitor_cb(disp_refr->driver, elaps, px_num);
         }
+
+#if LV_USE_DISP_PAN
+        _lv_disp_pan_release(disp_refr);
+#endif
+#if LV_USE_DISP_FADE
+        _lv_disp_fade_release(disp_refr);
+#endif
     }
 
     lv_mem_buf_free_all();
@@ -433,11 +686,23 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         uint32_t used_size = mon.total_size - mon.free_size;;
         uint32_t used_kb = used_size / 1024;
         uint32_t used_kb_tenth = (used_size - (used_kb * 1024)) / 102;
+#if LV_MEM_EXT
+        lv_mem_monitor_t mon_ext;
+        lv_mem_monitor_ext(&mon_ext);
+        uint32_t ext_used_kb = (mon_ext.total_size - mon_ext.free_size) / 1024;
+        lv_label_set_text_fmt(mem_label,
+                              "%"LV_PRIu32 ".%"LV_PRIu32 " kB used (%d %%)\n"
+                              "%d%% frag.\n"
+                              "%"LV_PRIu32 " kB bulk (%d %%)",
+                              used_kb, used_kb_tenth, mon.used_pct,
+                              mon.frag_pct, ext_used_kb, mon_ext.used_pct);
+#else
         lv_label_set_text_fmt(mem_label,
                               "%"LV_PRIu32 ".%"LV_PRIu32 " kB used (%d %%)\n"
                               "%d%% frag.",
                               used_kb, used_kb_tenth, mon.used_pct,
                               mon.frag_pct);
+#endif
     }
 #endif
 
@@ -511,6 +776,11 @@ static void refr_invalid_areas(void)
 
     if(disp_refr->inv_p == 0) return;
 
+#if LV_USE_DISP_BEAM
+    /*Follow the scanning of the display from top to bottom*/
+    if(beam_is_active(disp_refr)) beam_sort_areas();
+#endif
+
     /*Find the last area which will be drawn*/
     int32_t i;
     int32_t last_i = 0;
@@ -545,6 +815,253 @@ static void refr_invalid_areas(void)
     disp_refr->rendering_in_progress = false;
 }
 
+#if LV_USE_SCROLL_BLIT
+/**
+ * Prepare the buffer of direct mode before drawing the invalidated areas:
+ * bring the changes of the last frame from the other buffer and move the pixels of the scrolled area.
+ */
+static void refr_sync_and_move(void)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+    if(!drv->direct_mode || drv->full_refresh) {
+        disp_refr->blit_pending = 0;
+        disp_refr->sync_p = 0;
+        return;
+    }
+
+    if(disp_refr->inv_p == 0) return;
+
+    lv_draw_ctx_t * draw_ctx = drv->draw_ctx;
+    lv_coord_t stride = lv_disp_get_hor_res(disp_refr);
+    lv_color_t * buf_act = draw_buf->buf_act;
+    lv_color_t * buf_prev = NULL;
+    if(draw_buf->buf1 && draw_buf->buf2) {
+        buf_prev = buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+    }
+    else {
+        /*The pixels are moved in the buffer being flushed*/
+        while(draw_buf->flushing) {
+            if(drv->wait_cb) drv->wait_cb(drv);
+        }
+    }
+
+    bool copied = false;
+    uint16_t i;
+    uint16_t j;
+    if(buf_prev && draw_ctx->buffer_copy) {
+        /*The other buffer has the last frame. Copy what has changed in it, if it's not redrawn anyway.*/
+        for(i = 0; i < disp_refr->sync_p; i++) {
+            const lv_area_t * sync_area = &disp_refr->sync_areas[i];
+            bool redrawn = false;
+            for(j = 0; j < disp_refr->inv_p && !redrawn; j++) {
+                if(disp_refr->inv_area_joined[j]) continue;
+                redrawn = _lv_area_is_in(sync_area, &disp_refr->inv_areas[j], 0);
+            }
+            if(redrawn) continue;
+
+            draw_ctx->buffer_copy(draw_ctx, buf_act, stride, sync_area, buf_prev, stride, sync_area);
+            copied = true;
+        }
+    }
+    disp_refr->sync_p = 0;
+
+    if(disp_refr->blit_pending) {
+        disp_refr->blit_pending = 0;
+#if LV_USE_DISP_BEAM
+        /*Move the pixels in the only buffer when the display has scanned them too*/
+        if(beam_is_active(disp_refr)) {
+            uint32_t frame = beam_wait(disp_refr->blit_area.y2);
+            refr_move_area(draw_ctx, buf_act, buf_act, stride);
+            if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+            beam_check(&disp_refr->blit_area, frame);
+        }
+        else
+#endif
+        {
+            refr_move_area(draw_ctx, buf_act, buf_prev ? buf_prev : buf_act, stride);
+        }
+        disp_refr->sync_areas[disp_refr->sync_p] = disp_refr->blit_area;
+        disp_refr->sync_p++;
+        copied = true;
+    }
+
+    if(copied && draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+
+    /*Remember what changes in this buffer for the next frame*/
+    if(buf_prev) {
+        for(i = 0; i < disp_refr->inv_p; i++) {
+            if(disp_refr->inv_area_joined[i]) continue;
+            disp_refr->sync_areas[disp_refr->sync_p] = disp_refr->inv_areas[i];
+            disp_refr->sync_p++;
+        }
+    }
+    else {
+        disp_refr->sync_p = 0;
+    }
+}
+
+/**
+ * Move the pixels of `blit_area` by `blit_ofs`
+ * @param draw_ctx  the draw context to copy with
+ * @param dest_buf  the buffer to draw
+ * @param src_buf   the buffer with the last frame, can be the same as `dest_buf`
+ * @param stride    width of the buffers in pixels
+ */
+static void refr_move_area(lv_draw_ctx_t * draw_ctx, lv_color_t * dest_buf, lv_color_t * src_buf, lv_coord_t stride)
+{
+    lv_coord_t x_ofs = disp_refr->blit_ofs.x;
+    lv_coord_t y_ofs = disp_refr->blit_ofs.y;
+
+    lv_area_t dest = disp_refr->blit_area;
+    lv_area_move(&dest, x_ofs, y_ofs);
+    if(!_lv_area_intersect(&dest, &dest, &disp_refr->blit_area)) return;
+
+    lv_area_t src = dest;
+    lv_area_move(&src, -x_ofs, -y_ofs);
+
+    if(dest_buf != src_buf) {
+        draw_ctx->buffer_copy(draw_ctx, dest_buf, stride, &dest, src_buf, stride, &src);
+        return;
+    }
+
+    /*In the same buffer copy in bands which don't overlap their source,
+     *starting with the band whose source would be overwritten first*/
+    lv_area_t band_dest = dest;
+    lv_area_t band_src;
+    lv_coord_t ofs;
+    if(y_ofs != 0) {
+        lv_coord_t band_h = LV_ABS(y_ofs);
+        for(ofs = 0; ofs < lv_area_get_height(&dest); ofs += band_h) {
+            if(y_ofs > 0) {
+                band_dest.y2 = dest.y2 - ofs;
+                band_dest.y1 = LV_MAX(band_dest.y2 - band_h + 1, dest.y1);
+            }
+            else {
+                band_dest.y1 = dest.y1 + ofs;
+                band_dest.y2 = LV_MIN(band_dest.y1 + band_h - 1, dest.y2);
+            }
+            band_src = band_dest;
+            lv_area_move(&band_src, -x_ofs, -y_ofs);
+            draw_ctx->buffer_copy(draw_ctx, dest_buf, stride, &band_dest, src_buf, stride, &band_src);
+        }
+    }
+    else {
+        lv_coord_t band_w = LV_ABS(x_ofs);
+        for(ofs = 0; ofs < lv_area_get_width(&dest); ofs += band_w) {
+            if(x_ofs > 0) {
+                band_dest.x2 = dest.x2 - ofs;
+                band_dest.x1 = LV_MAX(band_dest.x2 - band_w + 1, dest.x1);
+            }
+            else {
+                band_dest.x1 = dest.x1 + ofs;
+                band_dest.x2 = LV_MIN(band_dest.x1 + band_w - 1, dest.x2);
+            }
+            band_src = band_dest;
+            lv_area_move(&band_src, -x_ofs, 0);
+            draw_ctx->buffer_copy(draw_ctx, dest_buf, stride, &band_dest, src_buf, stride, &band_src);
+        }
+    }
+}
+#endif
+
+#if LV_USE_DISP_BEAM
+/**
+ * Check if the display is drawn in bands behind its scanning
+ * @param disp      pointer to a display
+ * @return          true: `direct_mode` with one buffer and `scan_line_cb`
+ */
+static bool beam_is_active(lv_disp_t * disp)
+{
+    lv_disp_drv_t * drv = disp->driver;
+    return drv->scan_line_cb && drv->direct_mode && !drv->full_refresh &&
+           drv->draw_buf->buf2 == NULL && drv->rotated == LV_DISP_ROT_NONE;
+}
+
+/**
+ * Sort the invalidated areas by their top coordinate (keeping the joined flags with them)
+ * so they can be drawn while the display is scanned only once.
+ */
+static void beam_sort_areas(void)
+{
+    uint16_t i;
+    for(i = 1; i < disp_refr->inv_p; i++) {
+        lv_area_t area = disp_refr->inv_areas[i];
+        uint8_t joined = disp_refr->inv_area_joined[i];
+        int32_t j = i - 1;
+        while(j >= 0 && disp_refr->inv_areas[j].y1 > area.y1) {
+            disp_refr->inv_areas[j + 1] = disp_refr->inv_areas[j];
+            disp_refr->inv_area_joined[j + 1] = disp_refr->inv_area_joined[j];
+            j--;
+        }
+        disp_refr->inv_areas[j + 1] = area;
+        disp_refr->inv_area_joined[j + 1] = joined;
+    }
+}
+
+/**
+ * Draw an area into the only buffer in `LV_DISP_BEAM_BAND_H` high bands.
+ * A band is drawn only after the display has scanned past it,
+ * so it's ready before the display gets there again in the next frame.
+ * @param draw_ctx  the draw context with the whole buffer as `buf_area`
+ * @param area_p    the area to draw
+ */
+static void refr_area_beam(lv_draw_ctx_t * draw_ctx, const lv_area_t * area_p)
+{
+    lv_disp_draw_buf_t * draw_buf = disp_refr->driver->draw_buf;
+    bool last_area = draw_buf->last_area;
+
+    lv_area_t band = *area_p;
+    lv_coord_t y;
+    for(y = area_p->y1; y <= area_p->y2; y += LV_DISP_BEAM_BAND_H) {
+        band.y1 = y;
+        band.y2 = LV_MIN(y + LV_DISP_BEAM_BAND_H - 1, area_p->y2);
+        draw_buf->last_part = last_area && band.y2 == area_p->y2;
+        draw_ctx->clip_area = &band;
+
+        uint32_t frame = beam_wait(band.y2);
+        refr_area_part(draw_ctx);
+        beam_check(&band, frame);
+    }
+}
+
+/**
+ * Wait until the display has scanned past a line
+ * @param y2        the last line to be drawn
+ * @return          the frame in which the drawing can start
+ */
+static uint32_t beam_wait(lv_coord_t y2)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_coord_t line_last = y2 + drv->offset_y;
+    uint32_t frame;
+    while(drv->scan_line_cb(drv, &frame) <= line_last) {
+        if(drv->scan_wait_cb) drv->scan_wait_cb(drv, line_last + 1);
+        else if(drv->wait_cb) drv->wait_cb(drv);
+    }
+
+    return frame;
+}
+
+/**
+ * Count a tearing if the display got back to an area in the next frame before it was drawn
+ * @param area_p        the drawn area
+ * @param frame_start   the frame returned by `beam_wait` before drawing
+ */
+static void beam_check(const lv_area_t * area_p, uint32_t frame_start)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    uint32_t frame;
+    lv_coord_t line = drv->scan_line_cb(drv, &frame);
+    uint32_t frames = frame - frame_start;
+    if(frames > 1 || (frames == 1 && line >= area_p->y1 + drv->offset_y)) {
+        disp_refr->beam_tear_cnt++;
+        REFR_TRACE("(%d;%d)(%d;%d) area was drawn too late, it might be torn", area_p->x1, area_p->y1,
+                   area_p->x2, area_p->y2);
+    }
+}
+#endif
+
 /**
  * Refresh an area if there is Virtual Display Buffer
  * @param area_p  pointer to an area to refresh
@@ -566,6 +1083,11 @@ static void refr_area(const lv_area_t * area_p)
             draw_ctx->clip_area = &disp_area;
             refr_area_part(draw_ctx);
         }
+#if LV_USE_DISP_BEAM
+        else if(beam_is_active(disp_refr)) {
+            refr_area_beam(draw_ctx, area_p);
+        }
+#endif
         else {
             disp_refr->driver->draw_buf->last_part = disp_refr->driver->draw_buf->last_area;
             draw_ctx->clip_area = area_p;
@@ -640,6 +1162,9 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 #endif
     }
 
+    /*The temporal buffers of the drawing functions live only while this part is rendered*/
+    _lv_mem_scratch_begin();
+
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -651,38 +1176,7 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 
     /*Draw a display background if there is no top object*/
     if(top_act_scr == NULL && top_prev_scr == NULL) {
-        lv_area_t a;
-        lv_area_set(&a, 0, 0,
-                    lv_disp_get_hor_res(disp_refr) - 1, lv_disp_get_ver_res(disp_refr) - 1);
-        if(draw_ctx->draw_bg) {
-            lv_draw_rect_dsc_t dsc;
-            lv_draw_rect_dsc_init(&dsc);
-            dsc.bg_img_src = disp_refr->bg_img;
-            dsc.bg_img_opa = disp_refr->bg_opa;
-            dsc.bg_color = disp_refr->bg_color;
-            dsc.bg_opa = disp_refr->bg_opa;
-            draw_ctx->draw_bg(draw_ctx, &dsc, &a);
-        }
-        else if(disp_refr->bg_img) {
-            lv_img_header_t header;
-            lv_res_t res = lv_img_decoder_get_info(disp_refr->bg_img, &header);
-            if(res == LV_RES_OK) {
-                lv_draw_img_dsc_t dsc;
-                lv_draw_img_dsc_init(&dsc);
-                dsc.opa = disp_refr->bg_opa;
-                lv_draw_img(draw_ctx, &dsc, &a, disp_refr->bg_img);
-            }
-            else {
-                LV_LOG_WARN("Can't draw the background image");
-            }
-        }
-        else {
-            lv_draw_rect_dsc_t dsc;
-            lv_draw_rect_dsc_init(&dsc);
-            dsc.bg_color = disp_refr->bg_color;
-            dsc.bg_opa = disp_refr->bg_opa;
-            lv_draw_rect(draw_ctx, &dsc, draw_ctx->buf_area);
-        }
+        refr_disp_bg(draw_ctx);
     }
 
     if(disp_refr->draw_prev_over_act) {
@@ -706,15 +1200,269 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
         refr_obj_and_children(draw_ctx, top_act_scr);
     }
 
-    /*Also refresh top and sys layer unconditionally*/
-    refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
-    refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
+    /*Also refresh top and sys layer unconditionally, unless they are in the overlay*/
+#if LV_USE_DISP_OVERLAY
+    if(disp_refr->driver->overlay_buf == NULL)
+#endif
+    {
+        refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
+        refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
+    }
 
     /*In true double buffered mode flush only once when all areas were rendered.
      *In normal mode flush after every area*/
     if(disp_refr->driver->full_refresh == false) {
         draw_buf_flush(disp_refr);
     }
+
+    _lv_mem_scratch_end();
+}
+
+#if LV_USE_DISP_OVERLAY
+/**
+ * Render the invalidated areas of the top and system layers into `overlay_buf`.
+ * They are drawn into a temporary buffer with alpha channel like in `lv_snapshot`
+ * and converted to ARGB4444 only when they are ready.
+ */
+static void refr_overlay(void)
+{
+    lv_disp_t * disp = disp_refr;
+    lv_disp_drv_t * drv = disp->driver;
+    if(drv->overlay_buf == NULL || disp->overlay_inv_p == 0) return;
+
+    /*Merge the overlapping areas, e.g. the old and new position of a moved object*/
+    uint16_t i;
+    uint16_t j;
+    for(i = 0; i < disp->overlay_inv_p; i++) {
+        for(j = i + 1; j < disp->overlay_inv_p; j++) {
+            lv_area_t joined;
+            _lv_area_join(&joined, &disp->overlay_inv_areas[i], &disp->overlay_inv_areas[j]);
+            if(lv_area_get_size(&joined) < lv_area_get_size(&disp->overlay_inv_areas[i]) +
+               lv_area_get_size(&disp->overlay_inv_areas[j])) {
+                disp->overlay_inv_areas[i] = joined;
+                disp->overlay_inv_areas[j] = disp->overlay_inv_areas[disp->overlay_inv_p - 1];
+                disp->overlay_inv_p--;
+                j = i;  /*The larger area might overlap with the earlier ones too*/
+            }
+        }
+    }
+
+    /*The pixels are blended by a software draw context through `set_px_cb`*/
+    lv_disp_drv_t fake_drv;
+    lv_disp_drv_init(&fake_drv);
+    fake_drv.hor_res = drv->hor_res;
+    fake_drv.ver_res = drv->ver_res;
+    fake_drv.antialiasing = drv->antialiasing;
+    fake_drv.dpi = drv->dpi;
+    lv_disp_drv_use_generic_set_px_cb(&fake_drv, LV_IMG_CF_TRUE_COLOR_ALPHA);
+
+    lv_disp_t fake_disp;
+    lv_memset_00(&fake_disp, sizeof(lv_disp_t));
+    fake_disp.driver = &fake_drv;
+
+    lv_draw_sw_ctx_t * draw_ctx = lv_mem_alloc(sizeof(lv_draw_sw_ctx_t));
+    LV_ASSERT_MALLOC(draw_ctx);
+    if(draw_ctx == NULL) return;
+    lv_draw_sw_init_ctx(&fake_drv, &draw_ctx->base_draw);
+    fake_drv.draw_ctx = &draw_ctx->base_draw;
+
+    disp_refr = &fake_disp;
+    disp->rendering_in_progress = true;
+
+    for(i = 0; i < disp->overlay_inv_p; i++) {
+        const lv_area_t * area = &disp->overlay_inv_areas[i];
+        lv_coord_t w = lv_area_get_width(area);
+
+        /*Render in bands if there is no memory for the whole area*/
+        lv_coord_t band_h = lv_area_get_height(area);
+        uint8_t * buf = NULL;
+        while(band_h > 0) {
+            buf = lv_mem_alloc_hint(w * band_h * LV_IMG_PX_SIZE_ALPHA_BYTE, LV_MEM_HINT_BULK);
+            if(buf) break;
+            band_h /= 2;
+        }
+        if(buf == NULL) {
+            LV_LOG_WARN("Couldn't allocate a buffer to render the overlay");
+            continue;
+        }
+
+        lv_area_t band;
+        band.x1 = area->x1;
+        band.x2 = area->x2;
+        for(band.y1 = area->y1; band.y1 <= area->y2; band.y1 += band_h) {
+            band.y2 = LV_MIN(band.y1 + band_h - 1, area->y2);
+            lv_memset_00(buf, lv_area_get_size(&band) * LV_IMG_PX_SIZE_ALPHA_BYTE);
+
+            draw_ctx->base_draw.buf = buf;
+            draw_ctx->base_draw.buf_area = &band;
+            draw_ctx->base_draw.clip_area = &band;
+
+            _lv_mem_scratch_begin();
+            refr_obj_and_children(&draw_ctx->base_draw, lv_disp_get_layer_top(disp));
+            refr_obj_and_children(&draw_ctx->base_draw, lv_disp_get_layer_sys(disp));
+            _lv_mem_scratch_end();
+
+            overlay_copy(drv, buf, &band);
+        }
+        lv_mem_free(buf);
+
+        if(drv->overlay_flush_cb) drv->overlay_flush_cb(drv, area);
+    }
+
+    disp->rendering_in_progress = false;
+    disp_refr = disp;
+    disp->overlay_inv_p = 0;
+
+    lv_draw_sw_deinit_ctx(&fake_drv, &draw_ctx->base_draw);
+    lv_mem_free(draw_ctx);
+
+    /*Everything outside of the content is transparent now*/
+    if(drv->overlay_area_cb) {
+        lv_area_t content;
+        bool found = overlay_get_content_area(disp, &content);
+        drv->overlay_area_cb(drv, found ? &content : NULL);
+    }
+}
+
+/**
+ * Convert the rendered pixels to ARGB4444 and write them into `overlay_buf`
+ * @param drv       pointer to the display driver
+ * @param buf       the rendered pixels with alpha channel
+ * @param area      the area of `buf` on the display
+ */
+static void overlay_copy(lv_disp_drv_t * drv, const uint8_t * buf, const lv_area_t * area)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    uint16_t * dest = drv->overlay_buf + (uint32_t)area->y1 * drv->hor_res + area->x1;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        for(x = 0; x < w; x++) {
+            lv_opa_t opa = buf[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            if(opa < 0x10) {
+                dest[x] = 0;
+            }
+            else {
+                lv_color_t c;
+                lv_memcpy_small(&c, buf, sizeof(lv_color_t));
+                lv_color32_t c32;
+                c32.full = lv_color_to32(c);
+                dest[x] = ((opa >> 4) << 12) | ((c32.ch.red >> 4) << 8) | ((c32.ch.green >> 4) << 4) | (c32.ch.blue >> 4);
+            }
+            buf += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+        dest += drv->hor_res;
+    }
+}
+
+/**
+ * Get the area which contains everything drawn on the top and system layers
+ * @param disp      pointer to a display
+ * @param area      store the area here
+ * @return          false: the layers are empty, the whole overlay is transparent
+ */
+static bool overlay_get_content_area(lv_disp_t * disp, lv_area_t * area)
+{
+    bool found = false;
+    lv_obj_t * layers[2] = {lv_disp_get_layer_top(disp), lv_disp_get_layer_sys(disp)};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_t * layer = layers[i];
+        if(lv_obj_has_flag(layer, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        /*The layers are transparent by default but they can have a background, e.g. to dim a modal dialog*/
+        if(lv_obj_get_style_bg_opa(layer, LV_PART_MAIN) > LV_OPA_MIN ||
+           lv_obj_get_style_bg_img_src(layer, LV_PART_MAIN) != NULL ||
+           lv_obj_get_style_border_width(layer, LV_PART_MAIN) > 0 ||
+           _lv_obj_get_ext_draw_size(layer) > 0) {
+            lv_area_set(area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+            return true;
+        }
+
+        overlay_join_children(layer, area, &found);
+    }
+
+    if(!found) return false;
+
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    return _lv_area_intersect(area, area, &scr_area);
+}
+
+/**
+ * Join the areas of the visible children of an object, the same as they are invalidated
+ * @param parent    pointer to an object
+ * @param area      the area to extend
+ * @param found     true if `area` is already set, it will be set if a child was found
+ */
+static void overlay_join_children(lv_obj_t * parent, lv_area_t * area, bool * found)
+{
+    uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        lv_area_t child_area;
+        lv_coord_t ext_size = _lv_obj_get_ext_draw_size(child);
+        lv_area_copy(&child_area, &child->coords);
+        lv_area_increase(&child_area, ext_size, ext_size);
+        lv_obj_get_transformed_area(child, &child_area, false, false);
+
+        if(*found) {
+            _lv_area_join(area, area, &child_area);
+        }
+        else {
+            lv_area_copy(area, &child_area);
+            *found = true;
+        }
+
+        /*The grandchildren are clipped to the child unless its overflow is visible*/
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+            overlay_join_children(child, area, found);
+        }
+    }
+}
+#endif
+
+/**
+ * Draw the background color or wallpaper of the display
+ * @param draw_ctx  the draw context to draw with
+ */
+static void refr_disp_bg(lv_draw_ctx_t * draw_ctx)
+{
+    lv_area_t a;
+    lv_area_set(&a, 0, 0,
+                lv_disp_get_hor_res(disp_refr) - 1, lv_disp_get_ver_res(disp_refr) - 1);
+    if(draw_ctx->draw_bg) {
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_img_src = disp_refr->bg_img;
+        dsc.bg_img_opa = disp_refr->bg_opa;
+        dsc.bg_color = disp_refr->bg_color;
+        dsc.bg_opa = disp_refr->bg_opa;
+        draw_ctx->draw_bg(draw_ctx, &dsc, &a);
+    }
+    else if(disp_refr->bg_img) {
+        lv_img_header_t header;
+        lv_res_t res = lv_img_decoder_get_info(disp_refr->bg_img, &header);
+        if(res == LV_RES_OK) {
+            lv_draw_img_dsc_t dsc;
+            lv_draw_img_dsc_init(&dsc);
+            dsc.opa = disp_refr->bg_opa;
+            lv_draw_img(draw_ctx, &dsc, &a, disp_refr->bg_img);
+        }
+        else {
+            LV_LOG_WARN("Can't draw the background image");
+        }
+    }
+    else {
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_color = disp_refr->bg_color;
+        dsc.bg_opa = disp_refr->bg_opa;
+        lv_draw_rect(draw_ctx, &dsc, draw_ctx->buf_area);
+    }
 }
 
 /**
@@ -732,11 +1480,8 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
     if(_lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return NULL;
 
     /*If this object is fully cover the draw area then check the children too*/
-    lv_cover_check_info_t info;
-    info.res = LV_COVER_RES_COVER;
-    info.area = area_p;
-    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
-    if(info.res == LV_COVER_RES_MASKED) return NULL;
+    lv_cover_res_t cover_res = cover_check(obj, area_p);
+    if(cover_res == LV_COVER_RES_MASKED) return NULL;
 
     int32_t i;
     int32_t child_cnt = lv_obj_get_child_cnt(obj);
@@ -751,13 +1496,36 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
     }
 
     /*If no better children use this object*/
-    if(found_p == NULL && info.res == LV_COVER_RES_COVER) {
+    if(found_p == NULL && cover_res == LV_COVER_RES_COVER) {
         found_p = obj;
     }
 
     return found_p;
 }
 
+/**
+ * Check if an object covers an area.
+ * If only the base object's class would handle `LV_EVENT_COVER_CHECK`, do its check directly
+ * (using the cached style values) instead of sending the event.
+ * @param obj       pointer to an object
+ * @param area_p    the area to check
+ * @return          the result of the cover check
+ */
+static lv_cover_res_t cover_check(lv_obj_t * obj, const lv_area_t * area_p)
+{
+#if LV_OBJ_COVER_CACHE
+    if(_lv_event_has_handler(obj, LV_EVENT_COVER_CHECK, &lv_obj_class) == false) {
+        return _lv_obj_check_cover(obj, area_p);
+    }
+#endif
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = area_p;
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    return info.res;
+}
+
 /**
  * Make the refreshing from an object. Draw all its children and the youngers too.
  * @param top_p pointer to an objects. Start the drawing from it.
@@ -864,11 +1632,7 @@ static void layer_alpha_test(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, lv_draw_l
         /*Test for alpha by assuming there is no alpha. If it fails, fall back to rendering with alpha*/
         has_alpha = true;
         if(_lv_area_is_in(&layer_ctx->area_act, &obj->coords, 0)) {
-            lv_cover_check_info_t info;
-            info.res = LV_COVER_RES_COVER;
-            info.area = &layer_ctx->area_act;
-            lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
-            if(info.res == LV_COVER_RES_COVER) has_alpha = false;
+            if(cover_check(obj, &layer_ctx->area_act) == LV_COVER_RES_COVER) has_alpha = false;
         }
 
         if(has_alpha) {
@@ -903,11 +1667,7 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         lv_draw_layer_flags_t flags = LV_DRAW_LAYER_FLAG_HAS_ALPHA;
 
         if(_lv_area_is_in(&layer_area_full, &obj->coords, 0)) {
-            lv_cover_check_info_t info;
-            info.res = LV_COVER_RES_COVER;
-            info.area = &layer_area_full;
-            lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
-            if(info.res == LV_COVER_RES_COVER) flags &= ~LV_DRAW_LAYER_FLAG_HAS_ALPHA;
+            if(cover_check(obj, &layer_area_full) == LV_COVER_RES_COVER) flags &= ~LV_DRAW_LAYER_FLAG_HAS_ALPHA;
         }
 
         if(layer_type == LV_LAYER_TYPE_SIMPLE) flags |= LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE;
@@ -1189,6 +1949,8 @@ static void draw_buf_flush(lv_disp_t * disp)
     lv_draw_ctx_t * draw_ctx = disp->driver->draw_ctx;
     if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
 
+    if(draw_buf->last_area && draw_buf->last_part) LV_LATENCY_TRACE_POINT(LV_LATENCY_TRACE_RENDER_DONE);
+
     /* In double buffered mode wait until the other buffer is freed
      * and driver is ready to receive the new buffer */
     if(draw_buf->buf1 && draw_buf->buf2) {
@@ -1216,6 +1978,8 @@ static void draw_buf_flush(lv_disp_t * disp)
 
     bool flushing_last = draw_buf->flushing_last;
 
+    if(flushing_last) LV_LATENCY_TRACE_POINT(LV_LATENCY_TRACE_FLUSH);
+
     if(disp->driver->flush_cb) {
         /*Rotate the buffer to the display's native orientation if necessary*/
         if(disp->driver->rotated != LV_DISP_ROT_NONE && disp->driver->sw_rotate) {
@@ -71,6 +71,43 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
  */
 void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p);
 
+#if LV_USE_SCROLL_BLIT
+/**
+ * Move the rendered pixels of an area instead of redrawing it, e.g. when its content is scrolled.
+ * The pixels are moved before the next refresh and the exposed part of the area is invalidated.
+ * It works only in `direct_mode` where the buffer keeps the last frame.
+ * @param disp      pointer to a display (NULL: the default display)
+ * @param area_p    the visible area whose content moves, nothing else can be drawn on it
+ * @param x_ofs     move the content by this many pixels horizontally
+ * @param y_ofs     move the content by this many pixels vertically
+ * @return          true: the pixels will be moved; false: it's not possible, invalidate the area instead
+ */
+bool _lv_inv_area_move(lv_disp_t * disp, const lv_area_t * area_p, lv_coord_t x_ofs, lv_coord_t y_ofs);
+#endif
+
+#if LV_USE_DISP_OVERLAY
+/**
+ * Invalidate an area of the overlay to render the top and system layers there again.
+ * Used instead of `_lv_inv_area()` for the objects of these layers if the display has `overlay_buf`.
+ * @param disp      pointer to a display (NULL: the default display)
+ * @param area_p    the area to redraw (NULL: delete the invalidated areas)
+ */
+void _lv_inv_overlay_area(lv_disp_t * disp, const lv_area_t * area_p);
+#endif
+
+#if LV_USE_DISP_PAN || LV_USE_DISP_FADE
+/**
+ * Render a screen with the top and system layers into a buffer without flushing it
+ * @param disp      pointer to a display
+ * @param scr       the screen to render
+ * @param buf       the buffer to render into
+ * @param buf_area  the area of the buffer in display coordinates, it can be larger than the display
+ * @param overlay   true: render the top and system layers even if they are in the overlay
+ */
+void _lv_refr_scr_to_buf(lv_disp_t * disp, struct _lv_obj_t * scr, lv_color_t * buf, const lv_area_t * buf_area,
+                         bool overlay);
+#endif
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
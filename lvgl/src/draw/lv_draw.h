@@ -42,6 +42,8 @@ typedef struct {
     void * user_data;
 } lv_draw_mask_t;
 
+struct _lv_disp_drv_t;
+
 typedef struct _lv_draw_layer_ctx_t {
     lv_area_t area_full;
     lv_area_t area_act;
@@ -53,6 +55,8 @@ typedef struct _lv_draw_layer_ctx_t {
         lv_area_t * buf_area;
         void * buf;
         bool screen_transp;
+        void (*set_px_cb)(struct _lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
+                          lv_color_t color, lv_opa_t opa);
     } original;
 } lv_draw_layer_ctx_t;
 
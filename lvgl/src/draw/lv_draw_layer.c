@@ -53,6 +53,7 @@ lv_draw_layer_ctx_t * lv_draw_layer_create(lv_draw_ctx_t * draw_ctx, const lv_ar
     layer_ctx->original.buf_area = draw_ctx->buf_area;
     layer_ctx->original.clip_area = draw_ctx->clip_area;
     layer_ctx->original.screen_transp = disp_refr->driver->screen_transp;
+    layer_ctx->original.set_px_cb = disp_refr->driver->set_px_cb;
     layer_ctx->area_full = *layer_area;
 
     lv_draw_layer_ctx_t * init_layer_ctx =  draw_ctx->layer_init(draw_ctx, layer_ctx, flags);
@@ -83,6 +84,7 @@ void lv_draw_layer_destroy(lv_draw_ctx_t * draw_ctx, lv_draw_layer_ctx_t * layer
     draw_ctx->clip_area = layer_ctx->original.clip_area;
     lv_disp_t * disp_refr = _lv_refr_get_disp_refreshing();
     disp_refr->driver->screen_transp = layer_ctx->original.screen_transp;
+    disp_refr->driver->set_px_cb = layer_ctx->original.set_px_cb;
 
     if(draw_ctx->layer_destroy) draw_ctx->layer_destroy(draw_ctx, layer_ctx);
     lv_mem_free(layer_ctx);
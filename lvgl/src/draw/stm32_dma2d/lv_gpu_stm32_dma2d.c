@@ -54,10 +54,15 @@ static void lv_draw_stm32_dma2d_img_decoded(lv_draw_ctx_t * draw, const lv_draw_
 
 
 static void invalidate_cache(void);
+static void set_dest(const lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h);
+static void invalidate_dest(void);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+/*The memory written by the last transfer. The CPU might have cached it again while the DMA2D was writing it.*/
+static uint32_t dest_start;
+static uint32_t dest_end;
 
 /**********************
  *      MACROS
@@ -119,6 +124,9 @@ void lv_draw_stm32_dma2d_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_
     lv_area_t blend_area;
     if(!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) return;
 
+    /*The previous transfer might write the same pixels and the DMA2D can't start a new one before it's ready*/
+    lv_gpu_stm32_dma2d_wait_cb(draw_ctx);
+
     bool done = false;
 
     if(dsc->mask_buf == NULL && dsc->blend_mode == LV_BLEND_MODE_NORMAL && lv_area_get_size(&blend_area) > 100) {
@@ -151,8 +159,12 @@ void lv_draw_stm32_dma2d_buffer_copy(lv_draw_ctx_t * draw_ctx,
                                      void * dest_buf, lv_coord_t dest_stride, const lv_area_t * dest_area,
                                      void * src_buf, lv_coord_t src_stride, const lv_area_t * src_area)
 {
-    LV_UNUSED(draw_ctx);
-    lv_draw_stm32_dma2d_blend_map(dest_buf, dest_area, dest_stride, src_buf, src_stride, LV_OPA_MAX);
+    /*The areas can be in the same buffer, so the previous copy has to be finished*/
+    lv_gpu_stm32_dma2d_wait_cb(draw_ctx);
+
+    lv_color_t * dest_p = (lv_color_t *)dest_buf + dest_stride * dest_area->y1 + dest_area->x1;
+    const lv_color_t * src_p = (const lv_color_t *)src_buf + src_stride * src_area->y1 + src_area->x1;
+    lv_draw_stm32_dma2d_blend_map(dest_p, dest_area, dest_stride, src_p, src_stride, LV_OPA_MAX);
 }
 
 
@@ -171,6 +183,7 @@ static void lv_draw_stm32_dma2d_blend_fill(lv_color_t * dest_buf, lv_coord_t des
     int32_t area_w = lv_area_get_width(fill_area);
     int32_t area_h = lv_area_get_height(fill_area);
     invalidate_cache();
+    set_dest(dest_buf, dest_stride, area_w, area_h);
 
     DMA2D->CR = 0x30000;
     DMA2D->OMAR = (uint32_t)dest_buf;
@@ -194,6 +207,7 @@ static void lv_draw_stm32_dma2d_blend_map(lv_color_t * dest_buf, const lv_area_t
     int32_t dest_h = lv_area_get_height(dest_area);
 
     invalidate_cache();
+    set_dest(dest_buf, dest_stride, dest_w, dest_h);
     if(opa >= LV_OPA_MAX) {
         DMA2D->CR = 0;
         /*copy output colour mode, this register controls both input and output colour format*/
@@ -242,6 +256,7 @@ void lv_gpu_stm32_dma2d_wait_cb(lv_draw_ctx_t * draw_ctx)
     else {
         while(DMA2D->CR & DMA2D_CR_START_Msk);
     }
+    invalidate_dest();
     lv_draw_sw_wait_for_finish(draw_ctx);
 
 }
@@ -262,4 +277,37 @@ static void invalidate_cache(void)
     }
 }
 
+/**
+ * Remember the memory written by the next transfer
+ * @param dest_buf      the first pixel to write
+ * @param dest_stride   width of the destination buffer in pixels
+ * @param w             width of the written area
+ * @param h             height of the written area
+ */
+static void set_dest(const lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h)
+{
+    dest_start = (uint32_t)dest_buf;
+    dest_end = (uint32_t)(dest_buf + dest_stride * (h - 1) + w);
+}
+
+/**
+ * Drop the cache lines of the memory written by the finished transfer.
+ * The speculative reads of the CPU could load them again while the DMA2D was still writing.
+ * The whole cache was cleaned before the transfer and the CPU doesn't write there meanwhile,
+ * so there is nothing dirty to lose.
+ */
+static void invalidate_dest(void)
+{
+    if(dest_end == dest_start) return;
+
+#if __CORTEX_M >= 0x07
+    if((SCB->CCR) & (uint32_t)SCB_CCR_DC_Msk) {
+        uint32_t start = dest_start & ~31U;
+        SCB_InvalidateDCache_by_Addr((void *)start, (int32_t)(dest_end - start));
+    }
+#endif
+    dest_start = 0;
+    dest_end = 0;
+}
+
 #endif
@@ -242,7 +242,7 @@ void lv_gradient_free_cache(void)
 void lv_gradient_set_cache_size(size_t max_bytes)
 {
     lv_mem_free(LV_GC_ROOT(_lv_grad_cache_mem));
-    grad_cache_end = LV_GC_ROOT(_lv_grad_cache_mem) = lv_mem_alloc(max_bytes);
+    grad_cache_end = LV_GC_ROOT(_lv_grad_cache_mem) = lv_mem_alloc_hint(max_bytes, LV_MEM_HINT_BULK);
     LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_grad_cache_mem));
     lv_memset_00(LV_GC_ROOT(_lv_grad_cache_mem), max_bytes);
     grad_cache_size = max_bytes;
@@ -54,12 +54,12 @@ struct _lv_draw_layer_ctx_t * lv_draw_sw_layer_create(struct _lv_draw_ctx_t * dr
         layer_sw_ctx->buf_size_bytes = LV_LAYER_SIMPLE_BUF_SIZE;
         uint32_t full_size = lv_area_get_size(&layer_sw_ctx->base_draw.area_full) * px_size;
         if(layer_sw_ctx->buf_size_bytes > full_size) layer_sw_ctx->buf_size_bytes = full_size;
-        layer_sw_ctx->base_draw.buf = lv_mem_alloc(layer_sw_ctx->buf_size_bytes);
+        layer_sw_ctx->base_draw.buf = lv_mem_alloc_hint(layer_sw_ctx->buf_size_bytes, LV_MEM_HINT_BULK);
         if(layer_sw_ctx->base_draw.buf == NULL) {
             LV_LOG_WARN("Cannot allocate %"LV_PRIu32" bytes for layer buffer. Allocating %"LV_PRIu32" bytes instead. (Reduced performance)",
                         (uint32_t)layer_sw_ctx->buf_size_bytes, (uint32_t)LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE * px_size);
             layer_sw_ctx->buf_size_bytes = LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE;
-            layer_sw_ctx->base_draw.buf = lv_mem_alloc(layer_sw_ctx->buf_size_bytes);
+            layer_sw_ctx->base_draw.buf = lv_mem_alloc_hint(layer_sw_ctx->buf_size_bytes, LV_MEM_HINT_BULK);
             if(layer_sw_ctx->base_draw.buf == NULL) {
                 return NULL;
             }
@@ -73,7 +73,7 @@ struct _lv_draw_layer_ctx_t * lv_draw_sw_layer_create(struct _lv_draw_ctx_t * dr
     else {
         layer_sw_ctx->base_draw.area_act = layer_sw_ctx->base_draw.area_full;
         layer_sw_ctx->buf_size_bytes = lv_area_get_size(&layer_sw_ctx->base_draw.area_full) * px_size;
-        layer_sw_ctx->base_draw.buf = lv_mem_alloc(layer_sw_ctx->buf_size_bytes);
+        layer_sw_ctx->base_draw.buf = lv_mem_alloc_hint(layer_sw_ctx->buf_size_bytes, LV_MEM_HINT_BULK);
         lv_memset_00(layer_sw_ctx->base_draw.buf, layer_sw_ctx->buf_size_bytes);
         layer_sw_ctx->has_alpha = flags & LV_DRAW_LAYER_FLAG_HAS_ALPHA ? 1 : 0;
         if(layer_sw_ctx->base_draw.buf == NULL) {
@@ -86,6 +86,8 @@ struct _lv_draw_layer_ctx_t * lv_draw_sw_layer_create(struct _lv_draw_ctx_t * dr
 
         lv_disp_t * disp_refr = _lv_refr_get_disp_refreshing();
         disp_refr->driver->screen_transp = flags & LV_DRAW_LAYER_FLAG_HAS_ALPHA ? 1 : 0;
+        /*The layer has a normal buffer even if the display has a special pixel format*/
+        disp_refr->driver->set_px_cb = NULL;
     }
 
     return layer_ctx;
@@ -106,6 +108,7 @@ void lv_draw_sw_layer_adjust(struct _lv_draw_ctx_t * draw_ctx, struct _lv_draw_l
         layer_sw_ctx->has_alpha = 0;
         disp_refr->driver->screen_transp = 0;
     }
+    disp_refr->driver->set_px_cb = NULL;
 
     draw_ctx->buf = layer_ctx->buf;
     draw_ctx->buf_area = &layer_ctx->area_act;
@@ -131,6 +134,7 @@ void lv_draw_sw_layer_blend(struct _lv_draw_ctx_t * draw_ctx, struct _lv_draw_la
     draw_ctx->clip_area = layer_ctx->original.clip_area;
     lv_disp_t * disp_refr = _lv_refr_get_disp_refreshing();
     disp_refr->driver->screen_transp = layer_ctx->original.screen_transp;
+    disp_refr->driver->set_px_cb = layer_ctx->original.set_px_cb;
 
     /*Blend the layer*/
     lv_draw_img(draw_ctx, draw_dsc, &layer_ctx->area_act, &img);
@@ -481,6 +481,7 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
                 area_set_main_size(&item->coords, s);
                 lv_event_send(item, LV_EVENT_SIZE_CHANGED, &old_coords);
                 lv_event_send(lv_obj_get_parent(item), LV_EVENT_CHILD_CHANGED, item);
+                _lv_obj_child_map_changed(lv_obj_get_parent(item));
                 lv_obj_invalidate(item);
             }
         }
@@ -527,6 +528,7 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             item->coords.y2 += diff_y;
             lv_obj_invalidate(item);
             lv_obj_move_children_by(item, diff_x, diff_y, false);
+            _lv_obj_child_map_changed(cont);
         }
 
         if(!(f->row && rtl)) main_pos += area_get_main_size(&item->coords) + item_gap + place_gap;
@@ -664,6 +664,7 @@ static void item_repos(lv_obj_t * item, _lv_grid_calc_t * c, item_repos_hint_t *
         lv_obj_invalidate(item);
         lv_event_send(item, LV_EVENT_SIZE_CHANGED, &old_coords);
         lv_event_send(lv_obj_get_parent(item), LV_EVENT_CHILD_CHANGED, item);
+        _lv_obj_child_map_changed(lv_obj_get_parent(item));
 
     }
 
@@ -688,6 +689,7 @@ static void item_repos(lv_obj_t * item, _lv_grid_calc_t * c, item_repos_hint_t *
         item->coords.y2 += diff_y;
         lv_obj_invalidate(item);
         lv_obj_move_children_by(item, diff_x, diff_y, false);
+        _lv_obj_child_map_changed(lv_obj_get_parent(item));
     }
 }
 
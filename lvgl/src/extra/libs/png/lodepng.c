@@ -75,7 +75,7 @@ static void* lodepng_malloc(size_t size) {
 #ifdef LODEPNG_MAX_ALLOC
   if(size > LODEPNG_MAX_ALLOC) return 0;
 #endif
-  return lv_mem_alloc(size);
+  return lv_mem_alloc_hint(size, LV_MEM_HINT_BULK);
 }
 
 /* NOTE: when realloc returns NULL, it leaves the original memory untouched */
@@ -83,7 +83,7 @@ static void* lodepng_realloc(void* ptr, size_t new_size) {
 #ifdef LODEPNG_MAX_ALLOC
   if(new_size > LODEPNG_MAX_ALLOC) return 0;
 #endif
-  return lv_mem_realloc(ptr, new_size);
+  return lv_mem_realloc_hint(ptr, new_size, LV_MEM_HINT_BULK);
 }
 
 static void lodepng_free(void* ptr) {
@@ -20,9 +20,22 @@
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct {
+    lv_obj_t * obj;
+    uint32_t index;             /*Index of the child to prefer the older child if two are equally close*/
+} child_ref_t;
+
 typedef struct {
     lv_gridnav_ctrl_t ctrl;
     lv_obj_t * focused_obj;
+
+    /*The children sorted by the Y coordinate of their center, then by their index.
+     *The children are scrolled together so the order changes only if the children change.
+     *Floating children are not scrolled so they are stored separately at the end.*/
+    child_ref_t * sorted;
+    uint32_t sorted_cnt;
+    uint32_t floating_cnt;
+    uint32_t child_map_ver;     /*The version of the children `sorted` was updated for*/
 } lv_gridnav_dsc_t;
 
 typedef enum {
@@ -36,11 +49,27 @@ typedef enum {
     FIND_LAST_ROW,
 } find_mode_t;
 
+typedef struct {
+    lv_obj_t * start_child;
+    find_mode_t mode;
+    lv_coord_t x_start;
+    lv_coord_t y_start;
+    lv_coord_t h_half;
+    lv_coord_t h_max;
+    lv_obj_t * guess;
+    uint32_t guess_index;
+    int32_t guess_err;
+} find_dsc_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void gridnav_event_cb(lv_event_t * e);
-static lv_obj_t * find_chid(lv_obj_t * obj, lv_obj_t * start_child, find_mode_t mode);
+static lv_obj_t * find_chid(lv_obj_t * obj, lv_gridnav_dsc_t * dsc, lv_obj_t * start_child, find_mode_t mode);
+static void find_check_child(lv_obj_t * obj, find_dsc_t * f, lv_obj_t * child, uint32_t index);
+static bool sorted_update(lv_obj_t * obj, lv_gridnav_dsc_t * dsc);
+static uint32_t sorted_lower_bound(lv_gridnav_dsc_t * dsc, lv_coord_t y);
+static bool child_ref_is_less(const child_ref_t * a, const child_ref_t * b);
 static lv_obj_t * find_first_focusable(lv_obj_t * obj);
 static lv_obj_t * find_last_focusable(lv_obj_t * obj);
 static bool obj_is_focuable(lv_obj_t * obj);
@@ -65,8 +94,8 @@ void lv_gridnav_add(lv_obj_t * obj, lv_gridnav_ctrl_t ctrl)
 
     lv_gridnav_dsc_t * dsc = lv_mem_alloc(sizeof(lv_gridnav_dsc_t));
     LV_ASSERT_MALLOC(dsc);
+    lv_memset_00(dsc, sizeof(lv_gridnav_dsc_t));
     dsc->ctrl = ctrl;
-    dsc->focused_obj = NULL;
     lv_obj_add_event_cb(obj, gridnav_event_cb, LV_EVENT_ALL, dsc);
 
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLL_WITH_ARROW);
@@ -77,6 +106,7 @@ void lv_gridnav_remove(lv_obj_t * obj)
     lv_gridnav_dsc_t * dsc = lv_obj_get_event_user_data(obj, gridnav_event_cb);
     if(dsc == NULL) return; /* no gridnav on this object */
 
+    if(dsc->sorted) lv_mem_free(dsc->sorted);
     lv_mem_free(dsc);
     lv_obj_remove_event_cb(obj, gridnav_event_cb);
 }
@@ -130,10 +160,10 @@ static void gridnav_event_cb(lv_event_t * e)
                 lv_obj_scroll_by_bounded(dsc->focused_obj, -d, 0, LV_ANIM_ON);
             }
             else {
-                guess = find_chid(obj, dsc->focused_obj, FIND_RIGHT);
+                guess = find_chid(obj, dsc, dsc->focused_obj, FIND_RIGHT);
                 if(guess == NULL) {
                     if(dsc->ctrl & LV_GRIDNAV_CTRL_ROLLOVER) {
-                        guess = find_chid(obj, dsc->focused_obj, FIND_NEXT_ROW_FIRST_ITEM);
+                        guess = find_chid(obj, dsc, dsc->focused_obj, FIND_NEXT_ROW_FIRST_ITEM);
                         if(guess == NULL) guess = find_first_focusable(obj);
                     }
                     else {
@@ -150,10 +180,10 @@ static void gridnav_event_cb(lv_event_t * e)
                 lv_obj_scroll_by_bounded(dsc->focused_obj, d, 0, LV_ANIM_ON);
             }
             else {
-                guess = find_chid(obj, dsc->focused_obj, FIND_LEFT);
+                guess = find_chid(obj, dsc, dsc->focused_obj, FIND_LEFT);
                 if(guess == NULL) {
                     if(dsc->ctrl & LV_GRIDNAV_CTRL_ROLLOVER) {
-                        guess = find_chid(obj, dsc->focused_obj, FIND_PREV_ROW_LAST_ITEM);
+                        guess = find_chid(obj, dsc, dsc->focused_obj, FIND_PREV_ROW_LAST_ITEM);
                         if(guess == NULL) guess = find_last_focusable(obj);
                     }
                     else {
@@ -170,10 +200,10 @@ static void gridnav_event_cb(lv_event_t * e)
                 lv_obj_scroll_by_bounded(dsc->focused_obj, 0, -d, LV_ANIM_ON);
             }
             else {
-                guess = find_chid(obj, dsc->focused_obj, FIND_BOTTOM);
+                guess = find_chid(obj, dsc, dsc->focused_obj, FIND_BOTTOM);
                 if(guess == NULL) {
                     if(dsc->ctrl & LV_GRIDNAV_CTRL_ROLLOVER) {
-                        guess = find_chid(obj, dsc->focused_obj, FIND_FIRST_ROW);
+                        guess = find_chid(obj, dsc, dsc->focused_obj, FIND_FIRST_ROW);
                     }
                     else {
                         lv_group_focus_next(lv_obj_get_group(obj));
@@ -189,10 +219,10 @@ static void gridnav_event_cb(lv_event_t * e)
                 lv_obj_scroll_by_bounded(dsc->focused_obj, 0, d, LV_ANIM_ON);
             }
             else {
-                guess = find_chid(obj, dsc->focused_obj, FIND_TOP);
+                guess = find_chid(obj, dsc, dsc->focused_obj, FIND_TOP);
                 if(guess == NULL) {
                     if(dsc->ctrl & LV_GRIDNAV_CTRL_ROLLOVER) {
-                        guess = find_chid(obj, dsc->focused_obj, FIND_LAST_ROW);
+                        guess = find_chid(obj, dsc, dsc->focused_obj, FIND_LAST_ROW);
                     }
                     else {
                         lv_group_focus_prev(lv_obj_get_group(obj));
@@ -262,74 +292,233 @@ static void gridnav_event_cb(lv_event_t * e)
     }
 }
 
-static lv_obj_t * find_chid(lv_obj_t * obj, lv_obj_t * start_child, find_mode_t mode)
+static lv_obj_t * find_chid(lv_obj_t * obj, lv_gridnav_dsc_t * dsc, lv_obj_t * start_child, find_mode_t mode)
+{
+    find_dsc_t f;
+    f.start_child = start_child;
+    f.mode = mode;
+    f.x_start = get_x_center(start_child);
+    f.y_start = get_y_center(start_child);
+    f.h_half = lv_obj_get_height(start_child) / 2;
+    f.h_max = lv_obj_get_height(obj) + lv_obj_get_scroll_top(obj) + lv_obj_get_scroll_bottom(obj);
+    f.guess = NULL;
+    f.guess_index = 0;
+    f.guess_err = 0;
+
+    /*The first and last rows are found by the top of the children, not by their center so check all children*/
+    uint32_t i;
+    if(mode == FIND_FIRST_ROW || mode == FIND_LAST_ROW || !sorted_update(obj, dsc)) {
+        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+        for(i = 0; i < child_cnt; i++) {
+            find_check_child(obj, &f, lv_obj_get_child(obj, i), i);
+        }
+        return f.guess;
+    }
+
+    uint32_t scrolled_cnt = dsc->sorted_cnt - dsc->floating_cnt;
+    if(mode == FIND_LEFT || mode == FIND_RIGHT) {
+        /*Check only the children whose center is in the row of the start child*/
+        uint32_t end = sorted_lower_bound(dsc, f.y_start + f.h_half + 1);
+        for(i = sorted_lower_bound(dsc, f.y_start - f.h_half); i < end; i++) {
+            find_check_child(obj, &f, dsc->sorted[i].obj, dsc->sorted[i].index);
+        }
+    }
+    else if(mode == FIND_TOP || mode == FIND_PREV_ROW_LAST_ITEM) {
+        /*Go upward until the vertical distance alone is larger than the distance of the best guess*/
+        i = sorted_lower_bound(dsc, f.y_start);
+        while(i > 0) {
+            i--;
+            int32_t y_err = get_y_center(dsc->sorted[i].obj) - f.y_start;
+            if(f.guess && y_err * y_err > f.guess_err) break;
+            find_check_child(obj, &f, dsc->sorted[i].obj, dsc->sorted[i].index);
+        }
+    }
+    else {
+        /*Go downward in the same way*/
+        for(i = sorted_lower_bound(dsc, f.y_start + 1); i < scrolled_cnt; i++) {
+            int32_t y_err = get_y_center(dsc->sorted[i].obj) - f.y_start;
+            if(f.guess && y_err * y_err > f.guess_err) break;
+            find_check_child(obj, &f, dsc->sorted[i].obj, dsc->sorted[i].index);
+        }
+    }
+
+    for(i = scrolled_cnt; i < dsc->sorted_cnt; i++) {
+        find_check_child(obj, &f, dsc->sorted[i].obj, dsc->sorted[i].index);
+    }
+
+    return f.guess;
+}
+
+/**
+ * Check if a child is closer in the direction of the search than the current guess
+ * @param obj       the gridnav container
+ * @param f         the state of the search
+ * @param child     the child to check
+ * @param index     index of the child. If two children are equally close the older is used.
+ */
+static void find_check_child(lv_obj_t * obj, find_dsc_t * f, lv_obj_t * child, uint32_t index)
+{
+    if(child == f->start_child) return;
+    if(obj_is_focuable(child) == false) return;
+
+    lv_coord_t x_err = 0;
+    lv_coord_t y_err = 0;
+    switch(f->mode) {
+        case FIND_LEFT:
+            x_err = get_x_center(child) - f->x_start;
+            y_err = get_y_center(child) - f->y_start;
+            if(x_err >= 0) return;    /*It's on the right*/
+            if(LV_ABS(y_err) > f->h_half) return;    /*Too far*/
+            break;
+        case FIND_RIGHT:
+            x_err = get_x_center(child) - f->x_start;
+            y_err = get_y_center(child) - f->y_start;
+            if(x_err <= 0) return;    /*It's on the left*/
+            if(LV_ABS(y_err) > f->h_half) return;    /*Too far*/
+            break;
+        case FIND_TOP:
+            x_err = get_x_center(child) - f->x_start;
+            y_err = get_y_center(child) - f->y_start;
+            if(y_err >= 0) return;    /*It's on the bottom*/
+            break;
+        case FIND_BOTTOM:
+            x_err = get_x_center(child) - f->x_start;
+            y_err = get_y_center(child) - f->y_start;
+            if(y_err <= 0) return;    /*It's on the top*/
+            break;
+        case FIND_NEXT_ROW_FIRST_ITEM:
+            y_err = get_y_center(child) - f->y_start;
+            if(y_err <= 0) return;    /*It's on the top*/
+            x_err = lv_obj_get_x(child);
+            break;
+        case FIND_PREV_ROW_LAST_ITEM:
+            y_err = get_y_center(child) - f->y_start;
+            if(y_err >= 0) return;    /*It's on the bottom*/
+            x_err = obj->coords.x2 - child->coords.x2;
+            break;
+        case FIND_FIRST_ROW:
+            x_err = get_x_center(child) - f->x_start;
+            y_err = lv_obj_get_y(child);
+            break;
+        case FIND_LAST_ROW:
+            x_err = get_x_center(child) - f->x_start;
+            y_err = f->h_max - lv_obj_get_y(child);
+    }
+
+    int32_t err = y_err * y_err + x_err * x_err;
+    if(f->guess == NULL || err < f->guess_err || (err == f->guess_err && index < f->guess_index)) {
+        f->guess = child;
+        f->guess_index = index;
+        f->guess_err = err;
+    }
+}
+
+/**
+ * Update the sorted children if the children have changed since the last update
+ * @param obj       the gridnav container
+ * @param dsc       the gridnav descriptor of `obj`
+ * @return          true: `dsc->sorted` can be used; false: out of memory
+ */
+static bool sorted_update(lv_obj_t * obj, lv_gridnav_dsc_t * dsc)
 {
-    lv_coord_t x_start = get_x_center(start_child);
-    lv_coord_t y_start = get_y_center(start_child);
+    uint32_t child_map_ver = _lv_obj_get_child_map_ver(obj);
+    if(dsc->sorted && dsc->child_map_ver == child_map_ver) return true;
+
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-    lv_obj_t * guess = NULL;
-    lv_coord_t x_err_guess = LV_COORD_MAX;
-    lv_coord_t y_err_guess = LV_COORD_MAX;
-    lv_coord_t h_half = lv_obj_get_height(start_child) / 2;
-    lv_coord_t h_max = lv_obj_get_height(obj) + lv_obj_get_scroll_top(obj) + lv_obj_get_scroll_bottom(obj);
+    if(dsc->sorted == NULL || dsc->sorted_cnt != child_cnt) {
+        child_ref_t * sorted = lv_mem_realloc(dsc->sorted, LV_MAX(child_cnt, 1) * sizeof(child_ref_t));
+        LV_ASSERT_MALLOC(sorted);
+        if(sorted == NULL) return false;
+        dsc->sorted = sorted;
+    }
+
+    /*Start from the children's order. They are usually created row by row so it's already sorted.*/
+    uint32_t scrolled_cnt = 0;
+    uint32_t floating_cnt = 0;
     uint32_t i;
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = lv_obj_get_child(obj, i);
-        if(child == start_child) continue;
-        if(obj_is_focuable(child) == false) continue;
-
-        lv_coord_t x_err = 0;
-        lv_coord_t y_err = 0;
-        switch(mode) {
-            case FIND_LEFT:
-                x_err = get_x_center(child) - x_start;
-                y_err = get_y_center(child) - y_start;
-                if(x_err >= 0) continue;    /*It's on the right*/
-                if(LV_ABS(y_err) > h_half) continue;    /*Too far*/
-                break;
-            case FIND_RIGHT:
-                x_err = get_x_center(child) - x_start;
-                y_err = get_y_center(child) - y_start;
-                if(x_err <= 0) continue;    /*It's on the left*/
-                if(LV_ABS(y_err) > h_half) continue;    /*Too far*/
-                break;
-            case FIND_TOP:
-                x_err = get_x_center(child) - x_start;
-                y_err = get_y_center(child) - y_start;
-                if(y_err >= 0) continue;    /*It's on the bottom*/
-                break;
-            case FIND_BOTTOM:
-                x_err = get_x_center(child) - x_start;
-                y_err = get_y_center(child) - y_start;
-                if(y_err <= 0) continue;    /*It's on the top*/
-                break;
-            case FIND_NEXT_ROW_FIRST_ITEM:
-                y_err = get_y_center(child) - y_start;
-                if(y_err <= 0) continue;    /*It's on the top*/
-                x_err = lv_obj_get_x(child);
-                break;
-            case FIND_PREV_ROW_LAST_ITEM:
-                y_err = get_y_center(child) - y_start;
-                if(y_err >= 0) continue;    /*It's on the bottom*/
-                x_err = obj->coords.x2 - child->coords.x2;
-                break;
-            case FIND_FIRST_ROW:
-                x_err = get_x_center(child) - x_start;
-                y_err = lv_obj_get_y(child);
-                break;
-            case FIND_LAST_ROW:
-                x_err = get_x_center(child) - x_start;
-                y_err = h_max - lv_obj_get_y(child);
+        child_ref_t * ref;
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING)) {
+            floating_cnt++;
+            ref = &dsc->sorted[child_cnt - floating_cnt];
+        }
+        else {
+            ref = &dsc->sorted[scrolled_cnt];
+            scrolled_cnt++;
         }
+        ref->obj = child;
+        ref->index = i;
+    }
+    dsc->sorted_cnt = child_cnt;
+    dsc->floating_cnt = floating_cnt;
 
-        if(guess == NULL ||
-           (y_err * y_err + x_err * x_err < y_err_guess * y_err_guess + x_err_guess * x_err_guess)) {
-            guess = child;
-            x_err_guess  = x_err;
-            y_err_guess  = y_err;
+    for(i = 1; i < scrolled_cnt; i++) {
+        if(child_ref_is_less(&dsc->sorted[i], &dsc->sorted[i - 1])) break;
+    }
+
+    if(i < scrolled_cnt) {
+        /*Bottom-up merge sort*/
+        child_ref_t * tmp = lv_mem_buf_get(scrolled_cnt * sizeof(child_ref_t));
+        LV_ASSERT_MALLOC(tmp);
+        if(tmp == NULL) {
+            dsc->sorted_cnt = 0;
+            return false;
         }
+
+        child_ref_t * src = dsc->sorted;
+        child_ref_t * dst = tmp;
+        uint32_t w;
+        for(w = 1; w < scrolled_cnt; w *= 2) {
+            for(i = 0; i < scrolled_cnt; i += 2 * w) {
+                uint32_t mid = LV_MIN(i + w, scrolled_cnt);
+                uint32_t end = LV_MIN(i + 2 * w, scrolled_cnt);
+                uint32_t l = i;
+                uint32_t r = mid;
+                uint32_t k = i;
+                while(l < mid && r < end) {
+                    if(child_ref_is_less(&src[r], &src[l])) dst[k++] = src[r++];
+                    else dst[k++] = src[l++];
+                }
+                while(l < mid) dst[k++] = src[l++];
+                while(r < end) dst[k++] = src[r++];
+            }
+            child_ref_t * t = src;
+            src = dst;
+            dst = t;
+        }
+        if(src != dsc->sorted) lv_memcpy(dsc->sorted, src, scrolled_cnt * sizeof(child_ref_t));
+        lv_mem_buf_release(tmp);
     }
-    return guess;
+
+    dsc->child_map_ver = child_map_ver;
+    return true;
+}
+
+/**
+ * Get the index of the first not floating child in `dsc->sorted` whose center is not above a Y coordinate
+ * @param dsc       the gridnav descriptor
+ * @param y         the Y coordinate
+ * @return          the index or the number of the not floating children if all of them are above `y`
+ */
+static uint32_t sorted_lower_bound(lv_gridnav_dsc_t * dsc, lv_coord_t y)
+{
+    uint32_t lo = 0;
+    uint32_t hi = dsc->sorted_cnt - dsc->floating_cnt;
+    while(lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if(get_y_center(dsc->sorted[mid].obj) < y) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static bool child_ref_is_less(const child_ref_t * a, const child_ref_t * b)
+{
+    lv_coord_t ya = get_y_center(a->obj);
+    lv_coord_t yb = get_y_center(b->obj);
+    if(ya != yb) return ya < yb;
+    return a->index < b->index;
 }
 
 static lv_obj_t * find_first_focusable(lv_obj_t * obj)
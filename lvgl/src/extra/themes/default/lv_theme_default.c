@@ -166,6 +166,12 @@ typedef enum {
  **********************/
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
 static void style_init_reset(lv_style_t * style);
+static lv_color_t dark_color_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t c, lv_opa_t opa);
+static lv_color_t grey_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t color, lv_opa_t opa);
+#if LV_THEME_DEFAULT_CONST
+static bool const_styles_match(lv_disp_t * disp, lv_color_t color_primary, lv_color_t color_secondary, bool dark,
+                               const lv_font_t * font);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -178,6 +184,47 @@ static lv_color_t color_text;
 static lv_color_t color_card;
 static lv_color_t color_grey;
 static bool inited = false;
+static bool const_used = false;
+
+static const lv_style_prop_t trans_props[] = {
+    LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
+    LV_STYLE_TRANSFORM_WIDTH, LV_STYLE_TRANSFORM_HEIGHT,
+    LV_STYLE_TRANSLATE_Y, LV_STYLE_TRANSLATE_X,
+    LV_STYLE_TRANSFORM_ZOOM, LV_STYLE_TRANSFORM_ANGLE,
+    LV_STYLE_COLOR_FILTER_OPA, LV_STYLE_COLOR_FILTER_DSC,
+    0
+};
+
+#if LV_THEME_DEFAULT_CONST
+/*Precompiled styles in flash for the light mode, blue/red palette and `LV_THEME_DEFAULT_FONT` on a large display
+ *with `LV_DPI_DEF`. The description is `lv_theme_default_styles.json`, generate the styles with
+ *`scripts/style_api_gen.py --const-styles lv_theme_default_styles.json -o lv_theme_default_styles_gen.h`*/
+#define DPX(n)              _LV_DPX_CALC(LV_DPI_DEF, n)
+#define COLOR_PRIMARY       LV_COLOR_MAKE(0x21, 0x96, 0xF3)     /*lv_palette_main(LV_PALETTE_BLUE)*/
+#define COLOR_SECONDARY     LV_COLOR_MAKE(0xF4, 0x43, 0x36)     /*lv_palette_main(LV_PALETTE_RED)*/
+#define COLOR_SCR           LV_COLOR_MAKE(0xF5, 0xF5, 0xF5)     /*LIGHT_COLOR_SCR*/
+#define COLOR_CARD          LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)     /*LIGHT_COLOR_CARD*/
+#define COLOR_TEXT          LV_COLOR_MAKE(0x21, 0x21, 0x21)     /*LIGHT_COLOR_TEXT*/
+#define COLOR_GREY          LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)     /*LIGHT_COLOR_GREY*/
+#define COLOR_GREY_MAIN     LV_COLOR_MAKE(0x9E, 0x9E, 0x9E)     /*lv_palette_main(LV_PALETTE_GREY)*/
+#define COLOR_PLACEHOLDER   LV_COLOR_MAKE(0xBD, 0xBD, 0xBD)     /*lv_palette_lighten(LV_PALETTE_GREY, 1)*/
+#define COLOR_WHITE         LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)
+
+#if TRANSITION_TIME
+static const lv_style_transition_dsc_t trans_delayed_const = {
+    .props = trans_props, .path_xcb = lv_anim_path_linear, .time = TRANSITION_TIME, .delay = 70
+};
+static const lv_style_transition_dsc_t trans_normal_const = {
+    .props = trans_props, .path_xcb = lv_anim_path_linear, .time = TRANSITION_TIME, .delay = 0
+};
+#endif
+static const lv_color_filter_dsc_t dark_filter_const = { .filter_cb = dark_color_filter_cb };
+static const lv_color_filter_dsc_t grey_filter_const = { .filter_cb = grey_filter_cb };
+
+#include "lv_theme_default_styles_gen.h"
+
+static bool const_styles_enabled = true;
+#endif
 
 
 /**********************
@@ -204,15 +251,6 @@ static lv_color_t grey_filter_cb(const lv_color_filter_dsc_t * f, lv_color_t col
 
 static void style_init(void)
 {
-    static const lv_style_prop_t trans_props[] = {
-        LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
-        LV_STYLE_TRANSFORM_WIDTH, LV_STYLE_TRANSFORM_HEIGHT,
-        LV_STYLE_TRANSLATE_Y, LV_STYLE_TRANSLATE_X,
-        LV_STYLE_TRANSFORM_ZOOM, LV_STYLE_TRANSFORM_ANGLE,
-        LV_STYLE_COLOR_FILTER_OPA, LV_STYLE_COLOR_FILTER_DSC,
-        0
-    };
-
     color_scr = theme.flags & MODE_DARK ? DARK_COLOR_SCR : LIGHT_COLOR_SCR;
     color_text = theme.flags & MODE_DARK ? DARK_COLOR_TEXT : LIGHT_COLOR_TEXT;
     color_card = theme.flags & MODE_DARK ? DARK_COLOR_CARD : LIGHT_COLOR_CARD;
@@ -648,20 +686,28 @@ static void style_init(void)
 lv_theme_t * lv_theme_default_init(lv_disp_t * disp, lv_color_t color_primary, lv_color_t color_secondary, bool dark,
                                    const lv_font_t * font)
 {
+    if(LV_HOR_RES <= 320) disp_size = DISP_SMALL;
+    else if(LV_HOR_RES < 720) disp_size = DISP_MEDIUM;
+    else disp_size = DISP_LARGE;
+
+#if LV_THEME_DEFAULT_CONST
+    /*The precompiled styles are in flash, nothing to allocate or initialize.
+     *An already allocated runtime set is kept as objects created earlier might still use it.*/
+    const_used = const_styles_match(disp, color_primary, color_secondary, dark, font);
+    if(const_used) styles = (my_theme_styles_t *)&styles_const;
+#endif
 
     /*This trick is required only to avoid the garbage collection of
      *styles' data if LVGL is used in a binding (e.g. Micropython)
      *In a general case styles could be in simple `static lv_style_t my_style...` variables*/
-    if(!lv_theme_default_is_inited()) {
-        inited = false;
-        LV_GC_ROOT(_lv_theme_default_styles) = lv_mem_alloc(sizeof(my_theme_styles_t));
+    if(!const_used) {
+        if(LV_GC_ROOT(_lv_theme_default_styles) == NULL) {
+            inited = false;
+            LV_GC_ROOT(_lv_theme_default_styles) = lv_mem_alloc(sizeof(my_theme_styles_t));
+        }
         styles = (my_theme_styles_t *)LV_GC_ROOT(_lv_theme_default_styles);
     }
 
-    if(LV_HOR_RES <= 320) disp_size = DISP_SMALL;
-    else if(LV_HOR_RES < 720) disp_size = DISP_MEDIUM;
-    else disp_size = DISP_LARGE;
-
     theme.disp = disp;
     theme.color_primary = color_primary;
     theme.color_secondary = color_secondary;
@@ -671,12 +717,13 @@ lv_theme_t * lv_theme_default_init(lv_disp_t * disp, lv_color_t color_primary, l
     theme.apply_cb = theme_apply;
     theme.flags = dark ? MODE_DARK : 0;
 
-    style_init();
+    if(!const_used) {
+        style_init();
+        inited = true;
+    }
 
     if(disp == NULL || lv_disp_get_theme(disp) == &theme) lv_obj_report_style_change(NULL);
 
-    inited = true;
-
     return (lv_theme_t *)&theme;
 }
 
@@ -691,9 +738,22 @@ lv_theme_t * lv_theme_default_get(void)
 
 bool lv_theme_default_is_inited(void)
 {
+    if(const_used) return true;
     return  LV_GC_ROOT(_lv_theme_default_styles) == NULL ? false : true;
 }
 
+#if LV_THEME_DEFAULT_CONST
+void lv_theme_default_use_const(bool en)
+{
+    const_styles_enabled = en;
+}
+
+bool lv_theme_default_is_const(void)
+{
+    return const_used;
+}
+#endif
+
 
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
 {
@@ -1168,6 +1228,20 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_THEME_DEFAULT_CONST
+static bool const_styles_match(lv_disp_t * disp, lv_color_t color_primary, lv_color_t color_secondary, bool dark,
+                               const lv_font_t * font)
+{
+    if(!const_styles_enabled) return false;
+    if(dark || font != LV_THEME_DEFAULT_FONT || disp_size != DISP_LARGE) return false;
+    if(lv_disp_get_dpi(disp) != LV_DPI_DEF) return false;
+    if(lv_color_to32(color_primary) != lv_color_to32(lv_palette_main(LV_PALETTE_BLUE))) return false;
+    if(lv_color_to32(color_secondary) != lv_color_to32(lv_palette_main(LV_PALETTE_RED))) return false;
+
+    return true;
+}
+#endif
+
 static void style_init_reset(lv_style_t * style)
 {
     if(inited) {
@@ -51,6 +51,21 @@ lv_theme_t * lv_theme_default_get(void);
  */
 bool lv_theme_default_is_inited(void);
 
+#if LV_THEME_DEFAULT_CONST
+/**
+ * Enable or disable the precompiled styles. Affects the next `lv_theme_default_init()`.
+ * @param en    true: use the styles in flash if the parameters match them (default);
+ *              false: always build the styles in RAM
+ */
+void lv_theme_default_use_const(bool en);
+
+/**
+ * Check if the default theme uses the precompiled styles
+ * @return true: the styles are in flash; false: the styles are built in RAM
+ */
+bool lv_theme_default_is_const(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,829 @@
+/**
+ * @file lv_theme_default_styles_gen.h
+ * Generated by `scripts/style_api_gen.py --const-styles lv_theme_default_styles.json`. Don't edit.
+ * The properties of the styles are sorted by their ID.
+ */
+
+static const lv_style_const_prop_t styles_const_transition_delayed_props[] = {
+#if TRANSITION_TIME
+    LV_STYLE_CONST_TRANSITION(&trans_delayed_const),
+#endif
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_transition_normal_props[] = {
+#if TRANSITION_TIME
+    LV_STYLE_CONST_TRANSITION(&trans_normal_const),
+#endif
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_scrollbar_props[] = {
+    LV_STYLE_CONST_WIDTH(DPX(5)),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_PAD_TOP(DPX(7)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(7)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(7)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(7)),
+    LV_STYLE_CONST_BG_COLOR(COLOR_GREY_MAIN),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_40),
+#if TRANSITION_TIME
+    LV_STYLE_CONST_TRANSITION(&trans_normal_const),
+#endif
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_scrollbar_scrolled_props[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_scr_props[] = {
+    LV_STYLE_CONST_PAD_ROW(DPX(14)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(14)),
+    LV_STYLE_CONST_BG_COLOR(COLOR_SCR),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_card_props[] = {
+    LV_STYLE_CONST_RADIUS(DPX(12)),
+    LV_STYLE_CONST_PAD_TOP(DPX(24)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(24)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(24)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(24)),
+    LV_STYLE_CONST_PAD_ROW(DPX(14)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(14)),
+    LV_STYLE_CONST_BG_COLOR(COLOR_CARD),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_GREY),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(2)),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(COLOR_GREY_MAIN),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_outline_primary_props[] = {
+    LV_STYLE_CONST_OUTLINE_WIDTH(DPX(3)),
+    LV_STYLE_CONST_OUTLINE_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_OUTLINE_OPA(LV_OPA_50),
+    LV_STYLE_CONST_OUTLINE_PAD(DPX(3)),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_outline_secondary_props[] = {
+    LV_STYLE_CONST_OUTLINE_WIDTH(DPX(3)),
+    LV_STYLE_CONST_OUTLINE_COLOR(COLOR_SECONDARY),
+    LV_STYLE_CONST_OUTLINE_OPA(LV_OPA_50),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_btn_props[] = {
+    LV_STYLE_CONST_RADIUS(DPX(16)),
+    LV_STYLE_CONST_PAD_TOP(DPX(14)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(14)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(24)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(24)),
+    LV_STYLE_CONST_PAD_ROW(DPX(5)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(5)),
+    LV_STYLE_CONST_BG_COLOR(COLOR_GREY),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_SHADOW_WIDTH(DPX(3)),
+    LV_STYLE_CONST_SHADOW_OFS_Y(DPX(DPX(4))),
+    LV_STYLE_CONST_SHADOW_COLOR(COLOR_GREY_MAIN),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_50),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_pressed_props[] = {
+    LV_STYLE_CONST_COLOR_FILTER_DSC(&dark_filter_const),
+    LV_STYLE_CONST_COLOR_FILTER_OPA(35),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_disabled_props[] = {
+    LV_STYLE_CONST_COLOR_FILTER_DSC(&grey_filter_const),
+    LV_STYLE_CONST_COLOR_FILTER_OPA(LV_OPA_50),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_clip_corner_props[] = {
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_BORDER_POST(true),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_pad_normal_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(24)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(24)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(24)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(24)),
+    LV_STYLE_CONST_PAD_ROW(DPX(24)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(24)),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_pad_small_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(14)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(14)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(14)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(14)),
+    LV_STYLE_CONST_PAD_ROW(DPX(14)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(14)),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_pad_gap_props[] = {
+    LV_STYLE_CONST_PAD_ROW(DPX(10)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(10)),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_line_space_large_props[] = {
+    LV_STYLE_CONST_TEXT_LINE_SPACE(DPX(20)),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_text_align_center_props[] = {
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_pad_zero_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_pad_tiny_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(8)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(8)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(8)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(8)),
+    LV_STYLE_CONST_PAD_ROW(DPX(8)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(8)),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_bg_color_primary_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_WHITE),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_bg_color_primary_muted_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_bg_color_secondary_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_SECONDARY),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_WHITE),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_bg_color_secondary_muted_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_SECONDARY),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_SECONDARY),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_bg_color_grey_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_GREY),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_bg_color_white_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_CARD),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_circle_props[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_no_radius_props[] = {
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PROPS_END
+};
+
+#if LV_THEME_DEFAULT_GROW
+static const lv_style_const_prop_t styles_const_grow_props[] = {
+    LV_STYLE_CONST_TRANSFORM_WIDTH(DPX(3)),
+    LV_STYLE_CONST_TRANSFORM_HEIGHT(DPX(3)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+static const lv_style_const_prop_t styles_const_knob_props[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_PAD_TOP(DPX(6)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(6)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(6)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(6)),
+    LV_STYLE_CONST_BG_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_anim_props[] = {
+    LV_STYLE_CONST_ANIM_TIME(200),
+    LV_STYLE_CONST_PROPS_END
+};
+
+static const lv_style_const_prop_t styles_const_anim_fast_props[] = {
+    LV_STYLE_CONST_ANIM_TIME(120),
+    LV_STYLE_CONST_PROPS_END
+};
+
+#if LV_USE_ARC
+static const lv_style_const_prop_t styles_const_arc_indic_props[] = {
+    LV_STYLE_CONST_ARC_WIDTH(DPX(15)),
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_ARC_COLOR(COLOR_GREY),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_ARC
+static const lv_style_const_prop_t styles_const_arc_indic_primary_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_DROPDOWN
+static const lv_style_const_prop_t styles_const_dropdown_list_props[] = {
+    LV_STYLE_CONST_MAX_HEIGHT(LV_DPI_DEF * 2),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CHECKBOX
+static const lv_style_const_prop_t styles_const_cb_marker_props[] = {
+    LV_STYLE_CONST_RADIUS(DPX(12) / 2),
+    LV_STYLE_CONST_PAD_TOP(DPX(3)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(3)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(3)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(3)),
+    LV_STYLE_CONST_BG_COLOR(COLOR_CARD),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(2)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CHECKBOX
+static const lv_style_const_prop_t styles_const_cb_marker_checked_props[] = {
+    LV_STYLE_CONST_BG_IMG_SRC(LV_SYMBOL_OK),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_WHITE),
+    LV_STYLE_CONST_TEXT_FONT(LV_THEME_DEFAULT_FONT),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_SWITCH
+static const lv_style_const_prop_t styles_const_switch_knob_props[] = {
+    LV_STYLE_CONST_PAD_TOP(-DPX(4)),
+    LV_STYLE_CONST_PAD_BOTTOM(-DPX(4)),
+    LV_STYLE_CONST_PAD_LEFT(-DPX(4)),
+    LV_STYLE_CONST_PAD_RIGHT(-DPX(4)),
+    LV_STYLE_CONST_BG_COLOR(COLOR_WHITE),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_LINE
+static const lv_style_const_prop_t styles_const_line_props[] = {
+    LV_STYLE_CONST_LINE_WIDTH(1),
+    LV_STYLE_CONST_LINE_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t styles_const_chart_bg_props[] = {
+    LV_STYLE_CONST_PAD_COLUMN(DPX(10)),
+    LV_STYLE_CONST_BORDER_POST(false),
+    LV_STYLE_CONST_LINE_COLOR(COLOR_GREY),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t styles_const_chart_series_props[] = {
+    LV_STYLE_CONST_WIDTH(DPX(8)),
+    LV_STYLE_CONST_HEIGHT(DPX(8)),
+    LV_STYLE_CONST_RADIUS(DPX(3)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(2)),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(3)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t styles_const_chart_indic_props[] = {
+    LV_STYLE_CONST_WIDTH(DPX(8)),
+    LV_STYLE_CONST_HEIGHT(DPX(8)),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BG_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t styles_const_chart_ticks_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(2)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(2)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(2)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(2)),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(1)),
+    LV_STYLE_CONST_LINE_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_GREY_MAIN),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_bg_props[] = {
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_NONE),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_section_props[] = {
+    LV_STYLE_CONST_RADIUS(DPX(12)),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_BG_COLOR(COLOR_CARD),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_cont_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(14)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(14)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(14)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(14)),
+    LV_STYLE_CONST_PAD_ROW(DPX(14)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(14)),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_BORDER_OPA(LV_OPA_10),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_NONE),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_sidebar_cont_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_BORDER_OPA(LV_OPA_10),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_RIGHT),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_main_cont_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_header_cont_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(8)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(8)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(14)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(14)),
+    LV_STYLE_CONST_PAD_ROW(DPX(14)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(14)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_header_btn_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(8)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(8)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(8)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(8)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_TRANSP),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_TRANSP),
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_page_props[] = {
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_pressed_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_GREY_MAIN),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MENU
+static const lv_style_const_prop_t styles_const_menu_separator_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(8)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(8)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_TRANSP),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_METER
+static const lv_style_const_prop_t styles_const_meter_marker_props[] = {
+    LV_STYLE_CONST_WIDTH(DPX(20)),
+    LV_STYLE_CONST_HEIGHT(DPX(20)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(15)),
+    LV_STYLE_CONST_LINE_WIDTH(DPX(5)),
+    LV_STYLE_CONST_LINE_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_METER
+static const lv_style_const_prop_t styles_const_meter_indic_props[] = {
+    LV_STYLE_CONST_WIDTH(DPX(15)),
+    LV_STYLE_CONST_HEIGHT(DPX(15)),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BG_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_TABLE
+static const lv_style_const_prop_t styles_const_table_cell_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_GREY),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_TOP | LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_TEXTAREA
+static const lv_style_const_prop_t styles_const_ta_cursor_props[] = {
+    LV_STYLE_CONST_PAD_LEFT(-DPX(1)),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_TEXT),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(2)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_LEFT),
+    LV_STYLE_CONST_ANIM_TIME(400),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_TEXTAREA
+static const lv_style_const_prop_t styles_const_ta_placeholder_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(COLOR_PLACEHOLDER),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t styles_const_calendar_btnm_bg_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(14)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(14)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(14)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(14)),
+    LV_STYLE_CONST_PAD_ROW(DPX(14) / 2),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(14) / 2),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t styles_const_calendar_btnm_day_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_CARD),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_GREY),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t styles_const_calendar_header_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(14)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(8)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(14)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(14)),
+    LV_STYLE_CONST_PAD_ROW(DPX(14)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(14)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_COLORWHEEL
+static const lv_style_const_prop_t styles_const_colorwheel_main_props[] = {
+    LV_STYLE_CONST_ARC_WIDTH(DPX(10)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t styles_const_msgbox_btn_bg_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(4)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(4)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(4)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(4)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t styles_const_msgbox_bg_props[] = {
+    LV_STYLE_CONST_MAX_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t styles_const_msgbox_backdrop_bg_props[] = {
+    LV_STYLE_CONST_BG_COLOR(COLOR_GREY_MAIN),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_50),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_KEYBOARD
+static const lv_style_const_prop_t styles_const_keyboard_btn_bg_props[] = {
+    LV_STYLE_CONST_RADIUS(DPX(12)),
+    LV_STYLE_CONST_SHADOW_WIDTH(0),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_TABVIEW
+static const lv_style_const_prop_t styles_const_tab_btn_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_PRIMARY),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(2) * 2),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_TABVIEW
+static const lv_style_const_prop_t styles_const_tab_bg_focus_props[] = {
+    LV_STYLE_CONST_OUTLINE_PAD(-DPX(2)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t styles_const_list_bg_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(DPX(24)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(24)),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t styles_const_list_btn_props[] = {
+    LV_STYLE_CONST_PAD_TOP(DPX(14)),
+    LV_STYLE_CONST_PAD_BOTTOM(DPX(14)),
+    LV_STYLE_CONST_PAD_LEFT(DPX(14)),
+    LV_STYLE_CONST_PAD_RIGHT(DPX(14)),
+    LV_STYLE_CONST_PAD_COLUMN(DPX(14)),
+    LV_STYLE_CONST_BORDER_COLOR(COLOR_GREY),
+    LV_STYLE_CONST_BORDER_WIDTH(DPX(1)),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t styles_const_list_item_grow_props[] = {
+    LV_STYLE_CONST_TRANSFORM_WIDTH(DPX(24)),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+#if LV_USE_LED
+static const lv_style_const_prop_t styles_const_led_props[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BG_COLOR(COLOR_WHITE),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BG_GRAD_COLOR(COLOR_GREY_MAIN),
+    LV_STYLE_CONST_SHADOW_WIDTH(DPX(15)),
+    LV_STYLE_CONST_SHADOW_SPREAD(DPX(5)),
+    LV_STYLE_CONST_SHADOW_COLOR(COLOR_WHITE),
+    LV_STYLE_CONST_PROPS_END
+};
+#endif
+
+static const my_theme_styles_t styles_const = {
+    .transition_delayed = LV_STYLE_CONST_SORTED(styles_const_transition_delayed_props, 0x40),
+    .transition_normal = LV_STYLE_CONST_SORTED(styles_const_transition_normal_props, 0x40),
+    .scrollbar = LV_STYLE_CONST_SORTED(styles_const_scrollbar_props, 0x47),
+    .scrollbar_scrolled = LV_STYLE_CONST_SORTED(styles_const_scrollbar_scrolled_props, 0x04),
+    .scr = LV_STYLE_CONST_SORTED(styles_const_scr_props, 0x26),
+    .card = LV_STYLE_CONST_SORTED(styles_const_card_props, 0x3F),
+    .outline_primary = LV_STYLE_CONST_SORTED(styles_const_outline_primary_props, 0x08),
+    .outline_secondary = LV_STYLE_CONST_SORTED(styles_const_outline_secondary_props, 0x08),
+    .btn = LV_STYLE_CONST_SORTED(styles_const_btn_props, 0x37),
+    .pressed = LV_STYLE_CONST_SORTED(styles_const_pressed_props, 0x40),
+    .disabled = LV_STYLE_CONST_SORTED(styles_const_disabled_props, 0x40),
+    .clip_corner = LV_STYLE_CONST_SORTED(styles_const_clip_corner_props, 0x0A),
+    .pad_normal = LV_STYLE_CONST_SORTED(styles_const_pad_normal_props, 0x02),
+    .pad_small = LV_STYLE_CONST_SORTED(styles_const_pad_small_props, 0x02),
+    .pad_gap = LV_STYLE_CONST_SORTED(styles_const_pad_gap_props, 0x02),
+    .line_space_large = LV_STYLE_CONST_SORTED(styles_const_line_space_large_props, 0x20),
+    .text_align_center = LV_STYLE_CONST_SORTED(styles_const_text_align_center_props, 0x20),
+    .pad_zero = LV_STYLE_CONST_SORTED(styles_const_pad_zero_props, 0x02),
+    .pad_tiny = LV_STYLE_CONST_SORTED(styles_const_pad_tiny_props, 0x02),
+    .bg_color_primary = LV_STYLE_CONST_SORTED(styles_const_bg_color_primary_props, 0x24),
+    .bg_color_primary_muted = LV_STYLE_CONST_SORTED(styles_const_bg_color_primary_muted_props, 0x24),
+    .bg_color_secondary = LV_STYLE_CONST_SORTED(styles_const_bg_color_secondary_props, 0x24),
+    .bg_color_secondary_muted = LV_STYLE_CONST_SORTED(styles_const_bg_color_secondary_muted_props, 0x24),
+    .bg_color_grey = LV_STYLE_CONST_SORTED(styles_const_bg_color_grey_props, 0x24),
+    .bg_color_white = LV_STYLE_CONST_SORTED(styles_const_bg_color_white_props, 0x24),
+    .circle = LV_STYLE_CONST_SORTED(styles_const_circle_props, 0x01),
+    .no_radius = LV_STYLE_CONST_SORTED(styles_const_no_radius_props, 0x01),
+#if LV_THEME_DEFAULT_GROW
+    .grow = LV_STYLE_CONST_SORTED(styles_const_grow_props, 0x40),
+#endif
+    .knob = LV_STYLE_CONST_SORTED(styles_const_knob_props, 0x07),
+    .anim = LV_STYLE_CONST_SORTED(styles_const_anim_props, 0x40),
+    .anim_fast = LV_STYLE_CONST_SORTED(styles_const_anim_fast_props, 0x40),
+#if LV_USE_ARC
+    .arc_indic = LV_STYLE_CONST_SORTED(styles_const_arc_indic_props, 0x20),
+#endif
+#if LV_USE_ARC
+    .arc_indic_primary = LV_STYLE_CONST_SORTED(styles_const_arc_indic_primary_props, 0x20),
+#endif
+#if LV_USE_DROPDOWN
+    .dropdown_list = LV_STYLE_CONST_SORTED(styles_const_dropdown_list_props, 0x01),
+#endif
+#if LV_USE_CHECKBOX
+    .cb_marker = LV_STYLE_CONST_SORTED(styles_const_cb_marker_props, 0x0F),
+#endif
+#if LV_USE_CHECKBOX
+    .cb_marker_checked = LV_STYLE_CONST_SORTED(styles_const_cb_marker_checked_props, 0x24),
+#endif
+#if LV_USE_SWITCH
+    .switch_knob = LV_STYLE_CONST_SORTED(styles_const_switch_knob_props, 0x06),
+#endif
+#if LV_USE_LINE
+    .line = LV_STYLE_CONST_SORTED(styles_const_line_props, 0x10),
+#endif
+#if LV_USE_CHART
+    .chart_bg = LV_STYLE_CONST_SORTED(styles_const_chart_bg_props, 0x1A),
+#endif
+#if LV_USE_CHART
+    .chart_series = LV_STYLE_CONST_SORTED(styles_const_chart_series_props, 0x13),
+#endif
+#if LV_USE_CHART
+    .chart_indic = LV_STYLE_CONST_SORTED(styles_const_chart_indic_props, 0x05),
+#endif
+#if LV_USE_CHART
+    .chart_ticks = LV_STYLE_CONST_SORTED(styles_const_chart_ticks_props, 0x32),
+#endif
+#if LV_USE_MENU
+    .menu_bg = LV_STYLE_CONST_SORTED(styles_const_menu_bg_props, 0x0B),
+#endif
+#if LV_USE_MENU
+    .menu_section = LV_STYLE_CONST_SORTED(styles_const_menu_section_props, 0x27),
+#endif
+#if LV_USE_MENU
+    .menu_cont = LV_STYLE_CONST_SORTED(styles_const_menu_cont_props, 0x0A),
+#endif
+#if LV_USE_MENU
+    .menu_sidebar_cont = LV_STYLE_CONST_SORTED(styles_const_menu_sidebar_cont_props, 0x0A),
+#endif
+#if LV_USE_MENU
+    .menu_main_cont = LV_STYLE_CONST_SORTED(styles_const_menu_main_cont_props, 0x02),
+#endif
+#if LV_USE_MENU
+    .menu_header_cont = LV_STYLE_CONST_SORTED(styles_const_menu_header_cont_props, 0x02),
+#endif
+#if LV_USE_MENU
+    .menu_header_btn = LV_STYLE_CONST_SORTED(styles_const_menu_header_btn_props, 0x36),
+#endif
+#if LV_USE_MENU
+    .menu_page = LV_STYLE_CONST_SORTED(styles_const_menu_page_props, 0x02),
+#endif
+#if LV_USE_MENU
+    .menu_pressed = LV_STYLE_CONST_SORTED(styles_const_menu_pressed_props, 0x04),
+#endif
+#if LV_USE_MENU
+    .menu_separator = LV_STYLE_CONST_SORTED(styles_const_menu_separator_props, 0x06),
+#endif
+#if LV_USE_METER
+    .meter_marker = LV_STYLE_CONST_SORTED(styles_const_meter_marker_props, 0x13),
+#endif
+#if LV_USE_METER
+    .meter_indic = LV_STYLE_CONST_SORTED(styles_const_meter_indic_props, 0x05),
+#endif
+#if LV_USE_TABLE
+    .table_cell = LV_STYLE_CONST_SORTED(styles_const_table_cell_props, 0x08),
+#endif
+#if LV_USE_TEXTAREA
+    .ta_cursor = LV_STYLE_CONST_SORTED(styles_const_ta_cursor_props, 0x4A),
+#endif
+#if LV_USE_TEXTAREA
+    .ta_placeholder = LV_STYLE_CONST_SORTED(styles_const_ta_placeholder_props, 0x20),
+#endif
+#if LV_USE_CALENDAR
+    .calendar_btnm_bg = LV_STYLE_CONST_SORTED(styles_const_calendar_btnm_bg_props, 0x02),
+#endif
+#if LV_USE_CALENDAR
+    .calendar_btnm_day = LV_STYLE_CONST_SORTED(styles_const_calendar_btnm_day_props, 0x0C),
+#endif
+#if LV_USE_CALENDAR
+    .calendar_header = LV_STYLE_CONST_SORTED(styles_const_calendar_header_props, 0x02),
+#endif
+#if LV_USE_COLORWHEEL
+    .colorwheel_main = LV_STYLE_CONST_SORTED(styles_const_colorwheel_main_props, 0x20),
+#endif
+#if LV_USE_MSGBOX
+    .msgbox_btn_bg = LV_STYLE_CONST_SORTED(styles_const_msgbox_btn_bg_props, 0x02),
+#endif
+#if LV_USE_MSGBOX
+    .msgbox_bg = LV_STYLE_CONST_SORTED(styles_const_msgbox_bg_props, 0x01),
+#endif
+#if LV_USE_MSGBOX
+    .msgbox_backdrop_bg = LV_STYLE_CONST_SORTED(styles_const_msgbox_backdrop_bg_props, 0x04),
+#endif
+#if LV_USE_KEYBOARD
+    .keyboard_btn_bg = LV_STYLE_CONST_SORTED(styles_const_keyboard_btn_bg_props, 0x11),
+#endif
+#if LV_USE_TABVIEW
+    .tab_btn = LV_STYLE_CONST_SORTED(styles_const_tab_btn_props, 0x08),
+#endif
+#if LV_USE_TABVIEW
+    .tab_bg_focus = LV_STYLE_CONST_SORTED(styles_const_tab_bg_focus_props, 0x08),
+#endif
+#if LV_USE_LIST
+    .list_bg = LV_STYLE_CONST_SORTED(styles_const_list_bg_props, 0x02),
+#endif
+#if LV_USE_LIST
+    .list_btn = LV_STYLE_CONST_SORTED(styles_const_list_btn_props, 0x0A),
+#endif
+#if LV_USE_LIST
+    .list_item_grow = LV_STYLE_CONST_SORTED(styles_const_list_item_grow_props, 0x40),
+#endif
+#if LV_USE_LED
+    .led = LV_STYLE_CONST_SORTED(styles_const_led_props, 0x15),
+#endif
+};
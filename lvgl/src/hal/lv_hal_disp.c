@@ -205,7 +205,7 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t * driver)
 #if LV_USE_THEME_DEFAULT
     if(lv_theme_default_is_inited() == false) {
         disp->theme = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
-                                            LV_THEME_DEFAULT_DARK, LV_FONT_DEFAULT);
+                                            LV_THEME_DEFAULT_DARK, LV_THEME_DEFAULT_FONT);
     }
     else {
         disp->theme = lv_theme_default_get();
@@ -310,6 +310,12 @@ void lv_disp_remove(lv_disp_t * disp)
 
     _lv_ll_remove(&LV_GC_ROOT(_lv_disp_ll), disp);
     if(disp->refr_timer) lv_timer_del(disp->refr_timer);
+#if LV_USE_DISP_PAN
+    lv_mem_free(disp->pan_buf);
+#endif
+#if LV_USE_DISP_FADE
+    lv_mem_free(disp->fade_buf);
+#endif
     lv_mem_free(disp);
 
     if(was_default) lv_disp_set_default(_lv_ll_get_head(&LV_GC_ROOT(_lv_disp_ll)));
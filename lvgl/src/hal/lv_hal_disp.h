@@ -136,6 +136,44 @@ typedef struct _lv_disp_drv_t {
     /** OPTIONAL: called when start rendering */
     void (*render_start_cb)(struct _lv_disp_drv_t * disp_drv);
 
+#if LV_USE_DISP_PAN
+    /** OPTIONAL: Show `hor_res` x `ver_res` pixels from `buf` whose lines are `stride` pixels long,
+     * e.g. by setting the address and the pitch of a layer in the display controller.
+     * Called with `buf == NULL` when the panning ends: return to the normal buffers in the next `flush_cb`.*/
+    void (*pan_cb)(struct _lv_disp_drv_t * disp_drv, const lv_color_t * buf, lv_coord_t stride);
+#endif
+
+#if LV_USE_DISP_OVERLAY
+    /** OPTIONAL: `hor_res` x `ver_res` ARGB4444 pixels blended onto the screen by the display controller.
+     * If set, the top and system layers are rendered here instead of the screen.*/
+    uint16_t * overlay_buf;
+
+    /** OPTIONAL: Called when an area of `overlay_buf` was updated, e.g. to clean the cache*/
+    void (*overlay_flush_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area);
+
+    /** OPTIONAL: Called after the overlay was updated with the area which contains everything drawn
+     * on the top and system layers, or `NULL` if they are empty, e.g. to show only this part of the overlay*/
+    void (*overlay_area_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area);
+#endif
+
+#if LV_USE_DISP_FADE
+    /** OPTIONAL: Show the `over` screen with `opa` opacity on the `under` screen, e.g. with two layers
+     * of the display controller. Both are `hor_res` x `ver_res` pixels and contain the top and system layers too.
+     * Called with `under == NULL` when the fade ends: return to the normal buffers in the next `flush_cb`.*/
+    void (*fade_cb)(struct _lv_disp_drv_t * disp_drv, const lv_color_t * under, const lv_color_t * over, lv_opa_t opa);
+#endif
+
+#if LV_USE_DISP_BEAM
+    /** OPTIONAL: Return the line the display is scanning now and the number of the frame in `frame`.
+     * Lines from `ver_res` mean blanking, the frame number is incremented when line 0 is scanned again.
+     * If set with `direct_mode` and one buffer, the areas are rendered in bands after the display has scanned them.*/
+    lv_coord_t (*scan_line_cb)(struct _lv_disp_drv_t * disp_drv, uint32_t * frame);
+
+    /** OPTIONAL: Wait until the display scans `line`, e.g. with a line interrupt of the display controller.
+     * If not set `wait_cb` is called while `scan_line_cb` is polled.*/
+    void (*scan_wait_cb)(struct _lv_disp_drv_t * disp_drv, lv_coord_t line);
+#endif
+
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_CHROMA_KEY` by default. (lv_conf.h)*/
     lv_color_t color_chroma_key;
@@ -189,6 +227,41 @@ uint8_t del_prev  :
     uint16_t inv_p;
     int32_t inv_en_cnt;
 
+#if LV_USE_SCROLL_BLIT
+    /** Pixels to move before the next refresh*/
+    lv_area_t blit_area;            /**< The visible area of the scrolled object*/
+    lv_point_t blit_ofs;            /**< Move the pixels by this much*/
+    uint8_t blit_pending : 1;
+
+    /** The areas changed in the last frame. With two buffers in direct mode they are copied to the other buffer.*/
+    lv_area_t sync_areas[LV_INV_BUF_SIZE + 1];
+    uint16_t sync_p;
+#endif
+
+#if LV_USE_DISP_PAN
+    /** The two screens are shown by `pan_cb` from this buffer instead of rendering them*/
+    lv_color_t * pan_buf;           /**< The outgoing and incoming screens next to each other*/
+    struct _lv_obj_t * pan_obj;     /**< The moved screen or the scrolled object, NULL: not panning*/
+    lv_coord_t pan_sum;             /**< The content has moved this much horizontally*/
+    int8_t pan_dir;                 /**< 1: the incoming screen is on the right; -1: on the left*/
+#endif
+
+#if LV_USE_DISP_OVERLAY
+    /** Invalidated areas of the overlay*/
+    lv_area_t overlay_inv_areas[LV_INV_BUF_SIZE];
+    uint16_t overlay_inv_p;
+#endif
+
+#if LV_USE_DISP_FADE
+    /** The two screens are shown by `fade_cb` from this buffer instead of rendering them*/
+    lv_color_t * fade_buf;          /**< The screen below and the fading screen after each other*/
+    struct _lv_obj_t * fade_obj;    /**< The screen whose opacity is animated, NULL: not fading*/
+#endif
+
+#if LV_USE_DISP_BEAM
+    uint32_t beam_tear_cnt;         /**< Number of bands rendered so late that the display could show them half drawn*/
+#endif
+
     /*Miscellaneous data*/
     uint32_t last_activity_time;        /**< Last time when there was activity on this display*/
 } lv_disp_t;
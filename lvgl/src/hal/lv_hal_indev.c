@@ -13,6 +13,7 @@
 #include "../core/lv_indev.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_latency_trace.h"
 #include "lv_hal_disp.h"
 
 /*********************
@@ -65,6 +66,10 @@ void lv_indev_drv_init(lv_indev_drv_t * driver)
     driver->long_press_repeat_time  = LV_INDEV_DEF_LONG_PRESS_REP_TIME;
     driver->gesture_limit        = LV_INDEV_DEF_GESTURE_LIMIT;
     driver->gesture_min_velocity = LV_INDEV_DEF_GESTURE_MIN_VELOCITY;
+#if LV_INDEV_MULTI_TOUCH_MAX
+    driver->pinch_limit          = LV_INDEV_DEF_PINCH_LIMIT;
+    driver->rotate_limit         = LV_INDEV_DEF_ROTATE_LIMIT;
+#endif
 }
 
 /**
@@ -184,6 +189,7 @@ void _lv_indev_read(lv_indev_t * indev, lv_indev_data_t * data)
     if(indev->driver->read_cb) {
         INDEV_TRACE("calling indev_read_cb");
         indev->driver->read_cb(indev->driver, data);
+        if(indev->driver->type == LV_INDEV_TYPE_POINTER) LV_LATENCY_TRACE_POINT(LV_LATENCY_TRACE_INDEV_READ);
     }
     else {
         LV_LOG_WARN("indev_read_cb is not registered");
@@ -21,6 +21,7 @@ extern "C" {
 #include <stdint.h>
 #include "../misc/lv_area.h"
 #include "../misc/lv_timer.h"
+#include "../misc/lv_point_filter.h"
 
 /*********************
  *      DEFINES
@@ -47,6 +48,12 @@ extern "C" {
 /*Gesture min velocity at release before swipe (pixels)*/
 #define LV_INDEV_DEF_GESTURE_MIN_VELOCITY 3
 
+/*Change of the distance of two touch points in pixels to detect pinch*/
+#define LV_INDEV_DEF_PINCH_LIMIT          20
+
+/*Rotation of two touch points in degrees to detect rotate*/
+#define LV_INDEV_DEF_ROTATE_LIMIT         10
+
 
 /**********************
  *      TYPEDEFS
@@ -73,6 +80,32 @@ typedef enum {
     LV_INDEV_STATE_PRESSED
 } lv_indev_state_t;
 
+#if LV_INDEV_MULTI_TOUCH_MAX
+/** A touch point of a multi-touch input device*/
+typedef struct {
+    lv_point_t point;
+    uint8_t id;     /**< Tracking ID, the same while the finger touches*/
+} lv_indev_touch_t;
+
+/** State of the two finger gesture of an input device*/
+typedef struct {
+    struct _lv_obj_t * obj;         /**< Receives the events*/
+    lv_point_t points[2];           /**< The last points of the two tracked touches*/
+    lv_point_t start_center;        /**< Midpoint of the touches when the tracking started*/
+    lv_point_t last_center;         /**< Midpoint at the last event*/
+    int32_t start_dist;             /**< Distance of the touches [1/256 px]*/
+    int32_t last_dist;
+    int16_t start_angle;            /**< Angle of the line of the touches [deg]*/
+    int16_t last_angle;
+    uint8_t ids[2];                 /**< Tracking IDs of the two touches*/
+    uint8_t tracking : 1;           /**< Two touches are tracked*/
+    uint8_t began : 1;              /**< LV_EVENT_MULTI_GESTURE has been sent*/
+    uint8_t changed : 1;            /**< The points have changed since the last event*/
+    uint8_t ended : 1;              /**< A tracked touch has been lifted, send the end*/
+    uint8_t types : 3;              /**< The recognized gestures, `LV_MULTI_GESTURE_...`*/
+} _lv_indev_multi_touch_t;
+#endif
+
 /** Data structure passed to an input driver to fill*/
 typedef struct {
     lv_point_t point; /**< For LV_INDEV_TYPE_POINTER the currently pressed point*/
@@ -82,6 +115,11 @@ typedef struct {
 
     lv_indev_state_t state; /**< LV_INDEV_STATE_REL or LV_INDEV_STATE_PR*/
     bool continue_reading;  /**< If set to true, the read callback is invoked again*/
+    uint32_t timestamp;     /**< When the data was sampled (`lv_tick_get()`), 0: at the read*/
+#if LV_INDEV_MULTI_TOUCH_MAX
+    uint8_t touch_cnt;      /**< For LV_INDEV_TYPE_POINTER the number of the touches in `touches`*/
+    lv_indev_touch_t touches[LV_INDEV_MULTI_TOUCH_MAX]; /**< All the touches, `point` is still the primary one*/
+#endif
 } lv_indev_data_t;
 
 /** Initialized by the user and registered by 'lv_indev_add()'*/
@@ -124,6 +162,19 @@ typedef struct _lv_indev_drv_t {
 
     /**< Repeated trigger period in long press [ms]*/
     uint16_t long_press_repeat_time;
+
+#if LV_USE_INDEV_FILTER
+    /**< Smoothing and prediction of the points of LV_INDEV_TYPE_POINTER. All 0 (default): disabled*/
+    lv_point_filter_cfg_t filter;
+#endif
+
+#if LV_INDEV_MULTI_TOUCH_MAX
+    /**< At least this change of the distance of two touches is a pinch*/
+    uint8_t pinch_limit;
+
+    /**< At least this rotation [deg] of two touches is a rotate*/
+    uint8_t rotate_limit;
+#endif
 } lv_indev_drv_t;
 
 /** Run time data of input devices
@@ -154,6 +205,12 @@ typedef struct _lv_indev_proc_t {
             lv_area_t scroll_area;
 
             lv_point_t gesture_sum; /*Count the gesture pixels to check LV_INDEV_DEF_GESTURE_LIMIT*/
+#if LV_USE_INDEV_FILTER
+            lv_point_filter_t filter;
+#endif
+#if LV_INDEV_MULTI_TOUCH_MAX
+            _lv_indev_multi_touch_t multi_touch;
+#endif
             /*Flags*/
             lv_dir_t scroll_dir : 4;
             lv_dir_t gesture_dir : 4;
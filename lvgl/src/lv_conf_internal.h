@@ -157,6 +157,44 @@
         #endif
     #endif
 
+    /*Use a second, "bulk" memory pool (e.g. in external SDRAM) for large or rarely used data
+     *such as layers, decoded images, caches and table cells. Small objects stay in the main pool above.*/
+    #ifndef LV_MEM_EXT
+        #ifdef CONFIG_LV_MEM_EXT
+            #define LV_MEM_EXT CONFIG_LV_MEM_EXT
+        #else
+            #define LV_MEM_EXT 0
+        #endif
+    #endif
+    #if LV_MEM_EXT
+        /*Size of the bulk memory pool in bytes*/
+        #ifndef LV_MEM_EXT_SIZE
+            #ifdef CONFIG_LV_MEM_EXT_SIZE
+                #define LV_MEM_EXT_SIZE CONFIG_LV_MEM_EXT_SIZE
+            #else
+                #define LV_MEM_EXT_SIZE (1024U * 1024U)
+            #endif
+        #endif
+
+        /*Set an address for the bulk pool instead of allocating it as a normal array.*/
+        #ifndef LV_MEM_EXT_ADR
+            #ifdef CONFIG_LV_MEM_EXT_ADR
+                #define LV_MEM_EXT_ADR CONFIG_LV_MEM_EXT_ADR
+            #else
+                #define LV_MEM_EXT_ADR 0     /*0: unused*/
+            #endif
+        #endif
+
+        /*Allocations without explicit hint and at least this large go to the bulk pool*/
+        #ifndef LV_MEM_EXT_THRESHOLD
+            #ifdef CONFIG_LV_MEM_EXT_THRESHOLD
+                #define LV_MEM_EXT_THRESHOLD CONFIG_LV_MEM_EXT_THRESHOLD
+            #else
+                #define LV_MEM_EXT_THRESHOLD (2U * 1024U)
+            #endif
+        #endif
+    #endif
+
 #else       /*LV_MEM_CUSTOM*/
     #ifndef LV_MEM_CUSTOM_INCLUDE
         #ifdef CONFIG_LV_MEM_CUSTOM_INCLUDE
@@ -198,6 +236,30 @@
     #endif
 #endif
 
+/*Size of a scratch arena used by `lv_mem_buf_get()` while an area is being rendered.
+ *Buffers are bump allocated from it and all of them are dropped when the area is ready,
+ *so rendering doesn't touch the heap at all. Requests which don't fit use the buffers above.
+ *0: disable the arena*/
+#ifndef LV_MEM_SCRATCH_SIZE
+    #ifdef CONFIG_LV_MEM_SCRATCH_SIZE
+        #define LV_MEM_SCRATCH_SIZE CONFIG_LV_MEM_SCRATCH_SIZE
+    #else
+        #define LV_MEM_SCRATCH_SIZE 0
+    #endif
+#endif
+
+/*Size of the region used by the slab allocator in bytes.
+ *Small allocations (objects, style arrays, animations, timers, event descriptors, ...) are served
+ *from 1 kB pages cut into fixed size blocks, so they are allocated and freed in O(1) and don't fragment the heap.
+ *Larger ones and the ones which don't fit go to the heap. 0: disable the slab allocator*/
+#ifndef LV_MEM_SLAB_SIZE
+    #ifdef CONFIG_LV_MEM_SLAB_SIZE
+        #define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+    #else
+        #define LV_MEM_SLAB_SIZE 0
+    #endif
+#endif
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #ifndef LV_MEMCPY_MEMSET_STD
     #ifdef CONFIG_LV_MEMCPY_MEMSET_STD
@@ -220,6 +282,66 @@
     #endif
 #endif
 
+/*1: In `direct_mode` move the rendered pixels of the objects with `LV_OBJ_FLAG_SCROLL_BLIT` when they are scrolled
+ *and redraw only the exposed part. With two buffers LVGL also copies the changes of the last frame to the other buffer.*/
+#ifndef LV_USE_SCROLL_BLIT
+    #ifdef CONFIG_LV_USE_SCROLL_BLIT
+        #define LV_USE_SCROLL_BLIT CONFIG_LV_USE_SCROLL_BLIT
+    #else
+        #define LV_USE_SCROLL_BLIT 0
+    #endif
+#endif
+
+/*1: Show the horizontal `LV_SCR_LOAD_ANIM_MOVE_LEFT/RIGHT` screen loads and the scrolling of full-screen objects
+ *with `LV_OBJ_FLAG_SCROLL_PAN` (e.g. tileviews) by panning pre-rendered screens with the `pan_cb` of the display driver*/
+#ifndef LV_USE_DISP_PAN
+    #ifdef CONFIG_LV_USE_DISP_PAN
+        #define LV_USE_DISP_PAN CONFIG_LV_USE_DISP_PAN
+    #else
+        #define LV_USE_DISP_PAN 0
+    #endif
+#endif
+
+/*1: Render the top and system layers into the ARGB4444 `overlay_buf` of the display driver instead of the screen.
+ *The display controller blends it onto the screen (e.g. with a second LTDC layer), so overlays don't redraw the screen*/
+#ifndef LV_USE_DISP_OVERLAY
+    #ifdef CONFIG_LV_USE_DISP_OVERLAY
+        #define LV_USE_DISP_OVERLAY CONFIG_LV_USE_DISP_OVERLAY
+    #else
+        #define LV_USE_DISP_OVERLAY 0
+    #endif
+#endif
+
+/*1: Show the `LV_SCR_LOAD_ANIM_FADE_IN/OUT` screen loads by rendering both screens once and
+ *changing only the opacity of a display controller layer with the `fade_cb` of the display driver*/
+#ifndef LV_USE_DISP_FADE
+    #ifdef CONFIG_LV_USE_DISP_FADE
+        #define LV_USE_DISP_FADE CONFIG_LV_USE_DISP_FADE
+    #else
+        #define LV_USE_DISP_FADE 0
+    #endif
+#endif
+
+/*1: With `direct_mode` and one buffer render the invalidated areas in horizontal bands right behind the scanning
+ *of the display (see `scan_line_cb` of the display driver), so a single frame buffer is enough without tearing*/
+#ifndef LV_USE_DISP_BEAM
+    #ifdef CONFIG_LV_USE_DISP_BEAM
+        #define LV_USE_DISP_BEAM CONFIG_LV_USE_DISP_BEAM
+    #else
+        #define LV_USE_DISP_BEAM 0
+    #endif
+#endif
+#if LV_USE_DISP_BEAM
+    /*Height of a band in lines*/
+    #ifndef LV_DISP_BEAM_BAND_H
+        #ifdef CONFIG_LV_DISP_BEAM_BAND_H
+            #define LV_DISP_BEAM_BAND_H CONFIG_LV_DISP_BEAM_BAND_H
+        #else
+            #define LV_DISP_BEAM_BAND_H 64
+        #endif
+    #endif
+#endif
+
 /*Input device read period in milliseconds*/
 #ifndef LV_INDEV_DEF_READ_PERIOD
     #ifdef CONFIG_LV_INDEV_DEF_READ_PERIOD
@@ -229,6 +351,26 @@
     #endif
 #endif
 
+/*1: Add a One-Euro filter and a linear prediction stage to the pointer input devices.
+ *Enable it for an input device by setting `filter` in its `lv_indev_drv_t`*/
+#ifndef LV_USE_INDEV_FILTER
+    #ifdef CONFIG_LV_USE_INDEV_FILTER
+        #define LV_USE_INDEV_FILTER CONFIG_LV_USE_INDEV_FILTER
+    #else
+        #define LV_USE_INDEV_FILTER 0
+    #endif
+#endif
+
+/*Max. number of touch points read from the pointer input devices (e.g. 5 for GT911), 0: disable.
+ *Pinch, rotate and pan with two fingers are sent as `LV_EVENT_MULTI_GESTURE` once in every refresh period*/
+#ifndef LV_INDEV_MULTI_TOUCH_MAX
+    #ifdef CONFIG_LV_INDEV_MULTI_TOUCH_MAX
+        #define LV_INDEV_MULTI_TOUCH_MAX CONFIG_LV_INDEV_MULTI_TOUCH_MAX
+    #else
+        #define LV_INDEV_MULTI_TOUCH_MAX 0
+    #endif
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #ifndef LV_TICK_CUSTOM
@@ -764,6 +906,61 @@
     #endif
 #endif
 
+/*1: Record every `lv_mem_alloc/realloc/free` with the caller's address, size and frame number
+ *as a binary stream. Start it with `lv_mem_profiler_start(write_cb)` and process the output
+ *with `scripts/lv_mem_profile.py` to see peak usage, churn and leaks per call site*/
+#ifndef LV_USE_MEM_PROFILER
+    #ifdef CONFIG_LV_USE_MEM_PROFILER
+        #define LV_USE_MEM_PROFILER CONFIG_LV_USE_MEM_PROFILER
+    #else
+        #define LV_USE_MEM_PROFILER 0
+    #endif
+#endif
+#if LV_USE_MEM_PROFILER
+    /*Size of the buffer collecting the records before they are passed to the write callback [bytes]*/
+    #ifndef LV_MEM_PROFILER_BUF_SIZE
+        #ifdef CONFIG_LV_MEM_PROFILER_BUF_SIZE
+            #define LV_MEM_PROFILER_BUF_SIZE CONFIG_LV_MEM_PROFILER_BUF_SIZE
+        #else
+            #define LV_MEM_PROFILER_BUF_SIZE 256
+        #endif
+    #endif
+#endif
+
+/*1: Measure the latency from an input event to the display showing its result (e.g. touch-to-photon).
+ *LVGL and the port mark the steps of the path with `lv_latency_trace_point()` and
+ *`lv_latency_trace_report()` prints the min/mean/max and a histogram of the latency of each step*/
+#ifndef LV_USE_LATENCY_TRACE
+    #ifdef CONFIG_LV_USE_LATENCY_TRACE
+        #define LV_USE_LATENCY_TRACE CONFIG_LV_USE_LATENCY_TRACE
+    #else
+        #define LV_USE_LATENCY_TRACE 0
+    #endif
+#endif
+#if LV_USE_LATENCY_TRACE
+    #ifndef LV_LATENCY_TRACE_TIME_INCLUDE
+        #ifdef CONFIG_LV_LATENCY_TRACE_TIME_INCLUDE
+            #define LV_LATENCY_TRACE_TIME_INCLUDE CONFIG_LV_LATENCY_TRACE_TIME_INCLUDE
+        #else
+            #define LV_LATENCY_TRACE_TIME_INCLUDE <stdint.h>    /*Header for the time stamp expression*/
+        #endif
+    #endif
+    #ifndef LV_LATENCY_TRACE_TIME_EXPR
+        #ifdef CONFIG_LV_LATENCY_TRACE_TIME_EXPR
+            #define LV_LATENCY_TRACE_TIME_EXPR CONFIG_LV_LATENCY_TRACE_TIME_EXPR
+        #else
+            #define LV_LATENCY_TRACE_TIME_EXPR (lv_tick_get())  /*Expression evaluating to a free running 32 bit time stamp*/
+        #endif
+    #endif
+    #ifndef LV_LATENCY_TRACE_TIME_FREQ
+        #ifdef CONFIG_LV_LATENCY_TRACE_TIME_FREQ
+            #define LV_LATENCY_TRACE_TIME_FREQ CONFIG_LV_LATENCY_TRACE_TIME_FREQ
+        #else
+            #define LV_LATENCY_TRACE_TIME_FREQ 1000             /*Frequency of the time stamp [Hz]*/
+        #endif
+    #endif
+#endif
+
 /*1: Draw random colored rectangles over the redrawn areas*/
 #ifndef LV_USE_REFR_DEBUG
     #ifdef CONFIG_LV_USE_REFR_DEBUG
@@ -825,6 +1022,80 @@
     #endif
 #endif
 
+/*Cache the resolved style properties of the objects to speed up `lv_obj_get_style_...()`.
+ *The number of entries per object (power of 2), 0: disable.*/
+#ifndef LV_OBJ_STYLE_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+        #define LV_OBJ_STYLE_CACHE_SIZE CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*Number of objects which can have a cache at the same time. The least recently read object loses it first.
+     *The caches are a static array of `LV_OBJ_STYLE_CACHE_OBJ_CNT * (12 + 8 * LV_OBJ_STYLE_CACHE_SIZE)` bytes,
+     *they don't use the heap. A change drops only the values of the affected objects and their children.*/
+    #ifndef LV_OBJ_STYLE_CACHE_OBJ_CNT
+        #ifdef CONFIG_LV_OBJ_STYLE_CACHE_OBJ_CNT
+            #define LV_OBJ_STYLE_CACHE_OBJ_CNT CONFIG_LV_OBJ_STYLE_CACHE_OBJ_CNT
+        #else
+            #define LV_OBJ_STYLE_CACHE_OBJ_CNT 16
+        #endif
+    #endif
+#endif
+
+/*1: Queue the style refreshes of the objects and apply them once before the next layout update or redraw.
+ *Changing many properties or styles in a row then walks the object tree only once.*/
+#ifndef LV_OBJ_STYLE_REFR_DEFER
+    #ifdef CONFIG_LV_OBJ_STYLE_REFR_DEFER
+        #define LV_OBJ_STYLE_REFR_DEFER CONFIG_LV_OBJ_STYLE_REFR_DEFER
+    #else
+        #define LV_OBJ_STYLE_REFR_DEFER 0
+    #endif
+#endif
+
+/*Cache the result of `LV_EVENT_GET_SELF_SIZE` (e.g. the size of a label's text) until the widget's content,
+ *style or size changes. Requires `(1 + 4 * sizeof(lv_coord_t))` bytes per object.*/
+#ifndef LV_OBJ_SELF_SIZE_CACHE
+    #ifdef CONFIG_LV_OBJ_SELF_SIZE_CACHE
+        #define LV_OBJ_SELF_SIZE_CACHE CONFIG_LV_OBJ_SELF_SIZE_CACHE
+    #else
+        #define LV_OBJ_SELF_SIZE_CACHE 0
+    #endif
+#endif
+
+/*Index the children of the objects having at least this many children in a grid,
+ *so that finding the pressed object checks only the children around the point. 0: disable.*/
+#ifndef LV_OBJ_HIT_GRID_MIN_CHILD
+    #ifdef CONFIG_LV_OBJ_HIT_GRID_MIN_CHILD
+        #define LV_OBJ_HIT_GRID_MIN_CHILD CONFIG_LV_OBJ_HIT_GRID_MIN_CHILD
+    #else
+        #define LV_OBJ_HIT_GRID_MIN_CHILD 0
+    #endif
+#endif
+
+/*1: Keep a bitmap of the event codes having a handler on each object and skip sending an event to an object
+ *if neither its class (see `handled_events` in `lv_obj_class_t`) nor its event callbacks handle it.
+ *The number of sent and skipped events can be read by `lv_event_get_stat()`.*/
+#ifndef LV_OBJ_EVENT_MASK
+    #ifdef CONFIG_LV_OBJ_EVENT_MASK
+        #define LV_OBJ_EVENT_MASK CONFIG_LV_OBJ_EVENT_MASK
+    #else
+        #define LV_OBJ_EVENT_MASK 0
+    #endif
+#endif
+
+/*1: Cache how the background of the objects covers the areas to redraw (radius, opacity, clip corner, transform size)
+ *so finding the topmost covering object reads the styles only after they changed and doesn't send `LV_EVENT_COVER_CHECK`
+ *to objects whose class and event callbacks don't handle it. Requires `(5 + 3 * sizeof(lv_coord_t))` bytes per object.*/
+#ifndef LV_OBJ_COVER_CACHE
+    #ifdef CONFIG_LV_OBJ_COVER_CACHE
+        #define LV_OBJ_COVER_CACHE CONFIG_LV_OBJ_COVER_CACHE
+    #else
+        #define LV_OBJ_COVER_CACHE 0
+    #endif
+#endif
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #ifndef LV_ENABLE_GC
@@ -1891,6 +2162,26 @@
             #define LV_THEME_DEFAULT_TRANSITION_TIME 80
         #endif
     #endif
+
+    /*Font of the default theme the display is set up with*/
+    #ifndef LV_THEME_DEFAULT_FONT
+        #ifdef CONFIG_LV_THEME_DEFAULT_FONT
+            #define LV_THEME_DEFAULT_FONT CONFIG_LV_THEME_DEFAULT_FONT
+        #else
+            #define LV_THEME_DEFAULT_FONT LV_FONT_DEFAULT
+        #endif
+    #endif
+
+    /*1: Use styles precompiled to flash (see lv_theme_default_styles.json) if the theme is initialized
+     *with the light mode, blue/red colors, LV_THEME_DEFAULT_FONT and LV_DPI_DEF on a display wider than 720 px.
+     *Other parameters fall back to building the styles in RAM.*/
+    #ifndef LV_THEME_DEFAULT_CONST
+        #ifdef CONFIG_LV_THEME_DEFAULT_CONST
+            #define LV_THEME_DEFAULT_CONST CONFIG_LV_THEME_DEFAULT_CONST
+        #else
+            #define LV_THEME_DEFAULT_CONST 0
+        #endif
+    #endif
 #endif /*LV_USE_THEME_DEFAULT*/
 
 /*A very simple theme that is a good starting point for a custom theme*/
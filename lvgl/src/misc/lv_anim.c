@@ -30,6 +30,7 @@
  **********************/
 static void anim_timer(lv_timer_t * param);
 static void anim_mark_list_change(void);
+static void anim_timer_update(void);
 static void anim_ready_handler(lv_anim_t * a);
 
 /**********************
@@ -359,11 +360,12 @@ static void anim_timer(lv_timer_t * param)
     lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
 
     while(a != NULL) {
-        /*It can be set by `lv_anim_del()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_ready_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
+        /*It can be set by `lv_anim_del()` or `lv_anim_start()` typically in `ready_cb`. If set then
+         * the linked list was changed by a callback, so even `a_next` might be deleted meanwhile.
+         * An animation finishing and removing only itself doesn't set it.
          */
         anim_list_changed = false;
+        lv_anim_t * a_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
 
         if(a->run_round != anim_run_round) {
             a->run_round = anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
@@ -404,7 +406,7 @@ static void anim_timer(lv_timer_t * param)
         if(anim_list_changed)
             a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
         else
-            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+            a = a_next;
     }
 
     last_timer_run = lv_tick_get();
@@ -428,10 +430,10 @@ static void anim_ready_handler(lv_anim_t * a)
     if(a->repeat_cnt == 0 && (a->playback_time == 0 || a->playback_now == 1)) {
 
         /*Delete the animation from the list.
-         * This way the `ready_cb` will see the animations like it's animation is ready deleted*/
+         * This way the `ready_cb` will see the animations like it's animation is ready deleted.
+         * `anim_timer` has already read the next animation so it can continue from there*/
         _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
-        /*Flag that the list has changed*/
-        anim_mark_list_change();
+        anim_timer_update();
 
         /*Call the callback function at the end*/
         if(a->ready_cb != NULL) a->ready_cb(a);
@@ -463,6 +465,14 @@ static void anim_ready_handler(lv_anim_t * a)
 static void anim_mark_list_change(void)
 {
     anim_list_changed = true;
+    anim_timer_update();
+}
+
+/**
+ * Run the animation timer only if there are animations
+ */
+static void anim_timer_update(void)
+{
     if(_lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll)) == NULL)
         lv_timer_pause(_lv_anim_tmr);
     else
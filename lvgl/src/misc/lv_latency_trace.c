@@ -0,0 +1,281 @@
+/**
+ * @file lv_latency_trace.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_latency_trace.h"
+#if LV_USE_LATENCY_TRACE
+
+#include "lv_mem.h"
+#include "lv_printf.h"
+#include "../hal/lv_hal_tick.h"
+#include LV_LATENCY_TRACE_TIME_INCLUDE
+
+/*********************
+ *      DEFINES
+ *********************/
+#define POINT_BIT(id)   (1UL << (id))
+#define LINE_SIZE       256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void start(lv_latency_trace_point_t id, uint32_t time);
+static void finish(void);
+static bool is_without_redraw(uint32_t time);
+static void add_to_stat(lv_latency_trace_stat_t * stat, uint32_t us);
+static uint32_t time_to_us(uint32_t time);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_latency_trace_stat_t stats[_LV_LATENCY_TRACE_POINT_NUM];
+static uint32_t done_cnt;
+static uint32_t no_redraw_cnt;
+
+/*The interaction in progress*/
+static bool active;
+static uint32_t recorded;       /*Bits of the recorded steps*/
+static lv_latency_trace_point_t start_id;
+static lv_latency_trace_point_t last_id;
+static uint32_t start_time;
+static uint32_t times[_LV_LATENCY_TRACE_POINT_NUM];
+
+/*A step is recorded only after this step, so e.g. an animation's redraw before the input is read is not counted*/
+static const lv_latency_trace_point_t requires[_LV_LATENCY_TRACE_POINT_NUM] = {
+    [LV_LATENCY_TRACE_INPUT_IRQ] = _LV_LATENCY_TRACE_POINT_NUM,
+    [LV_LATENCY_TRACE_INPUT_ACQUIRED] = _LV_LATENCY_TRACE_POINT_NUM,
+    [LV_LATENCY_TRACE_INDEV_READ] = _LV_LATENCY_TRACE_POINT_NUM,
+    [LV_LATENCY_TRACE_INDEV_PRESS] = LV_LATENCY_TRACE_INDEV_READ,
+    [LV_LATENCY_TRACE_INVALIDATE] = LV_LATENCY_TRACE_INDEV_READ,
+    [LV_LATENCY_TRACE_RENDER_DONE] = LV_LATENCY_TRACE_INVALIDATE,
+    [LV_LATENCY_TRACE_FLUSH] = LV_LATENCY_TRACE_RENDER_DONE,
+    [LV_LATENCY_TRACE_DISP_SHOW] = LV_LATENCY_TRACE_FLUSH,
+};
+
+static const char * const names[_LV_LATENCY_TRACE_POINT_NUM] = {
+    "input_irq", "input_acquired", "indev_read", "indev_press", "invalidate", "render_done", "flush", "disp_show"
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Mark a step of the path at the current time
+ * @param id    the step, an element of `LV_LATENCY_TRACE_...`
+ */
+void lv_latency_trace_point(lv_latency_trace_point_t id)
+{
+    lv_latency_trace_point_at(id, lv_latency_trace_get_time());
+}
+
+/**
+ * Mark a step of the path which has happened earlier
+ * @param id    the step, an element of `LV_LATENCY_TRACE_...`
+ * @param time  the time stamp of the step, returned by `lv_latency_trace_get_time()`
+ */
+void lv_latency_trace_point_at(lv_latency_trace_point_t id, uint32_t time)
+{
+    if(id >= _LV_LATENCY_TRACE_POINT_NUM) return;
+
+    if(id == LV_LATENCY_TRACE_INPUT_IRQ || id == LV_LATENCY_TRACE_INPUT_ACQUIRED) {
+        /*The interaction has reached the display if the port doesn't mark LV_LATENCY_TRACE_DISP_SHOW*/
+        if(active && (recorded & POINT_BIT(LV_LATENCY_TRACE_FLUSH))) finish();
+
+        if(active && is_without_redraw(time)) {
+            no_redraw_cnt++;
+            active = false;
+        }
+
+        if(!active) {
+            start(id, time);
+            return;
+        }
+    }
+
+    if(!active) return;
+
+    if(id == LV_LATENCY_TRACE_INDEV_READ && is_without_redraw(time)) {
+        no_redraw_cnt++;
+        active = false;
+        return;
+    }
+
+    /*Record only the first occurrence of the steps and only in order*/
+    if(id <= last_id) return;
+    if(requires[id] != _LV_LATENCY_TRACE_POINT_NUM && (recorded & POINT_BIT(requires[id])) == 0) return;
+    if((int32_t)(time - times[last_id]) < 0) return;
+
+    times[id] = time;
+    recorded |= POINT_BIT(id);
+    last_id = id;
+
+    if(id == LV_LATENCY_TRACE_DISP_SHOW) finish();
+}
+
+/**
+ * Get the current time stamp of `LV_LATENCY_TRACE_TIME_EXPR`
+ * @return      the time stamp
+ */
+uint32_t lv_latency_trace_get_time(void)
+{
+    return (uint32_t)(LV_LATENCY_TRACE_TIME_EXPR);
+}
+
+/**
+ * Get the latency statistics of a step
+ * @param id    the step, an element of `LV_LATENCY_TRACE_...`
+ * @param stat  store the statistics here
+ */
+void lv_latency_trace_get_stat(lv_latency_trace_point_t id, lv_latency_trace_stat_t * stat)
+{
+    if(id >= _LV_LATENCY_TRACE_POINT_NUM) {
+        lv_memset_00(stat, sizeof(lv_latency_trace_stat_t));
+        return;
+    }
+
+    lv_memcpy(stat, &stats[id], sizeof(lv_latency_trace_stat_t));
+}
+
+/**
+ * Get the number of measured interactions
+ * @return      the number of interactions which have reached the display
+ */
+uint32_t lv_latency_trace_get_done_cnt(void)
+{
+    return done_cnt;
+}
+
+/**
+ * Get the number of interactions whose input caused no redraw
+ * @return      the number of interactions without redraw
+ */
+uint32_t lv_latency_trace_get_no_redraw_cnt(void)
+{
+    return no_redraw_cnt;
+}
+
+/**
+ * Clear the statistics and drop the interaction in progress
+ */
+void lv_latency_trace_reset(void)
+{
+    lv_memset_00(stats, sizeof(stats));
+    done_cnt = 0;
+    no_redraw_cnt = 0;
+    active = false;
+}
+
+/**
+ * Print the statistics of the steps
+ * @param print_cb  called with each line of the report
+ */
+void lv_latency_trace_report(lv_latency_trace_print_cb_t print_cb)
+{
+    char line[LINE_SIZE];
+
+    lv_snprintf(line, sizeof(line), "Latency of %"LV_PRIu32" interactions (%"LV_PRIu32" without redraw), us from the input:",
+                done_cnt, no_redraw_cnt);
+    print_cb(line);
+    print_cb("step              cnt      min     mean      max  histogram (<us:cnt)");
+
+    lv_latency_trace_point_t id;
+    for(id = 0; id < _LV_LATENCY_TRACE_POINT_NUM; id++) {
+        const lv_latency_trace_stat_t * stat = &stats[id];
+        if(stat->cnt == 0) continue;
+
+        uint32_t len = lv_snprintf(line, sizeof(line), "%-15s %5"LV_PRIu32" %8"LV_PRIu32" %8"LV_PRIu32" %8"LV_PRIu32" ",
+                                   names[id], stat->cnt, stat->min_us, stat->sum_us / stat->cnt, stat->max_us);
+
+        uint32_t i;
+        for(i = 0; i < LV_LATENCY_TRACE_HIST_SIZE && len < sizeof(line); i++) {
+            if(stat->hist[i] == 0) continue;
+            if(i == LV_LATENCY_TRACE_HIST_SIZE - 1) {
+                len += lv_snprintf(&line[len], sizeof(line) - len, " >=%"LV_PRIu32":%"LV_PRIu32, (uint32_t)1 << (i - 1),
+                                   stat->hist[i]);
+            }
+            else {
+                len += lv_snprintf(&line[len], sizeof(line) - len, " <%"LV_PRIu32":%"LV_PRIu32, (uint32_t)1 << i, stat->hist[i]);
+            }
+        }
+        print_cb(line);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void start(lv_latency_trace_point_t id, uint32_t time)
+{
+    active = true;
+    recorded = POINT_BIT(id);
+    start_id = id;
+    last_id = id;
+    start_time = time;
+    times[id] = time;
+}
+
+static void finish(void)
+{
+    lv_latency_trace_point_t id;
+    for(id = start_id + 1; id < _LV_LATENCY_TRACE_POINT_NUM; id++) {
+        if(recorded & POINT_BIT(id)) add_to_stat(&stats[id], time_to_us(times[id] - start_time));
+    }
+
+    done_cnt++;
+    active = false;
+}
+
+/**
+ * Check if the input of the interaction has been processed without a redraw.
+ * The changes (also the animations started by the input) are drawn in a refresh period,
+ * so it's assumed if nothing was invalidated in a refresh period after the input was read.
+ * @param time  the current time stamp
+ * @return      true: the interaction caused no redraw
+ */
+static bool is_without_redraw(uint32_t time)
+{
+    if((recorded & POINT_BIT(LV_LATENCY_TRACE_INDEV_READ)) == 0) return false;
+    if(recorded & POINT_BIT(LV_LATENCY_TRACE_INVALIDATE)) return false;
+
+    uint32_t elaps = time - times[LV_LATENCY_TRACE_INDEV_READ];
+    if((int32_t)elaps < 0) return false;
+
+    return time_to_us(elaps) > LV_DISP_DEF_REFR_PERIOD * 1000;
+}
+
+static void add_to_stat(lv_latency_trace_stat_t * stat, uint32_t us)
+{
+    if(stat->cnt == 0 || us < stat->min_us) stat->min_us = us;
+    if(us > stat->max_us) stat->max_us = us;
+    stat->sum_us += us;
+    stat->cnt++;
+
+    /*The bucket is the number of significant bits*/
+    uint32_t i = 0;
+    while(us && i < LV_LATENCY_TRACE_HIST_SIZE - 1) {
+        us >>= 1;
+        i++;
+    }
+    stat->hist[i]++;
+}
+
+static uint32_t time_to_us(uint32_t time)
+{
+    return (uint32_t)(((uint64_t)time * 1000000) / (LV_LATENCY_TRACE_TIME_FREQ));
+}
+
+#endif /*LV_USE_LATENCY_TRACE*/
@@ -0,0 +1,143 @@
+/**
+ * @file lv_latency_trace.h
+ * Measure the latency from an input event to the display showing its result.
+ */
+
+#ifndef LV_LATENCY_TRACE_H
+#define LV_LATENCY_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Number of histogram buckets. Bucket `i` counts the latencies in [2^(i-1), 2^i) us,
+ *bucket 0 the latencies below 1 us and the last bucket everything from 2^(i-1) us.*/
+#define LV_LATENCY_TRACE_HIST_SIZE  21
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * The steps of the path from an input event to the display, in the order they happen.
+ * An interaction is started by `LV_LATENCY_TRACE_INPUT_IRQ` or `LV_LATENCY_TRACE_INPUT_ACQUIRED`
+ * and the latency of the other steps is measured from its start. The inputs arriving during an interaction
+ * are not measured. If nothing is invalidated in a refresh period after the input was read,
+ * the interaction is counted as "without redraw" and dropped.
+ */
+enum {
+    LV_LATENCY_TRACE_INPUT_IRQ,         /**< The input device signaled new data (marked by the port)*/
+    LV_LATENCY_TRACE_INPUT_ACQUIRED,    /**< The new data is read from the input device (marked by the port)*/
+    LV_LATENCY_TRACE_INDEV_READ,        /**< The `read_cb` of a pointer input device has returned*/
+    LV_LATENCY_TRACE_INDEV_PRESS,       /**< A press is being processed*/
+    LV_LATENCY_TRACE_INVALIDATE,        /**< An area is invalidated*/
+    LV_LATENCY_TRACE_RENDER_DONE,       /**< The last area of the refresh is rendered*/
+    LV_LATENCY_TRACE_FLUSH,             /**< The last area of the refresh is passed to `flush_cb`*/
+    LV_LATENCY_TRACE_DISP_SHOW,         /**< The display starts showing the new frame (marked by the port)*/
+    _LV_LATENCY_TRACE_POINT_NUM
+};
+
+typedef uint8_t lv_latency_trace_point_t;
+
+/**
+ * Latency statistics of a step. The latencies are measured from the start of the interactions.
+ */
+typedef struct {
+    uint32_t cnt;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t sum_us;
+    uint32_t hist[LV_LATENCY_TRACE_HIST_SIZE];
+} lv_latency_trace_stat_t;
+
+/**
+ * Called with the lines of the report, without line ending
+ */
+typedef void (*lv_latency_trace_print_cb_t)(const char * line);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_USE_LATENCY_TRACE
+
+/**
+ * Mark a step of the path at the current time. Call it only from the context of `lv_timer_handler()`,
+ * from interrupts save the time with `lv_latency_trace_get_time()` and use `lv_latency_trace_point_at()` later.
+ * @param id    the step, an element of `LV_LATENCY_TRACE_...`
+ */
+void lv_latency_trace_point(lv_latency_trace_point_t id);
+
+/**
+ * Mark a step of the path which has happened earlier
+ * @param id    the step, an element of `LV_LATENCY_TRACE_...`
+ * @param time  the time stamp of the step, returned by `lv_latency_trace_get_time()`
+ */
+void lv_latency_trace_point_at(lv_latency_trace_point_t id, uint32_t time);
+
+/**
+ * Get the current time stamp of `LV_LATENCY_TRACE_TIME_EXPR`. It can be called from interrupts.
+ * @return      the time stamp
+ */
+uint32_t lv_latency_trace_get_time(void);
+
+/**
+ * Get the latency statistics of a step
+ * @param id    the step, an element of `LV_LATENCY_TRACE_...`
+ * @param stat  store the statistics here
+ */
+void lv_latency_trace_get_stat(lv_latency_trace_point_t id, lv_latency_trace_stat_t * stat);
+
+/**
+ * Get the number of measured interactions
+ * @return      the number of interactions which have reached the display
+ */
+uint32_t lv_latency_trace_get_done_cnt(void);
+
+/**
+ * Get the number of interactions whose input caused no redraw. They are not measured.
+ * @return      the number of interactions without redraw
+ */
+uint32_t lv_latency_trace_get_no_redraw_cnt(void);
+
+/**
+ * Clear the statistics and drop the interaction in progress
+ */
+void lv_latency_trace_reset(void);
+
+/**
+ * Print the statistics of the steps: count, min, mean and max latency, and the non-empty
+ * buckets of the histogram as "<upper bound in us>:count"
+ * @param print_cb  called with each line of the report
+ */
+void lv_latency_trace_report(lv_latency_trace_print_cb_t print_cb);
+
+#endif /*LV_USE_LATENCY_TRACE*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#if LV_USE_LATENCY_TRACE
+#define LV_LATENCY_TRACE_POINT(id) lv_latency_trace_point(id)
+#else
+#define LV_LATENCY_TRACE_POINT(id) do {} while(0)
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_LATENCY_TRACE_H*/
@@ -12,6 +12,7 @@
 #include "lv_gc.h"
 #include "lv_assert.h"
 #include "lv_log.h"
+#include "lv_mem_profiler.h"
 
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
@@ -39,16 +40,59 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#define SCRATCH_HEADER_SIZE     sizeof(MEM_UNIT)
+#define SCRATCH_RELEASED        0x1
+#define SCRATCH_NONE            0xFFFFFFF0
+
+#define SLAB_PAGE_SIZE          1024
+#define SLAB_PAGE_NUM           (LV_MEM_SLAB_SIZE / SLAB_PAGE_SIZE)
+#define SLAB_MAX_SIZE           128
+#define SLAB_NONE               0xFFFF
+#define SLAB_CLS_NONE           0xFF
+
+#if LV_MEM_SLAB_SIZE && SLAB_PAGE_NUM >= SLAB_NONE
+    #error "LV_MEM_SLAB_SIZE is too large"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_MEM_SLAB_SIZE
+typedef struct {
+    void * free;        /*List of the free blocks of the page*/
+    uint16_t used;      /*Number of allocated blocks*/
+    uint16_t next;      /*Next page in the list of unused pages or in the class's partial list*/
+    uint16_t prev;      /*Previous page in the class's partial list*/
+    uint8_t cls;        /*Size class of the page or `SLAB_CLS_NONE` if unused*/
+} slab_page_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void * alloc_core(size_t size, lv_mem_hint_t hint);
+static void free_core(void * data);
+static void * realloc_core(void * data_p, size_t new_size);
 #if LV_MEM_CUSTOM == 0
+    static void * tlsf_alloc(size_t size, lv_mem_hint_t hint);
+    static void monitor_pool(lv_tlsf_t pool_tlsf, uint32_t total_size, uint32_t pool_max_used, lv_mem_monitor_t * mon_p);
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+#if LV_MEM_CUSTOM == 0 && LV_MEM_EXT
+    static bool is_ext(const void * p);
+#endif
+#if LV_MEM_SCRATCH_SIZE
+    static void * scratch_alloc(uint32_t size);
+    static void scratch_release(void * p);
+#endif
+#if LV_MEM_SLAB_SIZE
+    static void slab_init(void);
+    static void * slab_alloc(uint32_t size);
+    static void slab_free(void * p);
+    static bool is_slab(const void * p);
+    static uint32_t slab_block_size(const void * p);
+    static void slab_partial_remove(uint8_t cls, uint16_t page_id);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -59,6 +103,36 @@
     static uint32_t max_used;
 #endif
 
+#if LV_MEM_CUSTOM == 0 && LV_MEM_EXT
+    static lv_tlsf_t tlsf_ext;
+    static uint8_t * ext_start;
+    static uint32_t ext_cur_used;
+    static uint32_t ext_max_used;
+#endif
+
+#if LV_MEM_SCRATCH_SIZE
+    /*Every block starts with a header which stores the offset of the previous block.
+     *Its lowest bit is set when the block is released, so the top can be rolled back.*/
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT scratch_mem[LV_MEM_SCRATCH_SIZE / sizeof(MEM_UNIT)];
+    static uint32_t scratch_top;        /*Offset of the first free byte*/
+    static uint32_t scratch_last;       /*Offset of the last allocated block*/
+    static uint32_t scratch_frame_peak; /*Peak of the frame being rendered*/
+    static bool scratch_active;
+    static lv_mem_scratch_monitor_t scratch_mon;
+#endif
+
+#if LV_MEM_SLAB_SIZE
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT slab_mem[SLAB_PAGE_NUM * SLAB_PAGE_SIZE / sizeof(MEM_UNIT)];
+    static slab_page_t slab_pages[SLAB_PAGE_NUM];
+    static uint16_t slab_unused_page;                       /*First page not owned by any class*/
+    static uint16_t slab_partial[LV_MEM_SLAB_CLASS_NUM];    /*First page of a class with free blocks*/
+    static lv_mem_slab_monitor_t slab_mon;
+
+    static const uint16_t slab_sizes[LV_MEM_SLAB_CLASS_NUM] = {16, 24, 32, 48, 64, 96, 128};
+    /*Size class of a request, indexed by `(size + 7) / 8`*/
+    static const uint8_t slab_cls_of[SLAB_MAX_SIZE / 8 + 1] = {0, 0, 0, 1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6};
+#endif
+
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
 /**********************
@@ -70,6 +144,13 @@ static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variabl
     #define MEM_TRACE(...)
 #endif
 
+#if LV_USE_MEM_PROFILER
+    #define MEM_PROFILE(type, old_p, new_p, size) \
+        _lv_mem_profiler_record(type, old_p, new_p, size, LV_MEM_PROFILER_SITE())
+#else
+    #define MEM_PROFILE(type, old_p, new_p, size)
+#endif
+
 #define COPY32 *d32 = *s32; d32++; s32++;
 #define COPY8 *d8 = *s8; d8++; s8++;
 #define SET32(x) *d32 = x; d32++;
@@ -98,6 +179,30 @@ void lv_mem_init(void)
 #else
     tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
+
+#if LV_MEM_EXT
+#if LV_MEM_EXT_ADR == 0
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT work_mem_ext[LV_MEM_EXT_SIZE / sizeof(MEM_UNIT)];
+    ext_start = (uint8_t *)work_mem_ext;
+#else
+    ext_start = (uint8_t *)LV_MEM_EXT_ADR;
+#endif
+    tlsf_ext = lv_tlsf_create_with_pool((void *)ext_start, LV_MEM_EXT_SIZE);
+    ext_cur_used = 0;
+#endif
+#endif
+
+#if LV_MEM_SCRATCH_SIZE
+    scratch_top = 0;
+    scratch_last = SCRATCH_NONE;
+    scratch_frame_peak = 0;
+    scratch_active = false;
+    lv_memset_00(&scratch_mon, sizeof(scratch_mon));
+    scratch_mon.total_size = sizeof(scratch_mem);
+#endif
+
+#if LV_MEM_SLAB_SIZE
+    slab_init();
 #endif
 
 #if LV_MEM_ADD_JUNK
@@ -113,6 +218,9 @@ void lv_mem_deinit(void)
 {
 #if LV_MEM_CUSTOM == 0
     lv_tlsf_destroy(tlsf);
+#if LV_MEM_EXT
+    lv_tlsf_destroy(tlsf_ext);
+#endif
     lv_mem_init();
 #endif
 }
@@ -124,41 +232,22 @@ void lv_mem_deinit(void)
  */
 void * lv_mem_alloc(size_t size)
 {
-    MEM_TRACE("allocating %lu bytes", (unsigned long)size);
-    if(size == 0) {
-        MEM_TRACE("using zero_mem");
-        return &zero_mem;
-    }
-
-#if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
-#else
-    void * alloc = LV_MEM_CUSTOM_ALLOC(size);
-#endif
-
-    if(alloc == NULL) {
-        LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
-#if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
-        lv_mem_monitor_t mon;
-        lv_mem_monitor(&mon);
-        LV_LOG_INFO("used: %6d (%3d %%), frag: %3d %%, biggest free: %6d",
-                    (int)(mon.total_size - mon.free_size), mon.used_pct, mon.frag_pct,
-                    (int)mon.free_biggest_size);
-#endif
-    }
-#if LV_MEM_ADD_JUNK
-    else {
-        lv_memset(alloc, 0xaa, size);
-    }
-#endif
+    void * alloc = alloc_core(size, LV_MEM_HINT_AUTO);
+    MEM_PROFILE(LV_MEM_PROFILER_ALLOC, NULL, alloc, size);
+    return alloc;
+}
 
-    if(alloc) {
-#if LV_MEM_CUSTOM == 0
-        cur_used += size;
-        max_used = LV_MAX(cur_used, max_used);
-#endif
-        MEM_TRACE("allocated at %p", alloc);
-    }
+/**
+ * Allocate a memory dynamically in the pool suggested by a placement hint.
+ * If the preferred pool is full the other pool is tried too.
+ * @param size size of the memory to allocate in bytes
+ * @param hint `LV_MEM_HINT_AUTO/FAST/BULK`
+ * @return pointer to the allocated memory
+ */
+void * lv_mem_alloc_hint(size_t size, lv_mem_hint_t hint)
+{
+    void * alloc = alloc_core(size, hint);
+    MEM_PROFILE(LV_MEM_PROFILER_ALLOC, NULL, alloc, size);
     return alloc;
 }
 
@@ -172,47 +261,39 @@ void lv_mem_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
-#if LV_MEM_CUSTOM == 0
-#  if LV_MEM_ADD_JUNK
-    lv_memset(data, 0xbb, lv_tlsf_block_size(data));
-#  endif
-    size_t size = lv_tlsf_free(tlsf, data);
-    if(cur_used > size) cur_used -= size;
-    else cur_used = 0;
-#else
-    LV_MEM_CUSTOM_FREE(data);
-#endif
+    MEM_PROFILE(LV_MEM_PROFILER_FREE, data, NULL, 0);
+    free_core(data);
 }
 
 /**
  * Reallocate a memory with a new size. The old content will be kept.
- * @param data pointer to an allocated memory.
+ * @param data_p pointer to an allocated memory.
  * Its content will be copied to the new memory block and freed
  * @param new_size the desired new size in byte
  * @return pointer to the new memory
  */
 void * lv_mem_realloc(void * data_p, size_t new_size)
 {
-    MEM_TRACE("reallocating %p with %lu size", data_p, (unsigned long)new_size);
-    if(new_size == 0) {
-        MEM_TRACE("using zero_mem");
-        lv_mem_free(data_p);
-        return &zero_mem;
-    }
-
-    if(data_p == &zero_mem) return lv_mem_alloc(new_size);
+    void * new_p = realloc_core(data_p, new_size);
+    MEM_PROFILE(LV_MEM_PROFILER_REALLOC, data_p, new_p, new_size);
+    return new_p;
+}
 
-#if LV_MEM_CUSTOM == 0
-    void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
-#else
-    void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
-#endif
-    if(new_p == NULL) {
-        LV_LOG_ERROR("couldn't allocate memory");
-        return NULL;
-    }
+/**
+ * Same as `lv_mem_realloc()` but if `data_p` is `NULL` the new memory is allocated
+ * in the pool suggested by `hint`. Existing memory stays in its pool if it can grow there.
+ * @param data_p pointer to an allocated memory or `NULL`
+ * @param new_size the desired new size in byte
+ * @param hint `LV_MEM_HINT_AUTO/FAST/BULK`
+ * @return pointer to the new memory, NULL on failure
+ */
+void * lv_mem_realloc_hint(void * data_p, size_t new_size, lv_mem_hint_t hint)
+{
+    void * new_p;
+    if(new_size != 0 && (data_p == NULL || data_p == &zero_mem)) new_p = alloc_core(new_size, hint);
+    else new_p = realloc_core(data_p, new_size);
 
-    MEM_TRACE("allocated at %p", new_p);
+    MEM_PROFILE(LV_MEM_PROFILER_REALLOC, data_p, new_p, new_size);
     return new_p;
 }
 
@@ -233,6 +314,30 @@ lv_res_t lv_mem_test(void)
         LV_LOG_WARN("pool failed");
         return LV_RES_INV;
     }
+
+#if LV_MEM_EXT
+    if(lv_tlsf_check(tlsf_ext)) {
+        LV_LOG_WARN("bulk failed");
+        return LV_RES_INV;
+    }
+
+    if(lv_tlsf_check_pool(lv_tlsf_get_pool(tlsf_ext))) {
+        LV_LOG_WARN("bulk pool failed");
+        return LV_RES_INV;
+    }
+#endif
+#endif
+
+#if LV_MEM_SLAB_SIZE
+    uint32_t i;
+    for(i = 0; i < SLAB_PAGE_NUM; i++) {
+        uint8_t * page_start = (uint8_t *)slab_mem + i * SLAB_PAGE_SIZE;
+        uint8_t * free_p = slab_pages[i].free;
+        if(free_p && (free_p < page_start || free_p >= page_start + SLAB_PAGE_SIZE)) {
+            LV_LOG_WARN("slab page %d is corrupted", (int)i);
+            return LV_RES_INV;
+        }
+    }
 #endif
     MEM_TRACE("passed");
     return LV_RES_OK;
@@ -250,24 +355,26 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #if LV_MEM_CUSTOM == 0
     MEM_TRACE("begin");
 
-    lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
-
-    mon_p->total_size = LV_MEM_SIZE;
-    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
-    if(mon_p->free_size > 0) {
-        mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
-        mon_p->frag_pct = 100 - mon_p->frag_pct;
-    }
-    else {
-        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
-    }
-
-    mon_p->max_used = max_used;
+    monitor_pool(tlsf, LV_MEM_SIZE, max_used, mon_p);
 
     MEM_TRACE("finished");
 #endif
 }
 
+/**
+ * Give information about the bulk memory pool (`LV_MEM_EXT`).
+ * All fields are zero if there is no bulk pool.
+ * @param mon_p pointer to a lv_mem_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_monitor_ext(lv_mem_monitor_t * mon_p)
+{
+    lv_memset(mon_p, 0, sizeof(lv_mem_monitor_t));
+#if LV_MEM_CUSTOM == 0 && LV_MEM_EXT
+    monitor_pool(tlsf_ext, LV_MEM_EXT_SIZE, ext_max_used, mon_p);
+#endif
+}
+
 
 /**
  * Get a temporal buffer with the given size.
@@ -279,6 +386,14 @@ void * lv_mem_buf_get(uint32_t size)
 
     MEM_TRACE("begin, getting %d bytes", size);
 
+#if LV_MEM_SCRATCH_SIZE
+    if(scratch_active) {
+        void * p = scratch_alloc(size);
+        if(p) return p;
+        scratch_mon.fallback_cnt++;
+    }
+#endif
+
     /*Try to find a free buffer with suitable size*/
     int8_t i_guess = -1;
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
@@ -333,6 +448,13 @@ void lv_mem_buf_release(void * p)
 {
     MEM_TRACE("begin (address: %p)", p);
 
+#if LV_MEM_SCRATCH_SIZE
+    if((MEM_UNIT *)p >= scratch_mem && (MEM_UNIT *)p < scratch_mem + sizeof(scratch_mem) / sizeof(MEM_UNIT)) {
+        scratch_release(p);
+        return;
+    }
+#endif
+
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
             LV_GC_ROOT(lv_mem_buf[i]).used = 0;
@@ -356,6 +478,66 @@ void lv_mem_buf_free_all(void)
             LV_GC_ROOT(lv_mem_buf[i]).size = 0;
         }
     }
+
+#if LV_MEM_SCRATCH_SIZE
+    /*It's called at the end of every refresh, so close the frame's statistics here*/
+    if(scratch_frame_peak) {
+        scratch_mon.frame_peak = scratch_frame_peak;
+        scratch_frame_peak = 0;
+    }
+#endif
+}
+
+/**
+ * Start serving `lv_mem_buf_get()` from the scratch arena.
+ * Called by the display refresh when an area starts to be rendered.
+ */
+void _lv_mem_scratch_begin(void)
+{
+#if LV_MEM_SCRATCH_SIZE
+    scratch_active = true;
+#endif
+}
+
+/**
+ * Drop all buffers of the scratch arena and stop using it.
+ * Called by the display refresh when an area is rendered.
+ */
+void _lv_mem_scratch_end(void)
+{
+#if LV_MEM_SCRATCH_SIZE
+    scratch_active = false;
+    scratch_top = 0;
+    scratch_last = SCRATCH_NONE;
+#endif
+}
+
+/**
+ * Give information about the usage of the scratch arena
+ * @param mon_p pointer to a lv_mem_scratch_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_scratch_monitor(lv_mem_scratch_monitor_t * mon_p)
+{
+#if LV_MEM_SCRATCH_SIZE
+    *mon_p = scratch_mon;
+#else
+    lv_memset_00(mon_p, sizeof(lv_mem_scratch_monitor_t));
+#endif
+}
+
+/**
+ * Give information about the usage of the slab allocator
+ * @param mon_p pointer to a lv_mem_slab_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_slab_monitor(lv_mem_slab_monitor_t * mon_p)
+{
+#if LV_MEM_SLAB_SIZE
+    *mon_p = slab_mon;
+#else
+    lv_memset_00(mon_p, sizeof(lv_mem_slab_monitor_t));
+#endif
 }
 
 #if LV_MEMCPY_MEMSET_STD == 0
@@ -547,7 +729,186 @@ LV_ATTRIBUTE_FAST_MEM void lv_memset_ff(void * dst, size_t len)
  *   STATIC FUNCTIONS
  **********************/
 
+static void * alloc_core(size_t size, lv_mem_hint_t hint)
+{
+    MEM_TRACE("allocating %lu bytes", (unsigned long)size);
+    if(size == 0) {
+        MEM_TRACE("using zero_mem");
+        return &zero_mem;
+    }
+
+    void * alloc = NULL;
+#if LV_MEM_SLAB_SIZE
+    /*Small blocks from the slabs, unless they are explicitly asked to be in the bulk pool*/
+    if(size <= SLAB_MAX_SIZE && hint != LV_MEM_HINT_BULK) alloc = slab_alloc((uint32_t)size);
+#endif
+
+    if(alloc == NULL) {
+#if LV_MEM_CUSTOM == 0
+        alloc = tlsf_alloc(size, hint);
+#else
+        LV_UNUSED(hint);
+        alloc = LV_MEM_CUSTOM_ALLOC(size);
+#endif
+    }
+
+    if(alloc == NULL) {
+        LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
+#if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        LV_LOG_INFO("used: %6d (%3d %%), frag: %3d %%, biggest free: %6d",
+                    (int)(mon.total_size - mon.free_size), mon.used_pct, mon.frag_pct,
+                    (int)mon.free_biggest_size);
+#endif
+    }
+#if LV_MEM_ADD_JUNK
+    else {
+        lv_memset(alloc, 0xaa, size);
+    }
+#endif
+
+    if(alloc) {
+        MEM_TRACE("allocated at %p", alloc);
+    }
+    return alloc;
+}
+
+static void free_core(void * data)
+{
+    if(data == &zero_mem) return;
+    if(data == NULL) return;
+
+#if LV_MEM_SLAB_SIZE
+    if(is_slab(data)) {
+        slab_free(data);
+        return;
+    }
+#endif
+
+#if LV_MEM_CUSTOM == 0
+#  if LV_MEM_ADD_JUNK
+    lv_memset(data, 0xbb, lv_tlsf_block_size(data));
+#  endif
+#  if LV_MEM_EXT
+    if(is_ext(data)) {
+        size_t size = lv_tlsf_free(tlsf_ext, data);
+        if(ext_cur_used > size) ext_cur_used -= size;
+        else ext_cur_used = 0;
+        return;
+    }
+#  endif
+    size_t size = lv_tlsf_free(tlsf, data);
+    if(cur_used > size) cur_used -= size;
+    else cur_used = 0;
+#else
+    LV_MEM_CUSTOM_FREE(data);
+#endif
+}
+
+static void * realloc_core(void * data_p, size_t new_size)
+{
+    MEM_TRACE("reallocating %p with %lu size", data_p, (unsigned long)new_size);
+    if(new_size == 0) {
+        MEM_TRACE("using zero_mem");
+        free_core(data_p);
+        return &zero_mem;
+    }
+
+    if(data_p == &zero_mem) return alloc_core(new_size, LV_MEM_HINT_AUTO);
+
+#if LV_MEM_SLAB_SIZE
+    if(is_slab(data_p)) {
+        /*The block is large enough, nothing to do*/
+        uint32_t block_size = slab_block_size(data_p);
+        if(new_size <= block_size) return data_p;
+
+        void * new_p = alloc_core(new_size, LV_MEM_HINT_AUTO);
+        if(new_p == NULL) {
+            LV_LOG_ERROR("couldn't allocate memory");
+            return NULL;
+        }
+        lv_memcpy(new_p, data_p, block_size);
+        slab_free(data_p);
+        MEM_TRACE("allocated at %p", new_p);
+        return new_p;
+    }
+#endif
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_EXT
+    if(data_p == NULL) return alloc_core(new_size, LV_MEM_HINT_AUTO);
+
+    bool ext = is_ext(data_p);
+    void * new_p = lv_tlsf_realloc(ext ? tlsf_ext : tlsf, data_p, new_size);
+    if(new_p == NULL) {
+        /*Can't grow in its own pool, try to move it to the other one*/
+        new_p = alloc_core(new_size, ext ? LV_MEM_HINT_FAST : LV_MEM_HINT_BULK);
+        if(new_p) {
+            size_t old_size = lv_tlsf_block_size(data_p);
+            lv_memcpy(new_p, data_p, LV_MIN(old_size, new_size));
+            free_core(data_p);
+        }
+    }
+#elif LV_MEM_CUSTOM == 0
+    void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+#else
+    void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
+#endif
+    if(new_p == NULL) {
+        LV_LOG_ERROR("couldn't allocate memory");
+        return NULL;
+    }
+
+    MEM_TRACE("allocated at %p", new_p);
+    return new_p;
+}
+
 #if LV_MEM_CUSTOM == 0
+static void * tlsf_alloc(size_t size, lv_mem_hint_t hint)
+{
+#if LV_MEM_EXT
+    bool bulk = hint == LV_MEM_HINT_BULK || (hint == LV_MEM_HINT_AUTO && size >= LV_MEM_EXT_THRESHOLD);
+    void * alloc = lv_tlsf_malloc(bulk ? tlsf_ext : tlsf, size);
+    if(alloc == NULL) {
+        /*The preferred pool is full, the other one is still better than failing*/
+        bulk = !bulk;
+        alloc = lv_tlsf_malloc(bulk ? tlsf_ext : tlsf, size);
+    }
+
+    if(alloc && bulk) {
+        ext_cur_used += size;
+        ext_max_used = LV_MAX(ext_cur_used, ext_max_used);
+        return alloc;
+    }
+#else
+    LV_UNUSED(hint);
+    void * alloc = lv_tlsf_malloc(tlsf, size);
+#endif
+
+    if(alloc) {
+        cur_used += size;
+        max_used = LV_MAX(cur_used, max_used);
+    }
+    return alloc;
+}
+
+static void monitor_pool(lv_tlsf_t pool_tlsf, uint32_t total_size, uint32_t pool_max_used, lv_mem_monitor_t * mon_p)
+{
+    lv_tlsf_walk_pool(lv_tlsf_get_pool(pool_tlsf), lv_mem_walker, mon_p);
+
+    mon_p->total_size = total_size;
+    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
+    if(mon_p->free_size > 0) {
+        mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
+        mon_p->frag_pct = 100 - mon_p->frag_pct;
+    }
+    else {
+        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+    }
+
+    mon_p->max_used = pool_max_used;
+}
+
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
     LV_UNUSED(ptr);
@@ -564,3 +925,187 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_EXT
+static bool is_ext(const void * p)
+{
+    const uint8_t * p8 = p;
+    return p8 >= ext_start && p8 < ext_start + LV_MEM_EXT_SIZE;
+}
+#endif
+
+#if LV_MEM_SCRATCH_SIZE
+static void * scratch_alloc(uint32_t size)
+{
+    uint32_t need = SCRATCH_HEADER_SIZE + ((size + ALIGN_MASK) & ~ALIGN_MASK);
+    if(need > sizeof(scratch_mem) - scratch_top) return NULL;
+
+    MEM_UNIT * header = &scratch_mem[scratch_top / sizeof(MEM_UNIT)];
+    *header = scratch_last;
+    scratch_last = scratch_top;
+    scratch_top += need;
+
+    if(scratch_top > scratch_frame_peak) {
+        scratch_frame_peak = scratch_top;
+        if(scratch_top > scratch_mon.max_peak) scratch_mon.max_peak = scratch_top;
+    }
+
+    return (uint8_t *)header + SCRATCH_HEADER_SIZE;
+}
+
+static void scratch_release(void * p)
+{
+    MEM_UNIT * header = (MEM_UNIT *)((uint8_t *)p - SCRATCH_HEADER_SIZE);
+    *header |= SCRATCH_RELEASED;
+
+    /*Roll back the top while the last blocks are released*/
+    while(scratch_last != SCRATCH_NONE) {
+        MEM_UNIT last_header = scratch_mem[scratch_last / sizeof(MEM_UNIT)];
+        if((last_header & SCRATCH_RELEASED) == 0) break;
+        scratch_top = scratch_last;
+        scratch_last = (uint32_t)(last_header & ~((MEM_UNIT)SCRATCH_RELEASED));
+    }
+}
+#endif
+
+#if LV_MEM_SLAB_SIZE
+static void slab_init(void)
+{
+    uint32_t i;
+    for(i = 0; i < SLAB_PAGE_NUM; i++) {
+        slab_pages[i].free = NULL;
+        slab_pages[i].used = 0;
+        slab_pages[i].next = i + 1 < SLAB_PAGE_NUM ? (uint16_t)(i + 1) : SLAB_NONE;
+        slab_pages[i].prev = SLAB_NONE;
+        slab_pages[i].cls = SLAB_CLS_NONE;
+    }
+    slab_unused_page = SLAB_PAGE_NUM ? 0 : SLAB_NONE;
+
+    lv_memset_00(&slab_mon, sizeof(slab_mon));
+    slab_mon.total_size = sizeof(slab_mem);
+    slab_mon.page_cnt = SLAB_PAGE_NUM;
+    slab_mon.free_page_cnt = SLAB_PAGE_NUM;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_NUM; i++) {
+        slab_partial[i] = SLAB_NONE;
+        slab_mon.cls[i].block_size = slab_sizes[i];
+    }
+}
+
+static void * slab_alloc(uint32_t size)
+{
+    uint8_t cls = slab_cls_of[(size + 7) >> 3];
+    lv_mem_slab_class_monitor_t * mon = &slab_mon.cls[cls];
+    uint16_t page_id = slab_partial[cls];
+    slab_page_t * page;
+
+    if(page_id == SLAB_NONE) {
+        /*All pages of the class are full, take an unused one and chain its blocks*/
+        page_id = slab_unused_page;
+        if(page_id == SLAB_NONE) {
+            mon->fallback_cnt++;
+            return NULL;
+        }
+
+        page = &slab_pages[page_id];
+        slab_unused_page = page->next;
+
+        uint32_t block_size = slab_sizes[cls];
+        uint32_t block_cnt = SLAB_PAGE_SIZE / block_size;
+        uint8_t * block = (uint8_t *)slab_mem + (uint32_t)page_id * SLAB_PAGE_SIZE;
+        page->free = block;
+        uint32_t i;
+        for(i = 0; i < block_cnt - 1; i++) {
+            *(void **)block = block + block_size;
+            block += block_size;
+        }
+        *(void **)block = NULL;
+
+        page->cls = cls;
+        page->used = 0;
+        page->next = SLAB_NONE;
+        page->prev = SLAB_NONE;
+        slab_partial[cls] = page_id;
+
+        slab_mon.free_page_cnt--;
+        mon->page_cnt++;
+        mon->free_cnt += block_cnt;
+    }
+    else {
+        page = &slab_pages[page_id];
+    }
+
+    void ** block = page->free;
+    page->free = *block;
+    page->used++;
+    if(page->free == NULL) slab_partial_remove(cls, page_id);
+
+    mon->used_cnt++;
+    mon->free_cnt--;
+    mon->alloc_cnt++;
+    if(mon->used_cnt > mon->max_used_cnt) mon->max_used_cnt = mon->used_cnt;
+
+    return block;
+}
+
+static void slab_free(void * p)
+{
+    uint16_t page_id = (uint16_t)(((uint8_t *)p - (uint8_t *)slab_mem) / SLAB_PAGE_SIZE);
+    slab_page_t * page = &slab_pages[page_id];
+    uint8_t cls = page->cls;
+    lv_mem_slab_class_monitor_t * mon = &slab_mon.cls[cls];
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, slab_sizes[cls]);
+#endif
+
+    /*A full page gets a free block, so it can serve allocations again*/
+    if(page->free == NULL) {
+        page->prev = SLAB_NONE;
+        page->next = slab_partial[cls];
+        if(page->next != SLAB_NONE) slab_pages[page->next].prev = page_id;
+        slab_partial[cls] = page_id;
+    }
+
+    *(void **)p = page->free;
+    page->free = p;
+    page->used--;
+    mon->used_cnt--;
+    mon->free_cnt++;
+
+    /*Give back empty pages to the other classes, but keep the last one of the class
+     *to avoid rechaining the same page again and again*/
+    if(page->used == 0 && (page->prev != SLAB_NONE || page->next != SLAB_NONE)) {
+        slab_partial_remove(cls, page_id);
+        page->cls = SLAB_CLS_NONE;
+        page->free = NULL;
+        page->next = slab_unused_page;
+        slab_unused_page = page_id;
+
+        slab_mon.free_page_cnt++;
+        mon->page_cnt--;
+        mon->free_cnt -= SLAB_PAGE_SIZE / slab_sizes[cls];
+    }
+}
+
+static bool is_slab(const void * p)
+{
+    const uint8_t * p8 = p;
+    return p8 >= (const uint8_t *)slab_mem && p8 < (const uint8_t *)slab_mem + sizeof(slab_mem);
+}
+
+static uint32_t slab_block_size(const void * p)
+{
+    uint32_t page_id = (uint32_t)(((const uint8_t *)p - (const uint8_t *)slab_mem) / SLAB_PAGE_SIZE);
+    return slab_sizes[slab_pages[page_id].cls];
+}
+
+static void slab_partial_remove(uint8_t cls, uint16_t page_id)
+{
+    slab_page_t * page = &slab_pages[page_id];
+    if(page->prev != SLAB_NONE) slab_pages[page->prev].next = page->next;
+    else slab_partial[cls] = page->next;
+    if(page->next != SLAB_NONE) slab_pages[page->next].prev = page->prev;
+    page->next = SLAB_NONE;
+    page->prev = SLAB_NONE;
+}
+#endif
@@ -24,6 +24,8 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/*Number of size classes of the slab allocator (`LV_MEM_SLAB_SIZE`)*/
+#define LV_MEM_SLAB_CLASS_NUM   7
 
 /**********************
  *      TYPEDEFS
@@ -43,6 +45,18 @@ typedef struct {
     uint8_t frag_pct; /**< Amount of fragmentation*/
 } lv_mem_monitor_t;
 
+/**
+ * Placement hint for `lv_mem_alloc_hint()`.
+ * Only matters if `LV_MEM_EXT` is enabled, otherwise everything goes to the same pool.
+ */
+enum {
+    LV_MEM_HINT_AUTO = 0,   /**< Decide by size: `>= LV_MEM_EXT_THRESHOLD` goes to the bulk pool*/
+    LV_MEM_HINT_FAST,       /**< Small or frequently accessed data, keep it in the main pool*/
+    LV_MEM_HINT_BULK,       /**< Large or rarely accessed data, prefer the bulk pool*/
+};
+
+typedef uint8_t lv_mem_hint_t;
+
 typedef struct {
     void * p;
     uint16_t size;
@@ -51,6 +65,39 @@ typedef struct {
 
 typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
 
+/**
+ * Scratch arena information structure.
+ */
+typedef struct {
+    uint32_t total_size;    /**< Size of the arena (`LV_MEM_SCRATCH_SIZE`)*/
+    uint32_t frame_peak;    /**< Peak usage while rendering the last frame*/
+    uint32_t max_peak;      /**< Peak usage since `lv_mem_init()`*/
+    uint32_t fallback_cnt;  /**< Number of requests which didn't fit and used a normal buffer*/
+} lv_mem_scratch_monitor_t;
+
+/**
+ * Statistics of one size class of the slab allocator.
+ */
+typedef struct {
+    uint16_t block_size;    /**< Size of the blocks in this class*/
+    uint16_t page_cnt;      /**< Number of pages owned by this class*/
+    uint32_t used_cnt;      /**< Number of allocated blocks*/
+    uint32_t free_cnt;      /**< Number of free blocks on the class's pages*/
+    uint32_t max_used_cnt;  /**< Max number of allocated blocks since `lv_mem_init()`*/
+    uint32_t alloc_cnt;     /**< Number of allocations served by this class*/
+    uint32_t fallback_cnt;  /**< Number of allocations which went to the heap as there was no free page*/
+} lv_mem_slab_class_monitor_t;
+
+/**
+ * Slab allocator information structure.
+ */
+typedef struct {
+    uint32_t total_size;    /**< Size of the slab region (`LV_MEM_SLAB_SIZE`)*/
+    uint16_t page_cnt;      /**< Number of pages*/
+    uint16_t free_page_cnt; /**< Number of pages not owned by any class*/
+    lv_mem_slab_class_monitor_t cls[LV_MEM_SLAB_CLASS_NUM];
+} lv_mem_slab_monitor_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -73,6 +120,15 @@ void lv_mem_deinit(void);
  */
 void * lv_mem_alloc(size_t size);
 
+/**
+ * Allocate a memory dynamically in the pool suggested by a placement hint.
+ * If the preferred pool is full the other pool is tried too.
+ * @param size size of the memory to allocate in bytes
+ * @param hint `LV_MEM_HINT_AUTO/FAST/BULK`
+ * @return pointer to the allocated memory
+ */
+void * lv_mem_alloc_hint(size_t size, lv_mem_hint_t hint);
+
 /**
  * Free an allocated data
  * @param data pointer to an allocated memory
@@ -88,6 +144,16 @@ void lv_mem_free(void * data);
  */
 void * lv_mem_realloc(void * data_p, size_t new_size);
 
+/**
+ * Same as `lv_mem_realloc()` but if `data_p` is `NULL` the new memory is allocated
+ * in the pool suggested by `hint`. Existing memory stays in its pool if it can grow there.
+ * @param data_p pointer to an allocated memory or `NULL`
+ * @param new_size the desired new size in byte
+ * @param hint `LV_MEM_HINT_AUTO/FAST/BULK`
+ * @return pointer to the new memory, NULL on failure
+ */
+void * lv_mem_realloc_hint(void * data_p, size_t new_size, lv_mem_hint_t hint);
+
 /**
  *
  * @return
@@ -101,6 +167,14 @@ lv_res_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Give information about the bulk memory pool (`LV_MEM_EXT`).
+ * All fields are zero if there is no bulk pool.
+ * @param mon_p pointer to a lv_mem_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_monitor_ext(lv_mem_monitor_t * mon_p);
+
 
 /**
  * Get a temporal buffer with the given size.
@@ -119,6 +193,32 @@ void lv_mem_buf_release(void * p);
  */
 void lv_mem_buf_free_all(void);
 
+/**
+ * Start serving `lv_mem_buf_get()` from the scratch arena.
+ * Called by the display refresh when an area starts to be rendered.
+ */
+void _lv_mem_scratch_begin(void);
+
+/**
+ * Drop all buffers of the scratch arena and stop using it.
+ * Called by the display refresh when an area is rendered.
+ */
+void _lv_mem_scratch_end(void);
+
+/**
+ * Give information about the usage of the scratch arena
+ * @param mon_p pointer to a lv_mem_scratch_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_scratch_monitor(lv_mem_scratch_monitor_t * mon_p);
+
+/**
+ * Give information about the usage of the slab allocator
+ * @param mon_p pointer to a lv_mem_slab_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_slab_monitor(lv_mem_slab_monitor_t * mon_p);
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
@@ -0,0 +1,193 @@
+/**
+ * @file lv_mem_profiler.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_profiler.h"
+#if LV_USE_MEM_PROFILER
+
+#include "lv_mem.h"
+#include "../hal/lv_hal_tick.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define PTR_SIZE        sizeof(void *)
+#define HEADER_SIZE     8
+#define MAX_REC_SIZE    (2 + 3 * PTR_SIZE + 4)
+
+#if LV_MEM_PROFILER_BUF_SIZE < 64
+    #error "LV_MEM_PROFILER_BUF_SIZE should be at least 64"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint8_t * put_u32(uint8_t * p, uint32_t v);
+static uint8_t * put_ptr(uint8_t * p, const void * ptr);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_mem_profiler_write_cb_t write_cb;
+static uint8_t buf[LV_MEM_PROFILER_BUF_SIZE];
+static uint32_t buf_len;
+static uint32_t frame_cnt;
+static uint8_t cur_tag;
+static bool writing;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Start recording. The header of the stream is written immediately.
+ * @param cb    called with the recorded data when the buffer is full or on `lv_mem_profiler_flush()`
+ */
+void lv_mem_profiler_start(lv_mem_profiler_write_cb_t cb)
+{
+    write_cb = cb;
+    frame_cnt = 0;
+
+    lv_memcpy(buf, LV_MEM_PROFILER_MAGIC, 4);
+    buf[4] = LV_MEM_PROFILER_VERSION;
+    buf[5] = (uint8_t)PTR_SIZE;
+    buf[6] = 0;
+    buf[7] = 0;
+    buf_len = HEADER_SIZE;
+}
+
+/**
+ * Flush the pending records and stop recording.
+ */
+void lv_mem_profiler_stop(void)
+{
+    lv_mem_profiler_flush();
+    write_cb = NULL;
+}
+
+/**
+ * Pass the pending records to the write callback
+ */
+void lv_mem_profiler_flush(void)
+{
+    if(write_cb == NULL || buf_len == 0) return;
+
+    /*Don't record anything the callback does with the memory*/
+    writing = true;
+    write_cb(buf, buf_len);
+    writing = false;
+    buf_len = 0;
+}
+
+/**
+ * Set a tag which is saved with the next records.
+ * @param tag   any number, 0 by default
+ */
+void lv_mem_profiler_set_tag(uint8_t tag)
+{
+    cur_tag = tag;
+}
+
+/**
+ * Get the current tag
+ * @return the tag set by `lv_mem_profiler_set_tag()`
+ */
+uint8_t lv_mem_profiler_get_tag(void)
+{
+    return cur_tag;
+}
+
+/**
+ * Record an allocation event. Called by `lv_mem`.
+ * @param type      `LV_MEM_PROFILER_ALLOC/REALLOC/FREE`
+ * @param old_p     the reallocated or freed pointer, else NULL
+ * @param new_p     the allocated pointer, else NULL
+ * @param size      the requested size
+ * @param site      the caller's address
+ */
+void _lv_mem_profiler_record(lv_mem_profiler_rec_t type, const void * old_p, const void * new_p, size_t size,
+                             const void * site)
+{
+    if(write_cb == NULL || writing) return;
+    if(buf_len + MAX_REC_SIZE > sizeof(buf)) lv_mem_profiler_flush();
+
+    uint8_t * p = &buf[buf_len];
+    *p++ = type;
+    *p++ = cur_tag;
+    switch(type) {
+        case LV_MEM_PROFILER_ALLOC:
+            p = put_ptr(p, new_p);
+            p = put_u32(p, (uint32_t)size);
+            break;
+        case LV_MEM_PROFILER_REALLOC:
+            p = put_ptr(p, old_p);
+            p = put_ptr(p, new_p);
+            p = put_u32(p, (uint32_t)size);
+            break;
+        case LV_MEM_PROFILER_FREE:
+            p = put_ptr(p, old_p);
+            break;
+        default:
+            return;
+    }
+    p = put_ptr(p, site);
+
+    buf_len = (uint32_t)(p - buf);
+}
+
+/**
+ * Mark the start of a new frame. Called by the display refresh.
+ */
+void _lv_mem_profiler_frame(void)
+{
+    if(write_cb == NULL) return;
+    if(buf_len + MAX_REC_SIZE > sizeof(buf)) lv_mem_profiler_flush();
+
+    frame_cnt++;
+
+    uint8_t * p = &buf[buf_len];
+    *p++ = LV_MEM_PROFILER_FRAME;
+    *p++ = cur_tag;
+    p = put_u32(p, frame_cnt);
+    p = put_u32(p, lv_tick_get());
+
+    buf_len = (uint32_t)(p - buf);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint8_t * put_u32(uint8_t * p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+static uint8_t * put_ptr(uint8_t * p, const void * ptr)
+{
+    lv_uintptr_t v = (lv_uintptr_t)ptr;
+    uint32_t i;
+    for(i = 0; i < PTR_SIZE; i++) {
+        *p++ = (uint8_t)v;
+        v >>= 8;
+    }
+    return p;
+}
+
+#endif /*LV_USE_MEM_PROFILER*/
@@ -0,0 +1,125 @@
+/**
+ * @file lv_mem_profiler.h
+ * Record the allocations of `lv_mem` as a binary stream.
+ * Use `scripts/lv_mem_profile.py` to get per call site reports from it.
+ */
+
+#ifndef LV_MEM_PROFILER_H
+#define LV_MEM_PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_MEM_PROFILER_MAGIC       "LVMP"
+#define LV_MEM_PROFILER_VERSION     1
+
+/**
+ * Stream format (little endian):
+ * - header: magic "LVMP", version (u8), pointer size in bytes (u8), 2 reserved bytes
+ * - records, starting with the type (u8) and the current tag (u8):
+ *   - ALLOC:   ptr, size (u32), site
+ *   - REALLOC: old ptr, new ptr, size (u32), site
+ *   - FREE:    ptr, site
+ *   - FRAME:   frame number (u32), tick (u32)
+ * A failed allocation is recorded with NULL as the new pointer.
+ */
+enum {
+    LV_MEM_PROFILER_ALLOC = 1,
+    LV_MEM_PROFILER_REALLOC,
+    LV_MEM_PROFILER_FREE,
+    LV_MEM_PROFILER_FRAME,
+};
+
+typedef uint8_t lv_mem_profiler_rec_t;
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Called with a chunk of the stream. It must not allocate memory with `lv_mem_alloc()`.
+ */
+typedef void (*lv_mem_profiler_write_cb_t)(const void * data, uint32_t len);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_USE_MEM_PROFILER
+
+/**
+ * Start recording. The header of the stream is written immediately.
+ * @param cb        called with the recorded data when the buffer is full or on `lv_mem_profiler_flush()`
+ */
+void lv_mem_profiler_start(lv_mem_profiler_write_cb_t cb);
+
+/**
+ * Flush the pending records and stop recording.
+ */
+void lv_mem_profiler_stop(void);
+
+/**
+ * Pass the pending records to the write callback
+ */
+void lv_mem_profiler_flush(void);
+
+/**
+ * Set a tag which is saved with the next records. Useful to mark e.g. which screen or subsystem
+ * is being created when the return address alone is not descriptive enough.
+ * @param tag   any number, 0 by default
+ */
+void lv_mem_profiler_set_tag(uint8_t tag);
+
+/**
+ * Get the current tag
+ * @return the tag set by `lv_mem_profiler_set_tag()`
+ */
+uint8_t lv_mem_profiler_get_tag(void);
+
+/**
+ * Record an allocation event. Called by `lv_mem`.
+ * @param type      `LV_MEM_PROFILER_ALLOC/REALLOC/FREE`
+ * @param old_p     the reallocated or freed pointer, else NULL
+ * @param new_p     the allocated pointer, else NULL
+ * @param size      the requested size
+ * @param site      the caller's address
+ */
+void _lv_mem_profiler_record(lv_mem_profiler_rec_t type, const void * old_p, const void * new_p, size_t size,
+                             const void * site);
+
+/**
+ * Mark the start of a new frame. Called by the display refresh.
+ */
+void _lv_mem_profiler_frame(void);
+
+#endif /*LV_USE_MEM_PROFILER*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/*The address the current function will return to. Used as the call site of the allocations.*/
+#if LV_USE_MEM_PROFILER && defined(__GNUC__)
+#define LV_MEM_PROFILER_SITE()  __builtin_return_address(0)
+#else
+#define LV_MEM_PROFILER_SITE()  NULL
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_PROFILER_H*/
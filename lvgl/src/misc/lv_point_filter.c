@@ -0,0 +1,162 @@
+/**
+ * @file lv_point_filter.c
+ * One-Euro filter (Casiez et al.) of pointer coordinates in fixed point.
+ *
+ * Each coordinate is smoothed by an exponential filter whose smoothing factor is
+ * `alpha = dt / (dt + tau)` with `tau = 1 / (2 * pi * cutoff)`. The speed is measured between the raw samples
+ * and smoothed the same way with a fixed cutoff. It raises the cutoff of the position and extrapolates it.
+ * Unlike the reference filter the speed is not measured from the last filtered position,
+ * as it overestimates the speed during motion and would make the prediction overshoot.
+ * The positions are stored in 1/256 px and the smoothing factors in 1/4096.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_point_filter.h"
+#if LV_USE_INDEV_FILTER
+
+#include "lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define POS_SHIFT       8
+#define ALPHA_SHIFT     12
+
+/*tau [us] = TAU_DIV / cutoff [0.1 Hz]*/
+#define TAU_DIV         1591549
+
+/*Cutoff frequency of the speed [0.1 Hz]. The prediction follows a change of speed in about 2 * tau (~60 ms).*/
+#define SPEED_CUTOFF    50
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void axis_apply(lv_point_filter_axis_t * axis, const lv_point_filter_cfg_t * cfg, int32_t raw, uint32_t dt);
+static int32_t get_alpha(uint32_t cutoff, uint32_t dt);
+static int32_t smooth(int32_t act, int32_t target, int32_t alpha);
+static lv_coord_t pos_to_coord(int32_t pos);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Forget the samples. The next sample is passed through unchanged.
+ * @param filter    pointer to a filter
+ */
+void lv_point_filter_reset(lv_point_filter_t * filter)
+{
+    filter->valid = 0;
+}
+
+/**
+ * Filter a sample and extrapolate it to `now + cfg->predict_time`
+ * @param filter    pointer to a filter
+ * @param cfg       parameters of the filter
+ * @param point     the raw point, it's replaced with the filtered and extrapolated point
+ * @param time      time stamp of the sample [ms]
+ * @param now       the current time [ms], at least `time`
+ */
+void lv_point_filter_apply(lv_point_filter_t * filter, const lv_point_filter_cfg_t * cfg, lv_point_t * point,
+                           uint32_t time, uint32_t now)
+{
+    int32_t raw_x = (int32_t)point->x * (1 << POS_SHIFT);
+    int32_t raw_y = (int32_t)point->y * (1 << POS_SHIFT);
+    uint32_t dt = time - filter->last_time;
+
+    /*Also if the sample is older than the last one*/
+    if(!filter->valid || dt > LV_POINT_FILTER_GAP_MAX) {
+        filter->x.pos = raw_x;
+        filter->x.raw = raw_x;
+        filter->x.speed = 0;
+        filter->y.pos = raw_y;
+        filter->y.raw = raw_y;
+        filter->y.speed = 0;
+        filter->last_time = time;
+        filter->valid = 1;
+        return;
+    }
+
+    /*Another sample in the same millisecond*/
+    if(dt == 0) dt = 1;
+    filter->last_time = time;
+
+    axis_apply(&filter->x, cfg, raw_x, dt);
+    axis_apply(&filter->y, cfg, raw_y, dt);
+
+    int32_t x = filter->x.pos;
+    int32_t y = filter->y.pos;
+    if(cfg->predict_time) {
+        uint32_t horizon = now - time + cfg->predict_time;
+        if((int32_t)horizon < 0) horizon = cfg->predict_time;
+        if(horizon > LV_POINT_FILTER_PREDICT_MAX) horizon = LV_POINT_FILTER_PREDICT_MAX;
+
+        x += (int32_t)(((int64_t)filter->x.speed * horizon) / 1000);
+        y += (int32_t)(((int64_t)filter->y.speed * horizon) / 1000);
+    }
+
+    point->x = pos_to_coord(x);
+    point->y = pos_to_coord(y);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void axis_apply(lv_point_filter_axis_t * axis, const lv_point_filter_cfg_t * cfg, int32_t raw, uint32_t dt)
+{
+    int32_t speed = (int32_t)(((int64_t)(raw - axis->raw) * 1000) / (int32_t)dt);
+    axis->raw = raw;
+    axis->speed = smooth(axis->speed, speed, get_alpha(SPEED_CUTOFF, dt));
+
+    if(cfg->min_cutoff == 0) {
+        axis->pos = raw;
+        return;
+    }
+
+    uint32_t speed_abs = LV_MIN(LV_ABS(axis->speed) >> POS_SHIFT, UINT16_MAX);
+    uint32_t cutoff = cfg->min_cutoff + (cfg->beta * speed_abs) / 100;
+
+    axis->pos = smooth(axis->pos, raw, get_alpha(cutoff, dt));
+}
+
+/**
+ * Get the smoothing factor of an exponential filter
+ * @param cutoff    the cutoff frequency [0.1 Hz]
+ * @param dt        time since the last sample [ms]
+ * @return          the smoothing factor [1/4096]
+ */
+static int32_t get_alpha(uint32_t cutoff, uint32_t dt)
+{
+    uint32_t tau_us = TAU_DIV / cutoff;
+    uint32_t dt_us = dt * 1000;     /*At most LV_POINT_FILTER_GAP_MAX, so the shift doesn't overflow*/
+    return (int32_t)((dt_us << ALPHA_SHIFT) / (dt_us + tau_us));
+}
+
+static int32_t smooth(int32_t act, int32_t target, int32_t alpha)
+{
+    return act + (int32_t)(((int64_t)(target - act) * alpha) >> ALPHA_SHIFT);
+}
+
+static lv_coord_t pos_to_coord(int32_t pos)
+{
+    int32_t half = 1 << (POS_SHIFT - 1);
+    if(pos >= 0) return (lv_coord_t)((pos + half) >> POS_SHIFT);
+    else return (lv_coord_t)(-((-pos + half) >> POS_SHIFT));
+}
+
+#endif /*LV_USE_INDEV_FILTER*/
@@ -0,0 +1,94 @@
+/**
+ * @file lv_point_filter.h
+ * One-Euro filter and linear prediction of pointer coordinates in fixed point
+ */
+
+#ifndef LV_POINT_FILTER_H
+#define LV_POINT_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Don't extrapolate further than this [ms]*/
+#define LV_POINT_FILTER_PREDICT_MAX     100
+
+/*Start again from the raw point if there was no sample for this long [ms]*/
+#define LV_POINT_FILTER_GAP_MAX         100
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Parameters of the filter. The cutoff frequency of the low pass filter is
+ * `min_cutoff + beta * speed`, so the points are smoothed strongly at rest and lag little when moving fast.
+ */
+typedef struct {
+    uint16_t min_cutoff;    /**< Cutoff frequency at rest [0.1 Hz], 0: don't smooth*/
+    uint16_t beta;          /**< Increase of the cutoff frequency with the speed [0.001 Hz per px/s]*/
+    uint16_t predict_time;  /**< Extrapolate the points to this time after the read [ms], 0: don't extrapolate*/
+} lv_point_filter_cfg_t;
+
+/** State of a coordinate*/
+typedef struct {
+    int32_t pos;            /**< Filtered position [1/256 px]*/
+    int32_t raw;            /**< Last raw position [1/256 px]*/
+    int32_t speed;          /**< Filtered speed [1/256 px/s]*/
+} lv_point_filter_axis_t;
+
+/** State of the filter*/
+typedef struct {
+    lv_point_filter_axis_t x;
+    lv_point_filter_axis_t y;
+    uint32_t last_time;     /**< Time stamp of the last sample [ms]*/
+    uint8_t valid : 1;      /**< There was a sample since the reset*/
+} lv_point_filter_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_USE_INDEV_FILTER
+
+/**
+ * Forget the samples. The next sample is passed through unchanged.
+ * @param filter    pointer to a filter
+ */
+void lv_point_filter_reset(lv_point_filter_t * filter);
+
+/**
+ * Filter a sample and extrapolate it to `now + cfg->predict_time`
+ * @param filter    pointer to a filter
+ * @param cfg       parameters of the filter
+ * @param point     the raw point, it's replaced with the filtered and extrapolated point
+ * @param time      time stamp of the sample [ms]
+ * @param now       the current time [ms], at least `time`
+ */
+void lv_point_filter_apply(lv_point_filter_t * filter, const lv_point_filter_cfg_t * cfg, lv_point_t * point,
+                           uint32_t time, uint32_t now);
+
+#endif /*LV_USE_INDEV_FILTER*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_POINT_FILTER_H*/
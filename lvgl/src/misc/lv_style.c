@@ -138,6 +138,7 @@ uint32_t _lv_style_custom_prop_flag_lookup_table_size = 0;
 
 static uint16_t last_custom_prop_id = (uint16_t)_LV_STYLE_LAST_BUILT_IN_PROP;
 static const lv_style_value_t null_style_value = { .num = 0 };
+static void (*style_change_cb)(const lv_style_t * style);
 
 /**********************
  *      MACROS
@@ -159,6 +160,7 @@ void lv_style_init(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    if(style_change_cb) style_change_cb(style);
 }
 
 void lv_style_reset(lv_style_t * style)
@@ -175,6 +177,7 @@ void lv_style_reset(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    if(style_change_cb) style_change_cb(style);
 }
 
 lv_style_prop_t lv_style_register_prop(uint8_t flag)
@@ -229,6 +232,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+    if(style_change_cb) style_change_cb(style);
+
     if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop) {
             style->prop1 = LV_STYLE_PROP_INV;
@@ -376,6 +381,11 @@ uint8_t _lv_style_get_prop_group(lv_style_prop_t prop)
     return (uint8_t)group;
 }
 
+void _lv_style_set_change_cb(void (*cb)(const lv_style_t * style))
+{
+    style_change_cb = cb;
+}
+
 uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop)
 {
     extern const uint8_t _lv_style_builtin_prop_flag_lookup_table[];
@@ -420,6 +430,8 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
         return;
     }
 
+    if(style_change_cb) style_change_cb(style);
+
     lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(prop_and_meta);
 
     if(style->prop_cnt > 1) {
@@ -441,19 +453,27 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
 
         tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         props = (uint16_t *)tmp;
-        /*Shift all props to make place for the value before them*/
+        /*Keep the properties sorted by ID: find the position of the new one*/
+        int32_t pos = style->prop_cnt;
+        while(pos > 0 && LV_STYLE_PROP_ID_MASK(props[pos - 1]) > prop_id) pos--;
+
+        /*Shift all props to make place for the value before them and for the new prop at `pos`*/
         for(i = style->prop_cnt - 1; i >= 0; i--) {
-            props[i + sizeof(lv_style_value_t) / sizeof(uint16_t)] = props[i];
+            props[i + sizeof(lv_style_value_t) / sizeof(uint16_t) + (i >= pos ? 1 : 0)] = props[i];
+        }
+
+        lv_style_value_t * values = (lv_style_value_t *)values_and_props;
+        for(i = style->prop_cnt - 1; i >= pos; i--) {
+            values[i + 1] = values[i];
         }
         style->prop_cnt++;
 
         /*Go to the new position wit the props*/
         tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         props = (uint16_t *)tmp;
-        lv_style_value_t * values = (lv_style_value_t *)values_and_props;
 
         /*Set the new property and value*/
-        value_adjustment_helper(prop_and_meta, value, &props[style->prop_cnt - 1], &values[style->prop_cnt - 1]);
+        value_adjustment_helper(prop_and_meta, value, &props[pos], &values[pos]);
     }
     else if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop_id) {
@@ -470,9 +490,11 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
         uint8_t * tmp = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
         lv_style_value_t * values = (lv_style_value_t *)values_and_props;
-        props[0] = style->prop1;
-        values[0] = value_tmp;
-        value_adjustment_helper(prop_and_meta, value, &props[1], &values[1]);
+        /*Keep the properties sorted by ID*/
+        uint32_t old_i = LV_STYLE_PROP_ID_MASK(style->prop1) < prop_id ? 0 : 1;
+        props[old_i] = style->prop1;
+        values[old_i] = value_tmp;
+        value_adjustment_helper(prop_and_meta, value, &props[1 - old_i], &values[1 - old_i]);
     }
     else {
         style->prop_cnt = 1;
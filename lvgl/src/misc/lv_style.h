@@ -55,6 +55,23 @@ LV_EXPORT_CONST_INT(LV_IMG_ZOOM_NONE);
 #define LV_STYLE_CONST_INIT(var_name, prop_array) const lv_style_t var_name = { .v_p = { .const_props = prop_array }, .has_group = 0xFF, .prop1 = LV_STYLE_PROP_ANY }
 #endif
 
+/*Const style whose `prop_array` is sorted by the property IDs (see `scripts/style_api_gen.py --const-styles`).
+ *`group_mask` has the `1 << _lv_style_get_prop_group(prop)` bits of the properties set.
+ *`LV_STYLE_CONST_SORTED` is the initializer, e.g. for a style in a struct.*/
+#define _LV_STYLE_CONST_ARRAY_CNT(prop_array) (sizeof(prop_array) / sizeof((prop_array)[0]) - 1)
+#if LV_USE_ASSERT_STYLE
+#define LV_STYLE_CONST_SORTED(prop_array, group_mask) { .sentinel = LV_STYLE_SENTINEL_VALUE, .v_p = { .const_props = prop_array }, .has_group = group_mask, .prop1 = LV_STYLE_PROP_ANY, .prop_cnt = _LV_STYLE_CONST_ARRAY_CNT(prop_array) }
+#else
+#define LV_STYLE_CONST_SORTED(prop_array, group_mask) { .v_p = { .const_props = prop_array }, .has_group = group_mask, .prop1 = LV_STYLE_PROP_ANY, .prop_cnt = _LV_STYLE_CONST_ARRAY_CNT(prop_array) }
+#endif
+#define LV_STYLE_CONST_SORTED_INIT(var_name, prop_array, group_mask) const lv_style_t var_name = LV_STYLE_CONST_SORTED(prop_array, group_mask)
+
+/*Terminates the property arrays of the const styles*/
+#define LV_STYLE_CONST_PROPS_END { .prop = LV_STYLE_PROP_INV, .value = { .num = 0 } }
+
+/*Use binary search in the sorted properties of the styles with more properties than this*/
+#define LV_STYLE_BSEARCH_MIN_CNT    8
+
 /** On simple system, don't waste resources on gradients */
 #if !defined(LV_DRAW_COMPLEX) || !defined(LV_GRADIENT_MAX_STOPS)
 #define LV_GRADIENT_MAX_STOPS 2
@@ -321,7 +338,7 @@ typedef struct {
 
     uint16_t prop1;
     uint8_t has_group;
-    uint8_t prop_cnt;
+    uint8_t prop_cnt;   /*In const styles: 0 or the number of properties if they are sorted*/
 } lv_style_t;
 
 /**********************
@@ -439,17 +456,34 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
                                                        lv_style_value_t * value)
 {
     if(style->prop1 == LV_STYLE_PROP_ANY) {
-        const lv_style_const_prop_t * const_prop;
-        for(const_prop = style->v_p.const_props; const_prop->prop != LV_STYLE_PROP_INV; const_prop++) {
-            lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(const_prop->prop);
-            if(prop_id == prop) {
-                if(const_prop->prop & LV_STYLE_PROP_META_INHERIT)
-                    return LV_STYLE_RES_INHERIT;
-                *value = (const_prop->prop & LV_STYLE_PROP_META_INITIAL) ? lv_style_prop_get_default(prop_id) : const_prop->value;
-                return LV_STYLE_RES_FOUND;
+        const lv_style_const_prop_t * const_prop = NULL;
+        if(style->prop_cnt > LV_STYLE_BSEARCH_MIN_CNT) {
+            const lv_style_const_prop_t * const_props = style->v_p.const_props;
+            uint32_t first = 0;
+            uint32_t last = style->prop_cnt;
+            while(first < last) {
+                uint32_t mid = (first + last) >> 1;
+                lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(const_props[mid].prop);
+                if(prop_id == prop) {
+                    const_prop = &const_props[mid];
+                    break;
+                }
+                if(prop_id < prop) first = mid + 1;
+                else last = mid;
             }
         }
-        return LV_STYLE_RES_NOT_FOUND;
+        else {
+            for(const_prop = style->v_p.const_props; const_prop->prop != LV_STYLE_PROP_INV; const_prop++) {
+                if(LV_STYLE_PROP_ID_MASK(const_prop->prop) == prop) break;
+            }
+            if(const_prop->prop == LV_STYLE_PROP_INV) const_prop = NULL;
+        }
+
+        if(const_prop == NULL) return LV_STYLE_RES_NOT_FOUND;
+        if(const_prop->prop & LV_STYLE_PROP_META_INHERIT)
+            return LV_STYLE_RES_INHERIT;
+        *value = (const_prop->prop & LV_STYLE_PROP_META_INITIAL) ? lv_style_prop_get_default(prop) : const_prop->value;
+        return LV_STYLE_RES_FOUND;
     }
 
     if(style->prop_cnt == 0) return LV_STYLE_RES_NOT_FOUND;
@@ -457,8 +491,15 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
     if(style->prop_cnt > 1) {
         uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
-        uint32_t i;
-        for(i = 0; i < style->prop_cnt; i++) {
+        uint32_t i = 0;
+        uint32_t last = style->prop_cnt;
+        /*The properties are sorted by ID. Narrow down the range before the linear search.*/
+        while(last - i > LV_STYLE_BSEARCH_MIN_CNT) {
+            uint32_t mid = (i + last) >> 1;
+            if(LV_STYLE_PROP_ID_MASK(props[mid]) <= prop) i = mid;
+            else last = mid;
+        }
+        for(; i < last; i++) {
             lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(props[i]);
             if(prop_id == prop) {
                 if(props[i] & LV_STYLE_PROP_META_INHERIT)
@@ -506,6 +547,13 @@ uint8_t _lv_style_get_prop_group(lv_style_prop_t prop);
  */
 uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop);
 
+/**
+ * Set a function to call whenever a style is initialized, reset or modified.
+ * Values read from styles can be cached until the style they were read from changes.
+ * @param cb    the function to call with the changed style or NULL
+ */
+void _lv_style_set_change_cb(void (*cb)(const lv_style_t * style));
+
 #include "lv_style_gen.h"
 
 static inline void lv_style_set_size(lv_style_t * style, lv_coord_t value)
@@ -17,6 +17,11 @@
  *********************/
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_MIN_SIZE 8
+
+/*Keep the deadlines less than a quarter of the tick range ahead
+ *to compare them safely with a signed subtraction*/
+#define DEADLINE_MAX_AHEAD (UINT32_MAX / 4)
 
 /**********************
  *      TYPEDEFS
@@ -25,16 +30,26 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
+static void lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static void timer_set_deadline(lv_timer_t * timer, uint32_t deadline);
+static uint32_t timer_calc_deadline(lv_timer_t * timer);
+static bool heap_push(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(uint32_t i);
+static void heap_sift_up(uint32_t i);
+static void heap_sift_down(uint32_t i);
+static bool heap_before(const lv_timer_t * a, const lv_timer_t * b);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
-static bool timer_deleted;
-static bool timer_created;
+static uint32_t heap_cnt;
+static uint32_t heap_size;
+static uint32_t handler_run_id;
+static uint32_t timer_seq;
 
 /**********************
  *      MACROS
@@ -55,6 +70,9 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    heap_size = 0;
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -95,41 +113,33 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    do {
-        timer_deleted             = false;
-        timer_created             = false;
-        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-        while(LV_GC_ROOT(_lv_timer_act)) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
-
-            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(timer_created || timer_deleted) {
-                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
+    /*Run the timers in the order of their deadline. Only the expired ones are visited.
+     *Timers created or deleted in the callbacks are added to or removed from the heap directly.*/
+    handler_run_id++;
+    while(heap_cnt > 0) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        uint32_t now = lv_tick_get();
+        if((int32_t)(timer->deadline - now) > 0) break;
+
+        if(timer->run_id == handler_run_id) {
+            /*Run a timer at most once per call (e.g. with 0 period). Check it again later.*/
+            timer_set_deadline(timer, now + 1);
         }
-    } while(LV_GC_ROOT(_lv_timer_act));
-
-    uint32_t time_till_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_till_next)
-                time_till_next = delay;
+        else if(timer->repeat_count == 0) {
+            TIMER_TRACE("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_del(timer);
+        }
+        else if(lv_timer_time_remaining(timer) > 0) {
+            /*Only a clamped deadline of a long period has expired*/
+            timer_set_deadline(timer, timer_calc_deadline(timer));
+        }
+        else {
+            lv_timer_exec(timer);
         }
-
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
     }
 
+    uint32_t time_till_next = lv_timer_get_time_till_next();
+
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
@@ -178,8 +188,15 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->paused = 0;
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
-
-    timer_created = true;
+    new_timer->run_id = 0;
+    new_timer->seq = timer_seq++;
+    new_timer->deadline = timer_calc_deadline(new_timer);
+
+    if(heap_push(new_timer) == false) {
+        _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), new_timer);
+        lv_mem_free(new_timer);
+        return NULL;
+    }
 
     return new_timer;
 }
@@ -200,8 +217,11 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
  */
 void lv_timer_del(lv_timer_t * timer)
 {
+    if(!timer->paused) heap_remove(timer);
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
-    timer_deleted = true;
+
+    /*Let the handler know if the running timer deleted itself*/
+    if(LV_GC_ROOT(_lv_timer_act) == timer) LV_GC_ROOT(_lv_timer_act) = NULL;
 
     lv_mem_free(timer);
 }
@@ -212,12 +232,18 @@ void lv_timer_del(lv_timer_t * timer)
  */
 void lv_timer_pause(lv_timer_t * timer)
 {
+    if(timer->paused) return;
+
+    heap_remove(timer);
     timer->paused = true;
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
-    timer->paused = false;
+    if(!timer->paused) return;
+
+    timer->deadline = timer_calc_deadline(timer);
+    if(heap_push(timer)) timer->paused = false;
 }
 
 /**
@@ -228,6 +254,7 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+    timer_set_deadline(timer, timer_calc_deadline(timer));
 }
 
 /**
@@ -237,6 +264,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+    timer_set_deadline(timer, lv_tick_get());
 }
 
 /**
@@ -247,6 +275,7 @@ void lv_timer_ready(lv_timer_t * timer)
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+    timer_set_deadline(timer, timer_calc_deadline(timer));
 }
 
 /**
@@ -257,6 +286,7 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+    timer_set_deadline(timer, timer_calc_deadline(timer));
 }
 
 /**
@@ -277,6 +307,18 @@ uint8_t lv_timer_get_idle(void)
     return idle_last;
 }
 
+/**
+ * Get the time until the earliest running timer needs to run, without calling `lv_timer_handler()`
+ * @return time until the next timer in ms, 0 if a timer is ready or `LV_NO_TIMER_READY` if no timer is running
+ */
+uint32_t lv_timer_get_time_till_next(void)
+{
+    if(heap_cnt == 0) return LV_NO_TIMER_READY;
+
+    int32_t diff = (int32_t)(LV_GC_ROOT(_lv_timer_heap)[0]->deadline - lv_tick_get());
+    return diff > 0 ? (uint32_t)diff : 0;
+}
+
 /**
  * Iterate through the timers
  * @param timer NULL to start iteration or the previous return value to get the next timer
@@ -293,37 +335,34 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
+ * Execute an expired timer and schedule its next run or delete it if the repeat count is over
  * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
  */
-static bool lv_timer_exec(lv_timer_t * timer)
+static void lv_timer_exec(lv_timer_t * timer)
 {
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
-        TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
-    }
-
-    if(timer_deleted == false) { /*The timer might be deleted by itself as well*/
-        if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
-            TIMER_TRACE("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-            lv_timer_del(timer);
-        }
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted in the callback `if(timer->repeat_count == 0)` is not executed below*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    timer->run_id = handler_run_id;
+    LV_GC_ROOT(_lv_timer_act) = timer;
+    TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
+    if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+    TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
+    LV_ASSERT_MEM_INTEGRITY();
+
+    /*The timer was deleted by itself*/
+    if(LV_GC_ROOT(_lv_timer_act) == NULL) return;
+    LV_GC_ROOT(_lv_timer_act) = NULL;
+
+    if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
+        TIMER_TRACE("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+        lv_timer_del(timer);
+        return;
     }
 
-    return exec;
+    timer_set_deadline(timer, timer_calc_deadline(timer));
 }
 
 /**
@@ -339,3 +378,113 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+/**
+ * Get the tick at which a timer needs to be checked again.
+ * Long periods are clamped, the handler checks the timer again when the clamped deadline expires.
+ * @param timer pointer to lv_timer
+ * @return the new deadline
+ */
+static uint32_t timer_calc_deadline(lv_timer_t * timer)
+{
+    /*A timer whose repeat count is over is deleted in the next call of the handler*/
+    if(timer->repeat_count == 0) return lv_tick_get();
+
+    return lv_tick_get() + LV_MIN(lv_timer_time_remaining(timer), DEADLINE_MAX_AHEAD);
+}
+
+/**
+ * Set the deadline of a timer and restore the heap order if the timer is running
+ * @param timer pointer to lv_timer
+ * @param deadline the new deadline
+ */
+static void timer_set_deadline(lv_timer_t * timer, uint32_t deadline)
+{
+    timer->deadline = deadline;
+    if(!timer->paused) heap_update(timer->heap_index);
+}
+
+static bool heap_push(lv_timer_t * timer)
+{
+    if(heap_cnt == heap_size) {
+        uint32_t new_size = heap_size ? heap_size * 2 : HEAP_MIN_SIZE;
+        lv_timer_t ** new_heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return false;
+        LV_GC_ROOT(_lv_timer_heap) = new_heap;
+        heap_size = new_size;
+    }
+
+    LV_GC_ROOT(_lv_timer_heap)[heap_cnt] = timer;
+    timer->heap_index = heap_cnt;
+    heap_cnt++;
+    heap_sift_up(timer->heap_index);
+    return true;
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_index;
+    heap_cnt--;
+    if(i == heap_cnt) return;
+
+    /*Fill the gap with the last timer and move it to its place*/
+    lv_timer_t * last = LV_GC_ROOT(_lv_timer_heap)[heap_cnt];
+    LV_GC_ROOT(_lv_timer_heap)[i] = last;
+    last->heap_index = i;
+    heap_update(i);
+}
+
+static void heap_update(uint32_t i)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    if(i > 0 && heap_before(heap[i], heap[(i - 1) / 2])) heap_sift_up(i);
+    else heap_sift_down(i);
+}
+
+static void heap_sift_up(uint32_t i)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[i];
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!heap_before(timer, heap[parent])) break;
+        heap[i] = heap[parent];
+        heap[i]->heap_index = i;
+        i = parent;
+    }
+    heap[i] = timer;
+    timer->heap_index = i;
+}
+
+static void heap_sift_down(uint32_t i)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[i];
+    while(1) {
+        uint32_t child = 2 * i + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && heap_before(heap[child + 1], heap[child])) child++;
+        if(!heap_before(heap[child], timer)) break;
+        heap[i] = heap[child];
+        heap[i]->heap_index = i;
+        i = child;
+    }
+    heap[i] = timer;
+    timer->heap_index = i;
+}
+
+/**
+ * Compare two timers in the heap. The earlier deadline comes first. With the same deadline
+ * the newer timer comes first, like in the list which the timers were run from before,
+ * e.g. the input device read timer runs before the refresh timer of its display.
+ * @param a     pointer to a timer
+ * @param b     pointer to an other timer
+ * @return      true: `a` has to run before `b`
+ */
+static bool heap_before(const lv_timer_t * a, const lv_timer_t * b)
+{
+    int32_t diff = (int32_t)(a->deadline - b->deadline);
+    if(diff != 0) return diff < 0;
+    return (int32_t)(a->seq - b->seq) > 0;
+}
@@ -39,7 +39,9 @@ struct _lv_timer_t;
 typedef void (*lv_timer_cb_t)(struct _lv_timer_t *);
 
 /**
- * Descriptor of a lv_timer
+ * Descriptor of a lv_timer.
+ * The fields are read-only, use the `lv_timer_set_...()` functions to modify them
+ * as the running timers are ordered by their deadline.
  */
 typedef struct _lv_timer_t {
     uint32_t period; /**< How often the timer should run*/
@@ -48,6 +50,10 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused : 1;
+    uint32_t heap_index : 31; /**< Internal: position in the heap of the running timers*/
+    uint32_t deadline; /**< Internal: tick at which the timer needs to be checked*/
+    uint32_t run_id; /**< Internal: ID of the last `lv_timer_handler()` call which ran the timer*/
+    uint32_t seq; /**< Internal: creation order, the newer of the timers with the same deadline runs first*/
 } lv_timer_t;
 
 /**********************
@@ -165,6 +171,12 @@ void lv_timer_enable(bool en);
  */
 uint8_t lv_timer_get_idle(void);
 
+/**
+ * Get the time until the earliest running timer needs to run, without calling `lv_timer_handler()`
+ * @return time until the next timer in ms, 0 if a timer is ready or `LV_NO_TIMER_READY` if no timer is running
+ */
+uint32_t lv_timer_get_time_till_next(void);
+
 /**
  * Iterate through the timers
  * @param timer NULL to start iteration or the previous return value to get the next timer
@@ -10,7 +10,11 @@
 #undef  printf
 #define printf LV_LOG_ERROR
 
-#define TLSF_MAX_POOL_SIZE LV_MEM_SIZE
+#if LV_MEM_EXT && LV_MEM_EXT_SIZE > LV_MEM_SIZE
+    #define TLSF_MAX_POOL_SIZE LV_MEM_EXT_SIZE
+#else
+    #define TLSF_MAX_POOL_SIZE LV_MEM_SIZE
+#endif
 
 #if !defined(_DEBUG)
     #define _DEBUG 0
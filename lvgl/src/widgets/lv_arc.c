@@ -48,7 +48,11 @@ const lv_obj_class_t lv_arc_class  = {
     .event_cb = lv_arc_event,
     .instance_size = sizeof(lv_arc_t),
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .handled_events = LV_EVENT_MASK(LV_EVENT_PRESSING) | LV_EVENT_MASK(LV_EVENT_RELEASED) |
+                      LV_EVENT_MASK(LV_EVENT_PRESS_LOST) | LV_EVENT_MASK(LV_EVENT_KEY) |
+                      LV_EVENT_MASK(LV_EVENT_HIT_TEST) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                      LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
 };
 
 /**********************
@@ -64,7 +64,9 @@ const lv_obj_class_t lv_bar_class = {
     .width_def = LV_DPI_DEF * 2,
     .height_def = LV_DPI_DEF / 10,
     .instance_size = sizeof(lv_bar_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .handled_events = LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) | LV_EVENT_MASK(LV_EVENT_PRESSED) |
+                      LV_EVENT_MASK(LV_EVENT_RELEASED) | LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
 };
 
 /**********************
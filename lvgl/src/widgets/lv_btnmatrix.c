@@ -67,7 +67,13 @@ const lv_obj_class_t lv_btnmatrix_class = {
     .instance_size = sizeof(lv_btnmatrix_t),
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .handled_events = LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) | LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) |
+                      LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) | LV_EVENT_MASK(LV_EVENT_PRESSED) |
+                      LV_EVENT_MASK(LV_EVENT_PRESSING) | LV_EVENT_MASK(LV_EVENT_RELEASED) |
+                      LV_EVENT_MASK(LV_EVENT_LONG_PRESSED_REPEAT) | LV_EVENT_MASK(LV_EVENT_PRESS_LOST) |
+                      LV_EVENT_MASK(LV_EVENT_FOCUSED) | LV_EVENT_MASK(LV_EVENT_DEFOCUSED) |
+                      LV_EVENT_MASK(LV_EVENT_LEAVE) | LV_EVENT_MASK(LV_EVENT_KEY) | LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
 };
 
 /**********************
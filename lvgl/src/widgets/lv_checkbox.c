@@ -42,7 +42,9 @@ const lv_obj_class_t lv_checkbox_class = {
     .height_def = LV_SIZE_CONTENT,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
     .instance_size = sizeof(lv_checkbox_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .handled_events = LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                      LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
 };
 
 /**********************
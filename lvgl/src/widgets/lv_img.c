@@ -44,7 +44,11 @@ const lv_obj_class_t lv_img_class = {
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_img_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .handled_events = LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                      LV_EVENT_MASK(LV_EVENT_HIT_TEST) | LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) |
+                      LV_EVENT_MASK(LV_EVENT_DRAW_MAIN) | LV_EVENT_MASK(LV_EVENT_DRAW_POST) |
+                      LV_EVENT_MASK(LV_EVENT_COVER_CHECK),
 };
 
 /**********************
@@ -40,7 +40,9 @@ const lv_obj_class_t lv_line_class = {
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_line_t),
-    .base_class = &lv_obj_class
+    .base_class = &lv_obj_class,
+    .handled_events = LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) | LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) |
+                      LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
 };
 
 /**********************
@@ -46,7 +46,12 @@ const lv_obj_class_t lv_slider_class = {
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
     .instance_size = sizeof(lv_slider_t),
-    .base_class = &lv_bar_class
+    .base_class = &lv_bar_class,
+    .handled_events = LV_EVENT_MASK(LV_EVENT_HIT_TEST) | LV_EVENT_MASK(LV_EVENT_PRESSED) |
+                      LV_EVENT_MASK(LV_EVENT_PRESSING) | LV_EVENT_MASK(LV_EVENT_RELEASED) |
+                      LV_EVENT_MASK(LV_EVENT_PRESS_LOST) | LV_EVENT_MASK(LV_EVENT_FOCUSED) |
+                      LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                      LV_EVENT_MASK(LV_EVENT_KEY) | LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
 };
 
 /**********************
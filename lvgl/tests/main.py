@@ -81,7 +81,7 @@ def get_build_dir(options_name):
     return os.path.join(lvgl_test_dir, get_base_buid_dir(options_name))
 
 
-def build_tests(options_name, build_type, clean):
+def build_tests(options_name, build_type, clean, soak_cycles):
     '''Build all tests for the specified options name.'''
     global lvgl_test_dir
 
@@ -104,9 +104,12 @@ def build_tests(options_name, build_type, clean):
         os.mkdir(build_dir)
         created_build_dir = True
     os.chdir(build_dir)
+    # Configure every time so that the soak cycles of an earlier run don't stick
+    cmake_args = ['cmake', '-DLVGL_TEST_SOAK_CYCLES=%s' % (soak_cycles or '')]
     if created_build_dir:
-        subprocess.check_call(['cmake', '-DCMAKE_BUILD_TYPE=%s' % build_type,
-                               '-D%s=1' % options_name, '..'])
+        cmake_args += ['-DCMAKE_BUILD_TYPE=%s' % build_type,
+                       '-D%s=1' % options_name]
+    subprocess.check_call(cmake_args + ['..'])
     subprocess.check_call(['cmake', '--build', build_dir,
                            '--parallel', str(os.cpu_count())])
 
@@ -171,6 +174,11 @@ if __name__ == "__main__":
                         help='clean existing build artifacts before operation.')
     parser.add_argument('--report', action='store_true',
                         help='generate code coverage report for tests.')
+    parser.add_argument('--soak-cycles', type=int,
+                        help='''create/delete cycles of the memory soak test.
+                        When omitted the short run of the regular tests is
+                        used. E.g. 1000000 for a long run.
+                        ''')
     parser.add_argument('actions', nargs='*', choices=['build', 'test'],
                         help='build: compile build tests, test: compile/run executable tests.')
 
@@ -197,7 +205,7 @@ if __name__ == "__main__":
     for options_name in options_to_build:
         is_test = options_name in test_options
         build_type = 'Debug'
-        build_tests(options_name, build_type, args.clean)
+        build_tests(options_name, build_type, args.clean, args.soak_cycles)
         if is_test:
             try:
                 run_tests(options_name)
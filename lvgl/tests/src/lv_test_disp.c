@@ -0,0 +1,92 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "lv_test_disp.h"
+#include "../unity/unity.h"
+
+lv_color_t * lv_test_disp_front_buf;
+uint32_t lv_test_disp_frame_cnt;
+uint32_t lv_test_disp_flush_cnt;
+
+static lv_color_t buf1[LV_TEST_DISP_PX_CNT];
+static lv_color_t buf2[LV_TEST_DISP_PX_CNT];
+static lv_color_t ref_buf[LV_TEST_DISP_PX_CNT];
+
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t disp_drv;
+static lv_disp_t * disp;
+static lv_disp_t * disp_def;
+
+lv_disp_t * lv_test_disp_create(bool double_buffered, void (*drv_init_cb)(lv_disp_drv_t * drv))
+{
+    lv_test_disp_front_buf = buf1;
+    lv_test_disp_frame_cnt = 0;
+    lv_test_disp_flush_cnt = 0;
+
+    lv_disp_draw_buf_init(&draw_buf, buf1, double_buffered ? buf2 : NULL, LV_TEST_DISP_PX_CNT);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = lv_test_disp_flush_cb;
+    disp_drv.hor_res = LV_TEST_DISP_HOR_RES;
+    disp_drv.ver_res = LV_TEST_DISP_VER_RES;
+    disp_drv.direct_mode = 1;
+    if(drv_init_cb) drv_init_cb(&disp_drv);
+
+    disp_def = lv_disp_get_default();
+    disp = lv_disp_drv_register(&disp_drv);
+    lv_disp_set_default(disp);
+    return disp;
+}
+
+void lv_test_disp_delete(void)
+{
+    if(disp == NULL) return;
+
+    lv_disp_remove(disp);
+    lv_disp_set_default(disp_def);
+    disp = NULL;
+
+    /*The draw context is not freed with the display*/
+    disp_drv.draw_ctx_deinit(&disp_drv, disp_drv.draw_ctx);
+    lv_mem_free(disp_drv.draw_ctx);
+}
+
+void lv_test_disp_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(area);
+    lv_test_disp_flush_cnt++;
+    if(lv_disp_flush_is_last(drv)) {
+        lv_test_disp_front_buf = color_p;
+        lv_test_disp_frame_cnt++;
+    }
+    lv_disp_flush_ready(drv);
+}
+
+lv_obj_t * lv_test_disp_create_content(lv_obj_t * parent, lv_palette_t palette)
+{
+    lv_obj_t * scr = parent ? parent : lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(palette, 4), 0);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(palette), 0);
+        lv_obj_set_pos(obj, 10 + i * 35, 10 + i * 30);
+        lv_obj_set_size(obj, 60, 40);
+
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text_fmt(label, "%d", (int)i);
+    }
+
+    return scr;
+}
+
+void lv_test_disp_check_full_redraw(void)
+{
+    TEST_ASSERT_NOT_NULL(disp);
+    lv_memcpy(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef LV_TEST_DISP_H
+#define LV_TEST_DISP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../lvgl.h"
+
+/*A small display for the tests of the display driver features*/
+#define LV_TEST_DISP_HOR_RES    200
+#define LV_TEST_DISP_VER_RES    150
+#define LV_TEST_DISP_PX_CNT     (LV_TEST_DISP_HOR_RES * LV_TEST_DISP_VER_RES)
+
+/**
+ * Register a display in direct mode and make it the default.
+ * `lv_test_disp_delete()` removes it and restores the previous default display.
+ * @param double_buffered   true: two buffers; false: one buffer
+ * @param drv_init_cb       called to set the other fields of the driver before it's registered. Can be NULL.
+ * @return                  the new display
+ */
+lv_disp_t * lv_test_disp_create(bool double_buffered, void (*drv_init_cb)(lv_disp_drv_t * drv));
+
+/**
+ * Remove the display created by `lv_test_disp_create()`, if any, and free its draw context
+ */
+void lv_test_disp_delete(void);
+
+/**
+ * The flush callback of the display. Counts the flushes and saves the buffer of the last complete frame.
+ * Custom flush callbacks should call it at the end.
+ */
+void lv_test_disp_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+
+/**
+ * Create a few rectangles with labels as the content of a screen or an other object
+ * @param parent    the parent of the content. NULL: create a new screen
+ * @param palette   color of the background and the rectangles
+ * @return          `parent` or the new screen
+ */
+lv_obj_t * lv_test_disp_create_content(lv_obj_t * parent, lv_palette_t palette);
+
+/**
+ * Render the whole active screen again and check that the image doesn't change
+ */
+void lv_test_disp_check_full_redraw(void);
+
+extern lv_color_t * lv_test_disp_front_buf;     /*The buffer of the last complete frame*/
+extern uint32_t lv_test_disp_frame_cnt;         /*Number of complete frames*/
+extern uint32_t lv_test_disp_flush_cnt;         /*Number of flushed areas*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEST_DISP_H*/
@@ -0,0 +1,155 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+#define ANIM_CNT    500
+
+static int32_t values[ANIM_CNT];
+static uint32_t ready_cnt;
+static uint32_t deleted_cnt;
+static int32_t extra_value;
+
+void setUp(void)
+{
+    ready_cnt = 0;
+    deleted_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_anim_del_all();
+    lv_obj_clean(lv_scr_act());
+}
+
+static void store_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+static void set_x_cb(void * obj, int32_t v)
+{
+    lv_obj_set_x(obj, v);
+}
+
+static void set_y_cb(void * obj, int32_t v)
+{
+    lv_obj_set_y(obj, v);
+}
+
+static void deleted_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    deleted_cnt++;
+}
+
+/*Change the list from a ready callback: delete an other animation and start a new one*/
+static void ready_cb(lv_anim_t * a)
+{
+    ready_cnt++;
+    if(a->var == &values[250]) {
+        lv_anim_del(&values[100], NULL);
+
+        lv_anim_t a_new;
+        lv_anim_init(&a_new);
+        lv_anim_set_var(&a_new, &extra_value);
+        lv_anim_set_exec_cb(&a_new, store_cb);
+        lv_anim_set_values(&a_new, 0, 10);
+        lv_anim_set_time(&a_new, 50);
+        lv_anim_start(&a_new);
+    }
+}
+
+void test_anim_many_finish_together(void)
+{
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        values[i] = -1;
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &values[i]);
+        lv_anim_set_exec_cb(&a, store_cb);
+        lv_anim_set_values(&a, 0, 400);
+        lv_anim_set_time(&a, 100);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+        lv_anim_set_ready_cb(&a, ready_cb);
+        lv_anim_set_deleted_cb(&a, deleted_cb);
+        lv_anim_start(&a);
+    }
+    extra_value = -1;
+
+    /*The list is read from the newest, so values[100] is deleted before it's ready*/
+    lv_tick_inc(100);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_UINT32(ANIM_CNT - 1, ready_cnt);
+    TEST_ASSERT_EQUAL_UINT32(ANIM_CNT, deleted_cnt);
+    for(i = 0; i < ANIM_CNT; i++) {
+        if(i != 100) TEST_ASSERT_EQUAL_INT32(400, values[i]);
+    }
+
+    /*Only the animation started in the ready callback remains*/
+    TEST_ASSERT_EQUAL_UINT32(1, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_INT32(0, extra_value);
+    lv_tick_inc(50);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_INT32(10, extra_value);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_count_running());
+}
+
+void test_anim_500_objects(void)
+{
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_scr_act());
+        lv_obj_set_size(obj, 20, 20);
+        lv_obj_set_pos(obj, (i % 25) * 30, (i / 25) * 22);
+
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, obj);
+        lv_anim_set_exec_cb(&a, set_x_cb);
+        lv_anim_set_values(&a, 0, 400);
+        lv_anim_set_time(&a, 1000 + i);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+        lv_anim_start(&a);
+
+        /*An other animation of the same objects*/
+        lv_anim_set_exec_cb(&a, set_y_cb);
+        lv_anim_set_values(&a, 0, 200);
+        lv_anim_start(&a);
+    }
+    lv_refr_now(NULL);
+
+    /*Run the animations and the style refreshes they trigger, like a refresh period does*/
+    lv_obj_style_refr_stat_t stat_start;
+    lv_obj_get_style_refr_stat(&stat_start);
+    uint32_t tick_cnt = 0;
+    clock_t t = clock();
+    while(lv_anim_count_running()) {
+        lv_tick_inc(16);
+        lv_anim_refr_now();
+        lv_obj_refresh_style_pending();
+        tick_cnt++;
+    }
+    double us = (double)(clock() - t) * 1e6 / CLOCKS_PER_SEC / tick_cnt;
+
+    lv_obj_style_refr_stat_t stat;
+    lv_obj_get_style_refr_stat(&stat);
+    uint32_t refr_cnt = stat.refr_cnt - stat_start.refr_cnt;
+    uint32_t merged_cnt = stat.refr_merged_cnt - stat_start.refr_merged_cnt;
+    TEST_PRINTF("%d animations: %d us per tick, %d of %d style refreshes merged",
+                ANIM_CNT * 2, (int)us, (int)merged_cnt, (int)refr_cnt);
+
+    /*When both the x and y of an object change in a tick their refreshes are merged*/
+    TEST_ASSERT_GREATER_THAN_UINT32(refr_cnt / 4, merged_cnt);
+
+    lv_obj_update_layout(lv_scr_act());
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_obj_t * obj = lv_obj_get_child(lv_scr_act(), i);
+        TEST_ASSERT_EQUAL_INT32(400, lv_obj_get_x(obj));
+        TEST_ASSERT_EQUAL_INT32(200, lv_obj_get_y(obj));
+    }
+}
+
+#endif
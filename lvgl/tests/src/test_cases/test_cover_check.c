@@ -0,0 +1,159 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * objs[4];
+static lv_style_t style_pressed;
+
+void setUp(void)
+{
+    lv_style_init(&style_pressed);
+    lv_style_set_bg_opa(&style_pressed, LV_OPA_50);
+    lv_style_set_radius(&style_pressed, 20);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(objs) / sizeof(objs[0]); i++) {
+        objs[i] = lv_obj_create(lv_scr_act());
+        lv_obj_set_pos(objs[i], 20 + i * 150, 20);
+        lv_obj_set_size(objs[i], 120, 100);
+        lv_obj_add_style(objs[i], &style_pressed, LV_STATE_PRESSED);
+    }
+
+    lv_obj_update_layout(lv_scr_act());
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_style_reset(&style_pressed);
+}
+
+/*The cover check of the base object reading the styles every time*/
+static lv_cover_res_t ref_cover_check(lv_obj_t * obj, const lv_area_t * area)
+{
+    if(lv_obj_get_style_clip_corner(obj, LV_PART_MAIN)) return LV_COVER_RES_MASKED;
+
+    lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    lv_coord_t w = lv_obj_get_style_transform_width(obj, LV_PART_MAIN);
+    lv_coord_t h = lv_obj_get_style_transform_height(obj, LV_PART_MAIN);
+    lv_area_t coords = obj->coords;
+    coords.x1 -= w;
+    coords.x2 += w;
+    coords.y1 -= h;
+    coords.y2 += h;
+    if(_lv_area_is_in(area, &coords, r) == false) return LV_COVER_RES_NOT_COVER;
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return LV_COVER_RES_NOT_COVER;
+
+    return LV_COVER_RES_COVER;
+}
+
+static void assert_same_as_ref(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(objs) / sizeof(objs[0]); i++) {
+        lv_obj_t * obj = objs[i];
+        lv_area_t a;
+        lv_coord_t d;
+        for(d = -10; d <= 30; d += 5) {
+            /*Shrink or grow the object's area*/
+            a.x1 = obj->coords.x1 + d;
+            a.y1 = obj->coords.y1 + d;
+            a.x2 = obj->coords.x2 - d;
+            a.y2 = obj->coords.y2 - d;
+            TEST_ASSERT_EQUAL(ref_cover_check(obj, &a), _lv_obj_check_cover(obj, &a));
+
+            /*A corner*/
+            a.x1 = obj->coords.x1 + d;
+            a.y1 = obj->coords.y1 + d;
+            a.x2 = a.x1 + 20;
+            a.y2 = a.y1 + 20;
+            TEST_ASSERT_EQUAL(ref_cover_check(obj, &a), _lv_obj_check_cover(obj, &a));
+        }
+    }
+}
+
+void test_cover_check_same_as_styles(void)
+{
+    assert_same_as_ref();
+
+    lv_obj_set_style_radius(objs[0], 0, 0);
+    assert_same_as_ref();
+
+    lv_obj_set_style_bg_opa(objs[1], LV_OPA_80, 0);
+    assert_same_as_ref();
+
+    lv_obj_set_style_transform_width(objs[2], 15, 0);
+    lv_obj_set_style_transform_height(objs[2], -10, 0);
+    assert_same_as_ref();
+
+    lv_obj_set_style_clip_corner(objs[3], true, 0);
+    assert_same_as_ref();
+
+    /*State change*/
+    lv_obj_add_state(objs[0], LV_STATE_PRESSED);
+    assert_same_as_ref();
+    lv_obj_clear_state(objs[0], LV_STATE_PRESSED);
+    assert_same_as_ref();
+
+    /*Change in a shared style*/
+    lv_obj_add_state(objs[1], LV_STATE_PRESSED);
+    assert_same_as_ref();
+    lv_style_set_bg_opa(&style_pressed, LV_OPA_COVER);
+    lv_style_set_radius(&style_pressed, 0);
+    lv_obj_report_style_change(&style_pressed);
+    assert_same_as_ref();
+
+    /*Moved and resized*/
+    lv_obj_set_pos(objs[2], 300, 200);
+    lv_obj_set_size(objs[3], 30, 40);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+}
+
+#if LV_OBJ_COVER_CACHE && LV_OBJ_EVENT_MASK
+static uint32_t cover_event_cnt;
+
+static void cover_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    cover_event_cnt++;
+}
+#endif
+
+void test_cover_check_without_events(void)
+{
+#if LV_OBJ_COVER_CACHE && LV_OBJ_EVENT_MASK
+    lv_obj_t * label = lv_label_create(objs[0]);
+    lv_label_set_text(label, "Label");
+    lv_obj_t * btn = lv_btn_create(objs[1]);
+    lv_obj_set_size(btn, 60, 40);
+
+    /*Redraw areas inside the objects too, to check them and their children*/
+    lv_event_stat_t stat;
+    lv_area_t a;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_event_reset_stat();
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_area_copy(&a, &objs[i]->coords);
+        lv_area_increase(&a, -20, -20);
+        lv_obj_invalidate_area(objs[i], &a);
+        lv_refr_now(NULL);
+    }
+    lv_event_get_stat(LV_EVENT_COVER_CHECK, &stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.sent_cnt);
+
+    /*Objects having a cover check event callback still get the event*/
+    lv_obj_add_event_cb(objs[2], cover_event_cb, LV_EVENT_COVER_CHECK, NULL);
+    cover_event_cnt = 0;
+    lv_area_copy(&a, &objs[2]->coords);
+    lv_area_increase(&a, -20, -20);
+    lv_obj_invalidate_area(objs[2], &a);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, cover_event_cnt);
+#endif
+}
+
+#endif
@@ -28,5 +28,37 @@ void test_demo_stress(void)
     TEST_ASSERT_EQUAL(mem_before, lv_test_get_free_mem());
 }
 
+void test_demo_stress_fragmentation(void)
+{
+#if LV_USE_DEMO_STRESS && LV_MEM_CUSTOM == 0
+    /*Continue the stress test and see how the heap looks like after many more cycles*/
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+    for(uint32_t i = 0; i < 10; i++) {
+        loop_through_stress_test();
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_PRINTF("heap: used %d%%, frag %d%% -> %d%%, free %d in %d chunks, biggest free %d -> %d",
+                mon.used_pct, mon_start.frag_pct, mon.frag_pct, (int)mon.free_size, (int)mon.free_cnt,
+                (int)mon_start.free_biggest_size, (int)mon.free_biggest_size);
+
+    lv_mem_slab_monitor_t slab;
+    lv_mem_slab_monitor(&slab);
+    for(uint32_t i = 0; i < LV_MEM_SLAB_CLASS_NUM && slab.total_size; i++) {
+        TEST_PRINTF("slab %d: pages %d, used %d, max used %d, fallbacks %d", slab.cls[i].block_size,
+                    slab.cls[i].page_cnt, (int)slab.cls[i].used_cnt, (int)slab.cls[i].max_used_cnt,
+                    (int)slab.cls[i].fallback_cnt);
+        TEST_ASSERT_EQUAL_UINT32(0, slab.cls[i].fallback_cnt);
+    }
+
+    /*The same point of the cycle: the free memory must not be split more than before*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT8(mon_start.frag_pct, mon.frag_pct);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(mon_start.free_biggest_size, mon.free_biggest_size);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+#endif
+}
+
 #endif
 
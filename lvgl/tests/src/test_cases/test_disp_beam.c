@@ -0,0 +1,285 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_disp.h"
+
+#if LV_USE_DISP_BEAM
+
+#define SCAN_LINES      (LV_TEST_DISP_VER_RES + 20)     /*Lines of a frame with the blanking*/
+
+static lv_color_t ref_buf[LV_TEST_DISP_PX_CNT];
+
+static lv_disp_t * disp;
+
+/*The simulated display: `scan_pos` lines were scanned since the start*/
+static uint32_t scan_pos;
+static uint32_t scan_pos_read;      /*The position seen by LVGL the last time*/
+static uint32_t render_cost;        /*Lines scanned while 16 lines are rendered*/
+static uint32_t wait_cnt;
+
+static uint32_t tear_cnt;
+static lv_area_t bands[16];
+static lv_coord_t band_start_lines[16];     /*The scanned line when the rendering of the bands started*/
+
+static lv_coord_t scan_line_cb(lv_disp_drv_t * drv, uint32_t * frame)
+{
+    LV_UNUSED(drv);
+    /*Reading the position takes time too*/
+    scan_pos_read = scan_pos;
+    scan_pos++;
+
+    *frame = scan_pos_read / SCAN_LINES;
+    return scan_pos_read % SCAN_LINES;
+}
+
+static void scan_wait_cb(lv_disp_drv_t * drv, lv_coord_t line)
+{
+    LV_UNUSED(drv);
+    while((lv_coord_t)(scan_pos % SCAN_LINES) != line) scan_pos++;
+    wait_cnt++;
+}
+
+/*Check if the display scanned a line of an area between two positions*/
+static bool beam_crosses(uint32_t start, uint32_t end, const lv_area_t * area)
+{
+    uint32_t p;
+    for(p = start; p <= end; p++) {
+        lv_coord_t line = p % SCAN_LINES;
+        if(line >= area->y1 && line <= area->y2) return true;
+    }
+    return false;
+}
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    /*The band was rendered since LVGL has last seen the display*/
+    const lv_area_t * band = drv->draw_ctx->clip_area;
+    if(lv_test_disp_flush_cnt < sizeof(bands) / sizeof(bands[0])) {
+        bands[lv_test_disp_flush_cnt] = *band;
+        band_start_lines[lv_test_disp_flush_cnt] = scan_pos_read % SCAN_LINES;
+    }
+
+    scan_pos += lv_area_get_height(band) * render_cost / 16;
+    if(beam_crosses(scan_pos_read, scan_pos, band)) tear_cnt++;
+
+    lv_test_disp_flush_cb(drv, area, color_p);
+}
+
+static void drv_init(lv_disp_drv_t * drv)
+{
+    drv->flush_cb = flush_cb;
+    drv->scan_line_cb = scan_line_cb;
+    drv->scan_wait_cb = scan_wait_cb;
+}
+
+static void create_disp(bool double_buffered)
+{
+    disp = lv_test_disp_create(double_buffered, drv_init);
+
+    lv_obj_t * scr = lv_disp_get_scr_act(disp);
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(i), 0);
+        lv_obj_set_pos(obj, 10 + i * 25, 5 + i * 24);
+        lv_obj_set_size(obj, 60, 30);
+
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text_fmt(label, "%d", (int)i);
+    }
+
+    lv_refr_now(disp);
+}
+
+static void refr(void)
+{
+    lv_test_disp_flush_cnt = 0;
+    tear_cnt = 0;
+    wait_cnt = 0;
+    disp->beam_tear_cnt = 0;
+    lv_refr_now(disp);
+}
+
+/*Render everything again and compare it with the current image*/
+static void check_full_redraw(void)
+{
+    lv_memcpy(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_DISP_BEAM
+    scan_pos = 0;
+    render_cost = 4;
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_DISP_BEAM
+    lv_test_disp_delete();
+#endif
+}
+
+void test_disp_beam_bands(void)
+{
+#if LV_USE_DISP_BEAM
+    create_disp(false);
+
+    /*The beam is in the middle of the screen*/
+    scan_pos = 50;
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+
+    TEST_ASSERT_EQUAL((LV_TEST_DISP_VER_RES + LV_DISP_BEAM_BAND_H - 1) / LV_DISP_BEAM_BAND_H, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL(0, bands[0].y1);
+    TEST_ASSERT_EQUAL(LV_TEST_DISP_VER_RES - 1, bands[lv_test_disp_flush_cnt - 1].y2);
+    TEST_ASSERT_GREATER_THAN(0, wait_cnt);
+    TEST_ASSERT_EQUAL(0, tear_cnt);
+    TEST_ASSERT_EQUAL(0, disp->beam_tear_cnt);
+
+    /*The same as without bands*/
+    lv_memcpy(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+    disp->driver->scan_line_cb = NULL;
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+    TEST_ASSERT_EQUAL(1, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+#endif
+}
+
+void test_disp_beam_wait(void)
+{
+#if LV_USE_DISP_BEAM
+    create_disp(false);
+
+    /*The beam is in the area: it's drawn when the beam has left it*/
+    lv_area_t a = {20, 10, 80, 40};
+    scan_pos = SCAN_LINES + 15;
+    lv_obj_invalidate_area(lv_disp_get_scr_act(disp), &a);
+    refr();
+    TEST_ASSERT_EQUAL(1, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL(1, wait_cnt);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&a, &bands[0], 0));
+    TEST_ASSERT_EQUAL(bands[0].y2 + 1, band_start_lines[0]);
+    TEST_ASSERT_EQUAL(0, tear_cnt);
+
+    /*The beam has already passed the area: it's drawn immediately*/
+    lv_obj_invalidate_area(lv_disp_get_scr_act(disp), &a);
+    refr();
+    TEST_ASSERT_EQUAL(1, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL(0, wait_cnt);
+    TEST_ASSERT_EQUAL(0, tear_cnt);
+#endif
+}
+
+void test_disp_beam_poll(void)
+{
+#if LV_USE_DISP_BEAM
+    create_disp(false);
+    disp->driver->scan_wait_cb = NULL;
+
+    scan_pos = 0;
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+    TEST_ASSERT_EQUAL(0, tear_cnt);
+    TEST_ASSERT_EQUAL(0, disp->beam_tear_cnt);
+    uint32_t i;
+    for(i = 0; i < lv_test_disp_flush_cnt; i++) {
+        TEST_ASSERT_GREATER_THAN(bands[i].y2, band_start_lines[i]);
+    }
+    check_full_redraw();
+#endif
+}
+
+void test_disp_beam_order(void)
+{
+#if LV_USE_DISP_BEAM
+    create_disp(false);
+
+    /*Drawn from top to bottom in one frame*/
+    lv_area_t a1 = {10, 100, 50, 120};
+    lv_area_t a2 = {100, 60, 150, 70};
+    lv_area_t a3 = {10, 5, 50, 20};
+    lv_obj_invalidate_area(lv_disp_get_scr_act(disp), &a1);
+    lv_obj_invalidate_area(lv_disp_get_scr_act(disp), &a2);
+    lv_obj_invalidate_area(lv_disp_get_scr_act(disp), &a3);
+
+    scan_pos = 0;
+    refr();
+    TEST_ASSERT_EQUAL(3, lv_test_disp_flush_cnt);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&a3, &bands[0], 0));
+    TEST_ASSERT_TRUE(_lv_area_is_in(&a2, &bands[1], 0));
+    TEST_ASSERT_TRUE(_lv_area_is_in(&a1, &bands[2], 0));
+    TEST_ASSERT_EQUAL(0, scan_pos / SCAN_LINES);
+    TEST_ASSERT_EQUAL(0, tear_cnt);
+#endif
+}
+
+void test_disp_beam_tear(void)
+{
+#if LV_USE_DISP_BEAM
+    create_disp(false);
+
+    /*Rendering a band takes more than a frame*/
+    render_cost = 16 * SCAN_LINES / LV_DISP_BEAM_BAND_H + 16;
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+    TEST_ASSERT_GREATER_THAN(0, tear_cnt);
+    TEST_ASSERT_EQUAL(tear_cnt, disp->beam_tear_cnt);
+
+    /*Fast enough again*/
+    render_cost = 4;
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+    TEST_ASSERT_EQUAL(0, tear_cnt);
+    TEST_ASSERT_EQUAL(0, disp->beam_tear_cnt);
+#endif
+}
+
+void test_disp_beam_scroll_blit(void)
+{
+#if LV_USE_DISP_BEAM && LV_USE_SCROLL_BLIT
+    create_disp(false);
+
+    lv_obj_t * cont = lv_obj_create(lv_disp_get_scr_act(disp));
+    lv_obj_set_size(cont, 150, 120);
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_SCROLL_BLIT);
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Row %d", (int)i);
+        lv_obj_set_y(label, i * 25);
+    }
+    refr();
+
+    /*The pixels are moved when the beam has left them*/
+    scan_pos = 30;
+    lv_obj_scroll_by(cont, 0, -10, LV_ANIM_OFF);
+    refr();
+    TEST_ASSERT_EQUAL(0, tear_cnt);
+    TEST_ASSERT_EQUAL(0, disp->beam_tear_cnt);
+    check_full_redraw();
+#endif
+}
+
+void test_disp_beam_double_buffered(void)
+{
+#if LV_USE_DISP_BEAM
+    /*With two buffers the display shows the other one, no need to wait*/
+    create_disp(true);
+
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+    TEST_ASSERT_EQUAL(1, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL(0, wait_cnt);
+#endif
+}
+
+#endif
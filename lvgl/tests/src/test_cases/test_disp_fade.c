@@ -0,0 +1,195 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_disp.h"
+
+#if LV_USE_DISP_FADE
+
+static lv_color_t ref_buf[LV_TEST_DISP_PX_CNT];
+static lv_color_t screens[2 * LV_TEST_DISP_PX_CNT];
+
+static lv_disp_t * disp;
+
+static uint32_t fade_cnt;
+static uint32_t fade_end_cnt;
+static lv_opa_t fade_opa;
+
+static void fade_cb(lv_disp_drv_t * drv, const lv_color_t * under, const lv_color_t * over, lv_opa_t opa)
+{
+    LV_UNUSED(drv);
+    if(under == NULL) {
+        fade_end_cnt++;
+        return;
+    }
+
+    TEST_ASSERT_EQUAL_PTR(disp->fade_buf, under);
+    TEST_ASSERT_EQUAL_PTR(disp->fade_buf + LV_TEST_DISP_PX_CNT, over);
+    fade_cnt++;
+    fade_opa = opa;
+}
+
+static void drv_init(lv_disp_drv_t * drv)
+{
+    drv->fade_cb = fade_cb;
+}
+
+static void create_disp(void)
+{
+    disp = lv_test_disp_create(true, drv_init);
+
+    lv_test_disp_create_content(lv_disp_get_scr_act(disp), LV_PALETTE_BLUE);
+    lv_refr_now(disp);
+
+    lv_test_disp_frame_cnt = 0;
+    fade_cnt = 0;
+    fade_end_cnt = 0;
+}
+
+static void step(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_refr_now(disp);
+}
+
+/**
+ * Load a new screen with a fading animation and check that only the opacity changes
+ * @param anim      `LV_SCR_LOAD_ANIM_FADE_IN` or `LV_SCR_LOAD_ANIM_FADE_OUT`
+ */
+static void check_scr_load(lv_scr_load_anim_t anim)
+{
+    bool in = anim == LV_SCR_LOAD_ANIM_FADE_IN;
+    lv_memcpy(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+
+    lv_obj_t * scr = lv_test_disp_create_content(NULL, LV_PALETTE_RED);
+    lv_scr_load_anim(scr, anim, 200, 0, true);
+
+    lv_opa_t opa_prev = in ? LV_OPA_TRANSP : LV_OPA_COVER;
+    uint32_t i;
+    for(i = 0; i < 9; i++) {
+        step(20);
+        if(i == 0) lv_memcpy(screens, disp->fade_buf, sizeof(screens));
+        TEST_ASSERT_GREATER_OR_EQUAL(i + 1, fade_cnt);
+        if(in) TEST_ASSERT_GREATER_OR_EQUAL(opa_prev, fade_opa);
+        else TEST_ASSERT_LESS_OR_EQUAL(opa_prev, fade_opa);
+        opa_prev = fade_opa;
+    }
+    TEST_ASSERT_EQUAL(0, lv_test_disp_frame_cnt);
+    TEST_ASSERT_EQUAL(0, fade_end_cnt);
+    TEST_ASSERT_TRUE(in ? fade_opa > LV_OPA_80 : fade_opa < LV_OPA_20);
+
+    /*The old screen is below when fading in and above when fading out*/
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, in ? screens : screens + LV_TEST_DISP_PX_CNT, sizeof(ref_buf));
+
+    /*The new screen is rendered normally at the end*/
+    step(100);
+    TEST_ASSERT_EQUAL(1, fade_end_cnt);
+    TEST_ASSERT_EQUAL(1, lv_test_disp_frame_cnt);
+    TEST_ASSERT_NULL(disp->fade_buf);
+    TEST_ASSERT_EQUAL_PTR(scr, lv_disp_get_scr_act(disp));
+    TEST_ASSERT_EQUAL_MEMORY(lv_test_disp_front_buf, in ? screens + LV_TEST_DISP_PX_CNT : screens, sizeof(ref_buf));
+    lv_test_disp_check_full_redraw();
+}
+
+#endif
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+#if LV_USE_DISP_FADE
+    lv_test_disp_delete();
+#endif
+}
+
+void test_disp_fade_in(void)
+{
+#if LV_USE_DISP_FADE
+    create_disp();
+    check_scr_load(LV_SCR_LOAD_ANIM_FADE_IN);
+#endif
+}
+
+void test_disp_fade_out(void)
+{
+#if LV_USE_DISP_FADE
+    create_disp();
+    check_scr_load(LV_SCR_LOAD_ANIM_FADE_OUT);
+#endif
+}
+
+void test_disp_fade_dynamic(void)
+{
+#if LV_USE_DISP_FADE
+    create_disp();
+
+    lv_obj_t * scr = lv_test_disp_create_content(NULL, LV_PALETTE_RED);
+    lv_scr_load_anim(scr, LV_SCR_LOAD_ANIM_FADE_IN, 200, 0, true);
+    step(20);
+    step(20);
+    TEST_ASSERT_EQUAL(0, lv_test_disp_frame_cnt);
+
+    /*A change on the screen continues the fade in software*/
+    lv_obj_set_style_bg_color(lv_obj_get_child(scr, 0), lv_color_black(), 0);
+    uint32_t cnt = fade_cnt;
+    step(20);
+    TEST_ASSERT_EQUAL(1, fade_end_cnt);
+    TEST_ASSERT_EQUAL(1, lv_test_disp_frame_cnt);
+    step(20);
+    TEST_ASSERT_EQUAL(2, lv_test_disp_frame_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(cnt + 1, fade_cnt);
+    TEST_ASSERT_NULL(disp->fade_buf);
+
+    step(200);
+    TEST_ASSERT_EQUAL(1, fade_end_cnt);
+    TEST_ASSERT_EQUAL_PTR(scr, lv_disp_get_scr_act(disp));
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_disp_fade_interrupted(void)
+{
+#if LV_USE_DISP_FADE
+    create_disp();
+
+    lv_scr_load_anim(lv_test_disp_create_content(NULL, LV_PALETTE_RED), LV_SCR_LOAD_ANIM_FADE_IN, 200, 0, true);
+    step(20);
+    TEST_ASSERT_GREATER_THAN(0, fade_cnt);
+
+    /*The first screen is loaded immediately and the next one fades in*/
+    lv_obj_t * scr = lv_test_disp_create_content(NULL, LV_PALETTE_GREEN);
+    lv_scr_load_anim(scr, LV_SCR_LOAD_ANIM_FADE_IN, 200, 0, true);
+    TEST_ASSERT_EQUAL(1, fade_end_cnt);
+    uint32_t cnt = fade_cnt;
+    step(20);
+    TEST_ASSERT_GREATER_THAN(cnt, fade_cnt);
+    TEST_ASSERT_EQUAL_PTR(scr, disp->fade_obj);
+    TEST_ASSERT_EQUAL(0, lv_test_disp_frame_cnt);
+
+    step(200);
+    TEST_ASSERT_EQUAL(2, fade_end_cnt);
+    TEST_ASSERT_EQUAL_PTR(scr, lv_disp_get_scr_act(disp));
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_disp_fade_no_cb(void)
+{
+#if LV_USE_DISP_FADE
+    create_disp();
+    disp->driver->fade_cb = NULL;
+
+    /*Rendered in every frame*/
+    lv_scr_load_anim(lv_test_disp_create_content(NULL, LV_PALETTE_RED), LV_SCR_LOAD_ANIM_FADE_OUT, 200, 0, true);
+    step(20);
+    step(20);
+    TEST_ASSERT_EQUAL(2, lv_test_disp_frame_cnt);
+    TEST_ASSERT_NULL(disp->fade_buf);
+    step(200);
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+#endif
@@ -0,0 +1,300 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_disp.h"
+
+#if LV_USE_DISP_OVERLAY
+
+static uint16_t overlay_buf[LV_TEST_DISP_PX_CNT];
+static uint16_t ref_buf[LV_TEST_DISP_PX_CNT];
+
+static lv_disp_t * disp;
+
+static uint32_t overlay_flush_cnt;
+static uint32_t overlay_area_cnt;
+static lv_area_t overlay_area;
+static bool overlay_empty;
+
+static void overlay_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(area);
+    overlay_flush_cnt++;
+}
+
+static void overlay_area_cb(lv_disp_drv_t * drv, const lv_area_t * area)
+{
+    LV_UNUSED(drv);
+    overlay_area_cnt++;
+    overlay_empty = area == NULL;
+    if(area) overlay_area = *area;
+}
+
+static void drv_init(lv_disp_drv_t * drv)
+{
+    drv->overlay_buf = overlay_buf;
+    drv->overlay_flush_cb = overlay_flush_cb;
+    drv->overlay_area_cb = overlay_area_cb;
+}
+
+static void create_disp(void)
+{
+    lv_memset_00(overlay_buf, sizeof(overlay_buf));
+    disp = lv_test_disp_create(false, drv_init);
+
+    lv_obj_set_style_bg_color(lv_disp_get_scr_act(disp), lv_color_white(), 0);
+    lv_refr_now(disp);
+}
+
+static lv_obj_t * create_rect(lv_obj_t * parent, lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_make(0xff, 0x00, 0x00), 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, 40, 30);
+    return obj;
+}
+
+static void refr(void)
+{
+    lv_test_disp_flush_cnt = 0;
+    overlay_flush_cnt = 0;
+    overlay_area_cnt = 0;
+    lv_refr_now(disp);
+}
+
+static uint16_t get_px(lv_coord_t x, lv_coord_t y)
+{
+    return overlay_buf[y * LV_TEST_DISP_HOR_RES + x];
+}
+
+/*The area of an object with its shadow, outline, etc, the same as it's invalidated*/
+static void get_draw_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_copy(area, &obj->coords);
+    lv_area_increase(area, ext_size, ext_size);
+    lv_obj_get_transformed_area(obj, area, false, false);
+}
+
+#define TEST_ASSERT_EQUAL_AREA(expected, actual)                 \
+    do {                                                         \
+        TEST_ASSERT_EQUAL((expected)->x1, (actual)->x1);         \
+        TEST_ASSERT_EQUAL((expected)->y1, (actual)->y1);         \
+        TEST_ASSERT_EQUAL((expected)->x2, (actual)->x2);         \
+        TEST_ASSERT_EQUAL((expected)->y2, (actual)->y2);         \
+    } while(0)
+
+static bool is_empty(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_TEST_DISP_PX_CNT; i++) {
+        if(overlay_buf[i] != 0) return false;
+    }
+    return true;
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_DISP_OVERLAY
+    create_disp();
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_DISP_OVERLAY
+    lv_test_disp_delete();
+#endif
+}
+
+void test_disp_overlay_top_layer(void)
+{
+#if LV_USE_DISP_OVERLAY
+    create_rect(lv_disp_get_layer_top(disp), 20, 20);
+    refr();
+
+    /*Only the overlay is updated*/
+    TEST_ASSERT_EQUAL(0, lv_test_disp_flush_cnt);
+    TEST_ASSERT_GREATER_THAN(0, overlay_flush_cnt);
+    TEST_ASSERT_EQUAL_HEX16(0xFF00, get_px(20, 20));
+    TEST_ASSERT_EQUAL_HEX16(0xFF00, get_px(59, 49));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, get_px(19, 20));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, get_px(60, 49));
+
+    /*The screen is not drawn with the object*/
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+    TEST_ASSERT_GREATER_THAN(0, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL(0, overlay_flush_cnt);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_white()),
+                            lv_color_to32(lv_test_disp_front_buf[30 * LV_TEST_DISP_HOR_RES + 30]));
+#endif
+}
+
+void test_disp_overlay_sys_layer(void)
+{
+#if LV_USE_DISP_OVERLAY
+    lv_obj_t * obj = create_rect(lv_disp_get_layer_sys(disp), 100, 100);
+    lv_obj_set_style_bg_color(obj, lv_color_make(0x00, 0x00, 0xff), 0);
+    refr();
+
+    TEST_ASSERT_EQUAL(0, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL_HEX16(0xF00F, get_px(120, 110));
+#endif
+}
+
+void test_disp_overlay_move_and_hide(void)
+{
+#if LV_USE_DISP_OVERLAY
+    lv_obj_t * obj = create_rect(lv_disp_get_layer_top(disp), 20, 20);
+    refr();
+
+    lv_obj_set_pos(obj, 35, 70);
+    refr();
+    TEST_ASSERT_EQUAL(0, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, get_px(20, 20));
+    TEST_ASSERT_EQUAL_HEX16(0xFF00, get_px(40, 75));
+
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    refr();
+    TEST_ASSERT_EQUAL(0, lv_test_disp_flush_cnt);
+    TEST_ASSERT_TRUE(is_empty());
+#endif
+}
+
+void test_disp_overlay_screen_change(void)
+{
+#if LV_USE_DISP_OVERLAY
+    create_rect(lv_disp_get_layer_top(disp), 20, 20);
+    refr();
+    lv_memcpy(ref_buf, overlay_buf, sizeof(ref_buf));
+
+    /*The screen under the overlay changes, the overlay is kept*/
+    lv_obj_t * obj = create_rect(lv_disp_get_scr_act(disp), 30, 30);
+    lv_obj_set_style_bg_color(obj, lv_color_make(0x00, 0xff, 0x00), 0);
+    refr();
+    TEST_ASSERT_GREATER_THAN(0, lv_test_disp_flush_cnt);
+    TEST_ASSERT_EQUAL(0, overlay_flush_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, overlay_buf, sizeof(ref_buf));
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_make(0x00, 0xff, 0x00)),
+                            lv_color_to32(lv_test_disp_front_buf[40 * LV_TEST_DISP_HOR_RES + 40]));
+#endif
+}
+
+void test_disp_overlay_opa(void)
+{
+#if LV_USE_DISP_OVERLAY
+    lv_obj_t * obj = create_rect(lv_disp_get_layer_top(disp), 20, 20);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_50, 0);
+    refr();
+    TEST_ASSERT_EQUAL_HEX16(0x7F00, get_px(30, 30));
+
+    /*Blended in the overlay: red over red*/
+    lv_obj_t * obj2 = create_rect(lv_disp_get_layer_top(disp), 40, 40);
+    lv_obj_set_style_bg_opa(obj2, LV_OPA_50, 0);
+    refr();
+    TEST_ASSERT_EQUAL_HEX16(0x7F00, get_px(30, 30));
+    TEST_ASSERT_EQUAL_HEX16(0xBF00, get_px(50, 45));
+#endif
+}
+
+void test_disp_overlay_label(void)
+{
+#if LV_USE_DISP_OVERLAY
+    lv_obj_t * label = lv_label_create(lv_disp_get_layer_top(disp));
+    lv_label_set_text(label, "Overlay");
+    lv_obj_set_pos(label, 10, 10);
+    refr();
+    TEST_ASSERT_EQUAL(0, lv_test_disp_flush_cnt);
+
+    /*The text is anti-aliased*/
+    uint32_t opaque = 0;
+    uint32_t partial = 0;
+    uint32_t i;
+    for(i = 0; i < LV_TEST_DISP_PX_CNT; i++) {
+        uint16_t a = overlay_buf[i] >> 12;
+        if(a == 0xF) opaque++;
+        else if(a != 0) partial++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, opaque);
+    TEST_ASSERT_GREATER_THAN(0, partial);
+#endif
+}
+
+void test_disp_overlay_layer(void)
+{
+#if LV_USE_DISP_OVERLAY
+    /*Drawn into a layer first, then blended into the overlay*/
+    lv_obj_t * obj = create_rect(lv_disp_get_layer_top(disp), 20, 20);
+    lv_obj_set_style_opa(obj, LV_OPA_50, 0);
+    refr();
+    TEST_ASSERT_EQUAL_HEX16(0x7F00, get_px(30, 30));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, get_px(10, 10));
+#endif
+}
+
+void test_disp_overlay_content_area(void)
+{
+#if LV_USE_DISP_OVERLAY
+    lv_obj_t * obj1 = create_rect(lv_disp_get_layer_top(disp), 20, 20);
+    refr();
+    lv_area_t a1;
+    get_draw_area(obj1, &a1);
+    TEST_ASSERT_EQUAL(1, overlay_area_cnt);
+    TEST_ASSERT_FALSE(overlay_empty);
+    TEST_ASSERT_EQUAL_AREA(&a1, &overlay_area);
+
+    /*Both layers are in the area*/
+    lv_obj_t * obj2 = create_rect(lv_disp_get_layer_sys(disp), 100, 100);
+    refr();
+    lv_area_t a2;
+    get_draw_area(obj2, &a2);
+    TEST_ASSERT_EQUAL(a1.x1, overlay_area.x1);
+    TEST_ASSERT_EQUAL(a1.y1, overlay_area.y1);
+    TEST_ASSERT_EQUAL(a2.x2, overlay_area.x2);
+    TEST_ASSERT_EQUAL(a2.y2, overlay_area.y2);
+
+    lv_obj_add_flag(obj1, LV_OBJ_FLAG_HIDDEN);
+    refr();
+    TEST_ASSERT_EQUAL_AREA(&a2, &overlay_area);
+
+    /*Nothing is shown, everything is transparent*/
+    lv_obj_del(obj2);
+    refr();
+    TEST_ASSERT_EQUAL(1, overlay_area_cnt);
+    TEST_ASSERT_TRUE(overlay_empty);
+    TEST_ASSERT_TRUE(is_empty());
+
+    /*Not called if the overlay has not changed*/
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+    refr();
+    TEST_ASSERT_EQUAL(0, overlay_area_cnt);
+#endif
+}
+
+void test_disp_overlay_content_area_layer_bg(void)
+{
+#if LV_USE_DISP_OVERLAY
+    /*The dimmed background of a modal dialog covers the display*/
+    lv_obj_set_style_bg_opa(lv_disp_get_layer_top(disp), LV_OPA_50, 0);
+    lv_obj_t * obj = create_rect(lv_disp_get_layer_top(disp), 20, 20);
+    refr();
+    lv_area_t scr_area = {0, 0, LV_TEST_DISP_HOR_RES - 1, LV_TEST_DISP_VER_RES - 1};
+    TEST_ASSERT_FALSE(overlay_empty);
+    TEST_ASSERT_EQUAL_AREA(&scr_area, &overlay_area);
+
+    lv_obj_set_style_bg_opa(lv_disp_get_layer_top(disp), LV_OPA_TRANSP, 0);
+    refr();
+    lv_area_t a;
+    get_draw_area(obj, &a);
+    TEST_ASSERT_EQUAL_AREA(&a, &overlay_area);
+#endif
+}
+
+#endif
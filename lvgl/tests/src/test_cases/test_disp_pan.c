@@ -0,0 +1,267 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_disp.h"
+
+#if LV_USE_DISP_PAN
+
+static lv_color_t ref_buf[LV_TEST_DISP_PX_CNT];
+static lv_color_t canvas[2 * LV_TEST_DISP_PX_CNT];
+
+static lv_disp_t * disp;
+
+static uint32_t pan_cnt;
+static uint32_t pan_end_cnt;
+static int32_t pan_ofs;
+static lv_coord_t pan_stride;
+
+static void pan_cb(lv_disp_drv_t * drv, const lv_color_t * buf, lv_coord_t stride)
+{
+    LV_UNUSED(drv);
+    if(buf == NULL) {
+        pan_end_cnt++;
+        return;
+    }
+
+    pan_cnt++;
+    pan_ofs = buf - disp->pan_buf;
+    pan_stride = stride;
+}
+
+static void drv_init(lv_disp_drv_t * drv)
+{
+    drv->pan_cb = pan_cb;
+}
+
+static void create_disp(void)
+{
+    disp = lv_test_disp_create(true, drv_init);
+
+    lv_test_disp_create_content(lv_disp_get_scr_act(disp), LV_PALETTE_BLUE);
+    lv_refr_now(disp);
+
+    lv_test_disp_frame_cnt = 0;
+    pan_cnt = 0;
+    pan_end_cnt = 0;
+}
+
+static void step(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_refr_now(disp);
+}
+
+/*Compare a half of the canvas with a frame*/
+static void check_canvas_half(lv_coord_t x, const lv_color_t * frame)
+{
+    lv_coord_t y;
+    for(y = 0; y < LV_TEST_DISP_VER_RES; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(&frame[y * LV_TEST_DISP_HOR_RES], &canvas[y * 2 * LV_TEST_DISP_HOR_RES + x],
+                                 LV_TEST_DISP_HOR_RES * sizeof(lv_color_t));
+    }
+}
+
+/**
+ * Load a new screen with a moving animation and check that it's panned
+ * @param anim      `LV_SCR_LOAD_ANIM_MOVE_LEFT` or `LV_SCR_LOAD_ANIM_MOVE_RIGHT`
+ * @param out_x     position of the old screen in the canvas
+ * @param in_x      position of the new screen in the canvas
+ */
+static void check_scr_load(lv_scr_load_anim_t anim, lv_coord_t out_x, lv_coord_t in_x)
+{
+    lv_memcpy(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+    lv_test_disp_frame_cnt = 0;
+
+    lv_obj_t * scr = lv_test_disp_create_content(NULL, LV_PALETTE_RED);
+    lv_scr_load_anim(scr, anim, 200, 0, true);
+
+    /*The display only shows another part of the canvas while sliding*/
+    int32_t ofs_prev = out_x;
+    uint32_t i;
+    for(i = 0; i < 9; i++) {
+        step(20);
+        if(i == 0) lv_memcpy(canvas, disp->pan_buf, sizeof(canvas));
+        TEST_ASSERT_GREATER_OR_EQUAL(i + 1, pan_cnt);
+        TEST_ASSERT_EQUAL(2 * LV_TEST_DISP_HOR_RES, pan_stride);
+        if(in_x > out_x) TEST_ASSERT_GREATER_OR_EQUAL(ofs_prev, pan_ofs);
+        else TEST_ASSERT_LESS_OR_EQUAL(ofs_prev, pan_ofs);
+        ofs_prev = pan_ofs;
+    }
+    TEST_ASSERT_EQUAL(0, lv_test_disp_frame_cnt);
+    TEST_ASSERT_EQUAL(0, pan_end_cnt);
+    check_canvas_half(out_x, ref_buf);
+
+    /*The new screen is rendered normally at the end*/
+    step(100);
+    TEST_ASSERT_EQUAL(1, pan_end_cnt);
+    TEST_ASSERT_EQUAL(1, lv_test_disp_frame_cnt);
+    TEST_ASSERT_NULL(disp->pan_buf);
+    TEST_ASSERT_EQUAL_PTR(scr, lv_disp_get_scr_act(disp));
+    check_canvas_half(in_x, lv_test_disp_front_buf);
+    lv_test_disp_check_full_redraw();
+}
+
+#endif
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+#if LV_USE_DISP_PAN
+    lv_test_disp_delete();
+#endif
+}
+
+void test_disp_pan_scr_load_move_left(void)
+{
+#if LV_USE_DISP_PAN
+    create_disp();
+    check_scr_load(LV_SCR_LOAD_ANIM_MOVE_LEFT, 0, LV_TEST_DISP_HOR_RES);
+#endif
+}
+
+void test_disp_pan_scr_load_move_right(void)
+{
+#if LV_USE_DISP_PAN
+    create_disp();
+    check_scr_load(LV_SCR_LOAD_ANIM_MOVE_RIGHT, LV_TEST_DISP_HOR_RES, 0);
+#endif
+}
+
+void test_disp_pan_scr_load_pending_change(void)
+{
+#if LV_USE_DISP_PAN
+    create_disp();
+
+    /*The old screen is rendered instead of copying the front buffer*/
+    lv_obj_t * obj = lv_obj_get_child(lv_scr_act(), 0);
+    lv_obj_set_style_bg_color(obj, lv_color_black(), 0);
+    lv_refr_now(disp);
+    lv_obj_invalidate(obj);
+    check_scr_load(LV_SCR_LOAD_ANIM_MOVE_LEFT, 0, LV_TEST_DISP_HOR_RES);
+#endif
+}
+
+void test_disp_pan_scr_load_fallback(void)
+{
+#if LV_USE_DISP_PAN
+    create_disp();
+
+    /*The top layer would slide with the screen*/
+    lv_obj_t * msg = lv_obj_create(lv_disp_get_layer_top(disp));
+    lv_obj_set_size(msg, 50, 30);
+
+    lv_obj_t * scr = lv_test_disp_create_content(NULL, LV_PALETTE_RED);
+    lv_scr_load_anim(scr, LV_SCR_LOAD_ANIM_MOVE_LEFT, 200, 0, true);
+    step(20);
+    step(20);
+    TEST_ASSERT_EQUAL(0, pan_cnt);
+    TEST_ASSERT_EQUAL(2, lv_test_disp_frame_cnt);
+
+    /*Sliding over the old screen can't be panned*/
+    lv_obj_del(msg);
+    step(200);
+    lv_test_disp_frame_cnt = 0;
+    lv_scr_load_anim(lv_test_disp_create_content(NULL, LV_PALETTE_GREEN), LV_SCR_LOAD_ANIM_OVER_LEFT, 200, 0, true);
+    step(20);
+    TEST_ASSERT_EQUAL(0, pan_cnt);
+    TEST_ASSERT_EQUAL(1, lv_test_disp_frame_cnt);
+    step(200);
+#endif
+}
+
+void test_disp_pan_tileview(void)
+{
+#if LV_USE_DISP_PAN
+    create_disp();
+
+    lv_obj_t * tv = lv_tileview_create(lv_scr_act());
+    lv_test_disp_create_content(lv_tileview_add_tile(tv, 0, 0, LV_DIR_RIGHT), LV_PALETTE_BLUE);
+    lv_test_disp_create_content(lv_tileview_add_tile(tv, 1, 0, LV_DIR_LEFT), LV_PALETTE_GREEN);
+    lv_refr_now(disp);
+    lv_memcpy(ref_buf, lv_test_disp_front_buf, sizeof(ref_buf));
+    lv_test_disp_frame_cnt = 0;
+
+    lv_obj_set_tile_id(tv, 1, 0, LV_ANIM_ON);
+    step(20);
+    lv_memcpy(canvas, disp->pan_buf, sizeof(canvas));
+    uint32_t i;
+    for(i = 0; i < 5; i++) step(20);
+    TEST_ASSERT_GREATER_THAN(0, pan_cnt);
+    TEST_ASSERT_EQUAL(0, lv_test_disp_frame_cnt);
+    check_canvas_half(0, ref_buf);
+
+    /*Rendered normally when the scrolling ends*/
+    for(i = 0; i < 50; i++) step(20);
+    TEST_ASSERT_EQUAL(1, pan_end_cnt);
+    TEST_ASSERT_GREATER_THAN(0, lv_test_disp_frame_cnt);
+    TEST_ASSERT_EQUAL(LV_TEST_DISP_HOR_RES, lv_obj_get_scroll_x(tv));
+    check_canvas_half(LV_TEST_DISP_HOR_RES, lv_test_disp_front_buf);
+    lv_test_disp_check_full_redraw();
+
+    /*Back to the first tile from the left*/
+    pan_cnt = 0;
+    lv_obj_set_tile_id(tv, 0, 0, LV_ANIM_ON);
+    step(20);
+    TEST_ASSERT_EQUAL(1, pan_cnt);
+    for(i = 0; i < 50; i++) step(20);
+    TEST_ASSERT_EQUAL(2, pan_end_cnt);
+    TEST_ASSERT_EQUAL(0, pan_ofs);
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_disp_pan_scroll_turn_back(void)
+{
+#if LV_USE_DISP_PAN
+    create_disp();
+
+    lv_obj_t * tv = lv_tileview_create(lv_scr_act());
+    lv_test_disp_create_content(lv_tileview_add_tile(tv, 0, 0, LV_DIR_RIGHT), LV_PALETTE_BLUE);
+    lv_test_disp_create_content(lv_tileview_add_tile(tv, 1, 0, LV_DIR_LEFT), LV_PALETTE_GREEN);
+    lv_refr_now(disp);
+    lv_test_disp_frame_cnt = 0;
+
+    lv_obj_scroll_by(tv, -50, 0, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(1, pan_cnt);
+    TEST_ASSERT_EQUAL(50, pan_ofs);
+
+    /*The content on the left wasn't rendered*/
+    lv_obj_scroll_by(tv, 80, 0, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(1, pan_cnt);
+    TEST_ASSERT_EQUAL(1, pan_end_cnt);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(1, lv_test_disp_frame_cnt);
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_disp_pan_delete(void)
+{
+#if LV_USE_DISP_PAN
+    create_disp();
+
+    lv_obj_t * tv = lv_tileview_create(lv_scr_act());
+    lv_test_disp_create_content(lv_tileview_add_tile(tv, 0, 0, LV_DIR_RIGHT), LV_PALETTE_BLUE);
+    lv_test_disp_create_content(lv_tileview_add_tile(tv, 1, 0, LV_DIR_LEFT), LV_PALETTE_GREEN);
+    lv_refr_now(disp);
+
+    lv_obj_set_tile_id(tv, 1, 0, LV_ANIM_ON);
+    step(20);
+    TEST_ASSERT_EQUAL(1, pan_cnt);
+
+    /*The display is rendered again without the panned object*/
+    lv_obj_del(tv);
+    TEST_ASSERT_EQUAL(1, pan_end_cnt);
+    lv_test_disp_frame_cnt = 0;
+    step(20);
+    TEST_ASSERT_EQUAL(1, lv_test_disp_frame_cnt);
+    TEST_ASSERT_NULL(disp->pan_buf);
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+#endif
@@ -24,4 +24,90 @@ void test_event_object_deletion(void)
     lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+#if LV_OBJ_EVENT_MASK
+static uint32_t event_cnt;
+
+static void event_count_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    event_cnt++;
+}
+#endif
+
+void test_event_skip_unhandled(void)
+{
+#if LV_OBJ_EVENT_MASK
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_event_stat_t stat;
+
+    /*Neither the label nor the base object handles it*/
+    lv_event_reset_stat();
+    lv_event_send(label, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_event_get_stat(LV_EVENT_DRAW_PART_BEGIN, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.sent_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.skipped_cnt);
+
+    /*The class handles it*/
+    lv_event_send(label, LV_EVENT_GET_SELF_SIZE, &(lv_point_t) {
+        0, 0
+    });
+    lv_event_get_stat(LV_EVENT_GET_SELF_SIZE, &stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.skipped_cnt);
+
+    /*An event callback handles it*/
+    event_cnt = 0;
+    lv_obj_add_event_cb(label, event_count_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_event_send(label, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_event_get_stat(LV_EVENT_DRAW_PART_BEGIN, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, event_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.sent_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.skipped_cnt);
+
+    lv_obj_remove_event_cb(label, event_count_cb);
+    lv_event_send(label, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_event_get_stat(LV_EVENT_DRAW_PART_BEGIN, &stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.skipped_cnt);
+
+    /*Preprocess and "all" filters*/
+    lv_obj_add_event_cb(label, event_count_cb, LV_EVENT_DRAW_PART_END | LV_EVENT_PREPROCESS, NULL);
+    lv_event_send(label, LV_EVENT_DRAW_PART_END, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, event_cnt);
+    lv_obj_remove_event_cb(label, event_count_cb);
+
+    lv_obj_add_event_cb(label, event_count_cb, LV_EVENT_ALL, NULL);
+    lv_event_send(label, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_event_send(label, LV_EVENT_SCREEN_LOADED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, event_cnt);
+    lv_obj_del(label);
+
+    /*A skipped event still bubbles to the parent*/
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_t * child = lv_obj_create(parent);
+    lv_obj_add_flag(child, LV_OBJ_FLAG_EVENT_BUBBLE);
+    lv_obj_add_event_cb(parent, event_count_cb, LV_EVENT_CLICKED, NULL);
+    event_cnt = 0;
+    lv_event_reset_stat();
+    lv_event_send(child, LV_EVENT_CLICKED, NULL);
+    lv_event_get_stat(LV_EVENT_CLICKED, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, event_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.sent_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.skipped_cnt);
+
+    /*Classes without `handled_events` get every event*/
+    lv_obj_t * obj = lv_obj_class_create_obj(&event_object_deletion_class, lv_scr_act());
+    lv_obj_class_init_obj(obj);
+    lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_event_get_stat(LV_EVENT_DRAW_PART_BEGIN, &stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.skipped_cnt);
+
+    /*Custom events are counted together*/
+    uint32_t my_event = lv_event_register_id();
+    lv_event_send(obj, my_event, NULL);
+    lv_event_get_stat(_LV_EVENT_LAST, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.sent_cnt);
+
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
 #endif
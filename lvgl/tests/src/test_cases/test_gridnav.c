@@ -0,0 +1,249 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define BTN_CNT     300
+
+static lv_obj_t * cont;
+static lv_group_t * g;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 780, 460);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < BTN_CNT; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_set_size(btn, 40 + (i * 7) % 50, 30 + (i * 13) % 20);
+        if(i % 17 == 5) lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    lv_obj_update_layout(lv_scr_act());
+
+    g = lv_group_create();
+    lv_group_add_obj(g, cont);
+}
+
+void tearDown(void)
+{
+    lv_group_del(g);
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_USE_GRIDNAV
+
+typedef enum {
+    FIND_LEFT,
+    FIND_RIGHT,
+    FIND_TOP,
+    FIND_BOTTOM,
+    FIND_NEXT_ROW_FIRST_ITEM,
+    FIND_PREV_ROW_LAST_ITEM,
+    FIND_FIRST_ROW,
+    FIND_LAST_ROW,
+} find_mode_t;
+
+static bool is_focusable(lv_obj_t * obj)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+    return lv_obj_has_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_CLICK_FOCUSABLE);
+}
+
+static lv_coord_t x_center(lv_obj_t * obj)
+{
+    return obj->coords.x1 + lv_area_get_width(&obj->coords) / 2;
+}
+
+static lv_coord_t y_center(lv_obj_t * obj)
+{
+    return obj->coords.y1 + lv_area_get_height(&obj->coords) / 2;
+}
+
+/*Check all children like gridnav did without the sorted children*/
+static lv_obj_t * ref_find(lv_obj_t * obj, lv_obj_t * start_child, find_mode_t mode)
+{
+    lv_coord_t x_start = x_center(start_child);
+    lv_coord_t y_start = y_center(start_child);
+    lv_obj_t * guess = NULL;
+    int32_t err_guess = 0;
+    lv_coord_t h_half = lv_obj_get_height(start_child) / 2;
+    lv_coord_t h_max = lv_obj_get_height(obj) + lv_obj_get_scroll_top(obj) + lv_obj_get_scroll_bottom(obj);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        lv_obj_t * child = lv_obj_get_child(obj, i);
+        if(child == start_child || !is_focusable(child)) continue;
+
+        lv_coord_t x_err = x_center(child) - x_start;
+        lv_coord_t y_err = y_center(child) - y_start;
+        switch(mode) {
+            case FIND_LEFT:
+                if(x_err >= 0 || LV_ABS(y_err) > h_half) continue;
+                break;
+            case FIND_RIGHT:
+                if(x_err <= 0 || LV_ABS(y_err) > h_half) continue;
+                break;
+            case FIND_TOP:
+                if(y_err >= 0) continue;
+                break;
+            case FIND_BOTTOM:
+                if(y_err <= 0) continue;
+                break;
+            case FIND_NEXT_ROW_FIRST_ITEM:
+                if(y_err <= 0) continue;
+                x_err = lv_obj_get_x(child);
+                break;
+            case FIND_PREV_ROW_LAST_ITEM:
+                if(y_err >= 0) continue;
+                x_err = obj->coords.x2 - child->coords.x2;
+                break;
+            case FIND_FIRST_ROW:
+                y_err = lv_obj_get_y(child);
+                break;
+            case FIND_LAST_ROW:
+                y_err = h_max - lv_obj_get_y(child);
+                break;
+        }
+
+        int32_t err = y_err * y_err + x_err * x_err;
+        if(guess == NULL || err < err_guess) {
+            guess = child;
+            err_guess = err;
+        }
+    }
+    return guess;
+}
+
+static lv_obj_t * ref_focusable(lv_obj_t * obj, bool last)
+{
+    uint32_t cnt = lv_obj_get_child_cnt(obj);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * child = lv_obj_get_child(obj, last ? cnt - 1 - i : i);
+        if(is_focusable(child)) return child;
+    }
+    return NULL;
+}
+
+static lv_obj_t * ref_key(lv_obj_t * start, uint32_t key)
+{
+    lv_obj_t * guess = NULL;
+    switch(key) {
+        case LV_KEY_RIGHT:
+            guess = ref_find(cont, start, FIND_RIGHT);
+            if(guess == NULL) guess = ref_find(cont, start, FIND_NEXT_ROW_FIRST_ITEM);
+            if(guess == NULL) guess = ref_focusable(cont, false);
+            break;
+        case LV_KEY_LEFT:
+            guess = ref_find(cont, start, FIND_LEFT);
+            if(guess == NULL) guess = ref_find(cont, start, FIND_PREV_ROW_LAST_ITEM);
+            if(guess == NULL) guess = ref_focusable(cont, true);
+            break;
+        case LV_KEY_DOWN:
+            guess = ref_find(cont, start, FIND_BOTTOM);
+            if(guess == NULL) guess = ref_find(cont, start, FIND_FIRST_ROW);
+            break;
+        case LV_KEY_UP:
+            guess = ref_find(cont, start, FIND_TOP);
+            if(guess == NULL) guess = ref_find(cont, start, FIND_LAST_ROW);
+            break;
+    }
+    return guess ? guess : start;
+}
+
+static lv_obj_t * get_focused(void)
+{
+    lv_obj_t * focused = NULL;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(cont); i++) {
+        lv_obj_t * child = lv_obj_get_child(cont, i);
+        if(lv_obj_has_state(child, LV_STATE_FOCUS_KEY)) {
+            TEST_ASSERT_NULL_MESSAGE(focused, "more objects are focused");
+            focused = child;
+        }
+    }
+    return focused;
+}
+
+static void assert_same_as_ref(void)
+{
+    static const uint32_t keys[] = {LV_KEY_RIGHT, LV_KEY_LEFT, LV_KEY_DOWN, LV_KEY_UP};
+    uint32_t i;
+
+    /*Deleting a child makes the first child focused without clearing the state of the old one*/
+    for(i = 0; i < lv_obj_get_child_cnt(cont); i++) {
+        lv_obj_clear_state(lv_obj_get_child(cont, i), LV_STATE_FOCUSED | LV_STATE_FOCUS_KEY);
+    }
+
+    for(i = 0; i < lv_obj_get_child_cnt(cont); i++) {
+        lv_obj_t * start = lv_obj_get_child(cont, i);
+        if(!is_focusable(start)) continue;
+
+        uint32_t k;
+        for(k = 0; k < sizeof(keys) / sizeof(keys[0]); k++) {
+            lv_gridnav_set_focused(cont, start, LV_ANIM_OFF);
+            lv_obj_t * expected = ref_key(start, keys[k]);
+            uint32_t key = keys[k];
+            lv_event_send(cont, LV_EVENT_KEY, &key);
+            TEST_ASSERT_EQUAL_PTR(expected, get_focused());
+        }
+    }
+}
+
+#endif /*LV_USE_GRIDNAV*/
+
+void test_gridnav_same_as_linear_search(void)
+{
+#if LV_USE_GRIDNAV
+    lv_gridnav_add(cont, LV_GRIDNAV_CTRL_ROLLOVER);
+    lv_group_focus_obj(cont);
+    assert_same_as_ref();
+
+    /*The sorted children are updated when the children change*/
+    lv_obj_set_size(lv_obj_get_child(cont, 20), 150, 70);
+    lv_obj_move_to_index(lv_obj_get_child(cont, 100), 0);
+    lv_obj_del(lv_obj_get_child(cont, 200));
+    lv_obj_t * floating = lv_btn_create(cont);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_set_pos(floating, 300, 200);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+
+    /*Reverse the order of the children*/
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP_REVERSE);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+#endif
+}
+
+void test_gridnav_step_time(void)
+{
+#if LV_USE_GRIDNAV
+    lv_gridnav_add(cont, LV_GRIDNAV_CTRL_NONE);
+    lv_group_focus_obj(cont);
+
+    lv_obj_t * start = lv_obj_get_child(cont, BTN_CNT / 2);
+    uint32_t i;
+    clock_t t = clock();
+    for(i = 0; i < 1000; i++) ref_find(cont, start, FIND_BOTTOM);
+    double us_ref = (double)(clock() - t) * 1e6 / CLOCKS_PER_SEC / 1000;
+
+    uint32_t key = LV_KEY_DOWN;
+    t = clock();
+    for(i = 0; i < 1000; i++) {
+        lv_gridnav_set_focused(cont, start, LV_ANIM_OFF);
+        lv_event_send(cont, LV_EVENT_KEY, &key);
+    }
+    double us = (double)(clock() - t) * 1e6 / CLOCKS_PER_SEC / 1000;
+    TEST_PRINTF("%d children, linear search below: %d us, key step (search, focus and scroll): %d us",
+                BTN_CNT, (int)us_ref, (int)us);
+
+    TEST_ASSERT_EQUAL_PTR(ref_find(cont, start, FIND_BOTTOM), get_focused());
+#endif
+}
+
+#endif
@@ -0,0 +1,210 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+
+#if LV_USE_INDEV_FILTER
+
+/*The GT911 reports every 10 ms with about +-2 px noise*/
+#define SAMPLE_PERIOD   10
+
+typedef struct {
+    uint32_t time;
+    lv_coord_t x;
+    lv_coord_t y;
+} trace_sample_t;
+
+/*Noise of a finger resting on the touch panel*/
+static const int8_t jitter[] = {0, 2, -1, 1, -2, 0, 1, -1, 2, -2, 1, 0, -1, 2, -1, -2};
+
+static lv_point_filter_t filter;
+
+/**
+ * Play a trace sampled every SAMPLE_PERIOD ms: resting at `start` for `rest_time`,
+ * moving with `speed` [px/s] along X for `move_time`, and resting again for `rest_time`
+ */
+static uint32_t make_trace(trace_sample_t * trace, lv_coord_t start, int32_t speed, uint32_t rest_time,
+                           uint32_t move_time)
+{
+    uint32_t cnt = (2 * rest_time + move_time) / SAMPLE_PERIOD;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        uint32_t t = i * SAMPLE_PERIOD;
+        uint32_t moved = t < rest_time ? 0 : LV_MIN(t - rest_time, move_time);
+        trace[i].time = 1000 + t;
+        trace[i].x = start + (lv_coord_t)(speed * (int32_t)moved / 1000) + jitter[i % sizeof(jitter)];
+        trace[i].y = 240 + jitter[(i + 5) % sizeof(jitter)];
+    }
+
+    return cnt;
+}
+
+static lv_point_t apply(const lv_point_filter_cfg_t * cfg, const trace_sample_t * sample)
+{
+    lv_point_t p = {sample->x, sample->y};
+    lv_point_filter_apply(&filter, cfg, &p, sample->time, sample->time);
+    return p;
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_INDEV_FILTER
+    lv_point_filter_reset(&filter);
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_INDEV_FILTER
+    lv_memset_00(&lv_test_mouse_indev->driver->filter, sizeof(lv_point_filter_cfg_t));
+#endif
+    lv_test_mouse_release();
+    lv_indev_read_timer_cb(lv_test_mouse_indev->driver->read_timer);
+}
+
+void test_indev_filter_smooth_at_rest(void)
+{
+#if LV_USE_INDEV_FILTER
+    static trace_sample_t trace[64];
+    uint32_t cnt = make_trace(trace, 100, 0, 300, 0);
+    lv_point_filter_cfg_t cfg = {.min_cutoff = 30, .beta = 20, .predict_time = 0};
+
+    /*The first point is passed through*/
+    lv_point_t p = apply(&cfg, &trace[0]);
+    TEST_ASSERT_EQUAL(trace[0].x, p.x);
+    TEST_ASSERT_EQUAL(trace[0].y, p.y);
+
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        p = apply(&cfg, &trace[i]);
+        TEST_ASSERT_INT_WITHIN(1, 100, p.x);
+        TEST_ASSERT_INT_WITHIN(1, 240, p.y);
+    }
+
+    /*The prediction doesn't add noise at rest*/
+    lv_point_filter_reset(&filter);
+    cfg.predict_time = 20;
+    for(i = 0; i < cnt; i++) {
+        p = apply(&cfg, &trace[i]);
+        TEST_ASSERT_INT_WITHIN(1, 100, p.x);
+    }
+#endif
+}
+
+void test_indev_filter_predict_motion(void)
+{
+    /*Swipe with 1000 px/s for 200 ms*/
+#if LV_USE_INDEV_FILTER
+    static trace_sample_t trace[64];
+    uint32_t cnt = make_trace(trace, 100, 1000, 100, 200);
+    lv_point_filter_cfg_t cfg = {.min_cutoff = 30, .beta = 20, .predict_time = 0};
+    lv_point_filter_cfg_t cfg_predict = {.min_cutoff = 30, .beta = 20, .predict_time = 20};
+    lv_point_filter_t filter_predict;
+    lv_point_filter_reset(&filter_predict);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_point_t p = apply(&cfg, &trace[i]);
+
+        lv_point_t p_predict = {trace[i].x, trace[i].y};
+        lv_point_filter_apply(&filter_predict, &cfg_predict, &p_predict, trace[i].time, trace[i].time);
+
+        /*In the second half of the swipe the speed is followed*/
+        uint32_t t = trace[i].time - trace[0].time;
+        if(t >= 200 && t < 300) {
+            lv_coord_t raw = 100 + (lv_coord_t)(t - 100);
+            /*The filter lags a little behind the finger, the prediction is ahead of it*/
+            TEST_ASSERT_INT_WITHIN(4, raw - 8, p.x);
+            TEST_ASSERT_INT_WITHIN(5, raw + 12, p_predict.x);
+            TEST_ASSERT_INT_WITHIN(2, 240, p_predict.y);
+        }
+    }
+
+    /*Stopped at 300 without overshoot*/
+    lv_point_t p = {300, 240};
+    lv_point_filter_apply(&filter_predict, &cfg_predict, &p, trace[cnt - 1].time + SAMPLE_PERIOD,
+                          trace[cnt - 1].time + SAMPLE_PERIOD);
+    TEST_ASSERT_INT_WITHIN(1, 300, p.x);
+#endif
+}
+
+void test_indev_filter_predict_to_display_time(void)
+{
+#if LV_USE_INDEV_FILTER
+    lv_point_filter_cfg_t cfg = {.min_cutoff = 0, .beta = 0, .predict_time = 10};
+    uint32_t i;
+    lv_point_t p;
+    for(i = 0; i < 20; i++) {
+        p.x = 100 + i * 10;
+        p.y = 100;
+        lv_point_filter_apply(&filter, &cfg, &p, i * 10, i * 10);
+    }
+    /*Not smoothed, only extrapolated with 1000 px/s by 10 ms*/
+    TEST_ASSERT_INT_WITHIN(1, 290 + 10, p.x);
+
+    /*An older sample is extrapolated further*/
+    p.x = 300;
+    p.y = 100;
+    lv_point_filter_apply(&filter, &cfg, &p, 200, 230);
+    TEST_ASSERT_INT_WITHIN(2, 300 + 40, p.x);
+
+    /*But not further than LV_POINT_FILTER_PREDICT_MAX*/
+    p.x = 310;
+    p.y = 100;
+    lv_point_filter_apply(&filter, &cfg, &p, 210, 210 + 1000);
+    TEST_ASSERT_INT_WITHIN(3, 310 + LV_POINT_FILTER_PREDICT_MAX, p.x);
+
+    /*After a gap the point is taken as it is*/
+    p.x = 500;
+    p.y = 100;
+    lv_point_filter_apply(&filter, &cfg, &p, 210 + LV_POINT_FILTER_GAP_MAX + 1, 210 + LV_POINT_FILTER_GAP_MAX + 1);
+    TEST_ASSERT_EQUAL(500, p.x);
+#endif
+}
+
+void test_indev_filter_in_indev(void)
+{
+#if LV_USE_INDEV_FILTER
+    lv_indev_t * indev = lv_test_mouse_indev;
+    indev->driver->filter.predict_time = 20;
+
+    lv_test_mouse_move_to(100, 100);
+    lv_test_mouse_press();
+    lv_indev_read_timer_cb(indev->driver->read_timer);
+
+    lv_point_t p;
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_tick_inc(SAMPLE_PERIOD);
+        lv_test_mouse_move_by(10, 0);
+        lv_indev_read_timer_cb(indev->driver->read_timer);
+    }
+
+    /*The point is ahead of the mouse, the raw point is kept*/
+    lv_indev_get_point(indev, &p);
+    TEST_ASSERT_INT_WITHIN(2, 300 + 20, p.x);
+    TEST_ASSERT_EQUAL(100, p.y);
+    TEST_ASSERT_EQUAL(300, indev->proc.types.pointer.last_raw_point.x);
+
+    /*Released where the mouse really is*/
+    lv_tick_inc(SAMPLE_PERIOD);
+    lv_test_mouse_release();
+    lv_indev_read_timer_cb(indev->driver->read_timer);
+    lv_indev_get_point(indev, &p);
+    TEST_ASSERT_EQUAL(300, p.x);
+
+    /*The next press starts from the raw point*/
+    lv_tick_inc(SAMPLE_PERIOD);
+    lv_test_mouse_move_to(50, 60);
+    lv_test_mouse_press();
+    lv_indev_read_timer_cb(indev->driver->read_timer);
+    lv_indev_get_point(indev, &p);
+    TEST_ASSERT_EQUAL(50, p.x);
+    TEST_ASSERT_EQUAL(60, p.y);
+#endif
+}
+
+#endif
@@ -0,0 +1,311 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_INDEV_MULTI_TOUCH_MAX
+
+#define EVENT_MAX   16
+
+static lv_indev_t * indev;
+static lv_indev_touch_t touches[LV_INDEV_MULTI_TOUCH_MAX];
+static uint8_t touch_cnt;
+
+static lv_obj_t * obj;
+static lv_multi_gesture_t events[EVENT_MAX];
+static uint32_t event_cnt;
+static uint32_t clicked_cnt;
+static uint32_t press_lost_cnt;
+
+static void read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data)
+{
+    LV_UNUSED(drv);
+    data->touch_cnt = touch_cnt;
+    lv_memcpy(data->touches, touches, sizeof(touches));
+    if(touch_cnt) data->point = touches[0].point;
+    data->state = touch_cnt ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code == LV_EVENT_MULTI_GESTURE) {
+        if(event_cnt < EVENT_MAX) events[event_cnt] = *lv_event_get_multi_gesture(e);
+        event_cnt++;
+    }
+    else if(code == LV_EVENT_CLICKED) clicked_cnt++;
+    else if(code == LV_EVENT_PRESS_LOST) press_lost_cnt++;
+}
+
+static void delete_event_cb(lv_event_t * e)
+{
+    lv_obj_del(lv_event_get_target(e));
+}
+
+static void touch(uint8_t cnt, uint8_t id0, lv_coord_t x0, lv_coord_t y0, uint8_t id1, lv_coord_t x1, lv_coord_t y1)
+{
+    touch_cnt = cnt;
+    touches[0].id = id0;
+    touches[0].point.x = x0;
+    touches[0].point.y = y0;
+    touches[1].id = id1;
+    touches[1].point.x = x1;
+    touches[1].point.y = y1;
+}
+
+static void read(void)
+{
+    lv_tick_inc(10);
+    lv_indev_read_timer_cb(indev->driver->read_timer);
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    static lv_indev_drv_t drv;
+    lv_indev_drv_init(&drv);
+    drv.type = LV_INDEV_TYPE_POINTER;
+    drv.read_cb = read_cb;
+    indev = lv_indev_drv_register(&drv);
+    touch_cnt = 0;
+
+    obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_ALL, NULL);
+    lv_obj_update_layout(obj);
+
+    event_cnt = 0;
+    clicked_cnt = 0;
+    press_lost_cnt = 0;
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    lv_indev_delete(indev);
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+void test_indev_multi_touch_pinch(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    touch(2, 3, 300, 240, 7, 500, 240);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(0, event_cnt);
+
+    /*Spread the fingers to the double distance*/
+    touch(2, 3, 250, 240, 7, 550, 240);
+    read();
+    touch(2, 3, 200, 240, 7, 600, 240);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, event_cnt);
+    TEST_ASSERT_EQUAL(LV_MULTI_GESTURE_BEGIN, events[0].state);
+    TEST_ASSERT_EQUAL(LV_MULTI_GESTURE_PINCH, events[0].types);
+    TEST_ASSERT_INT_WITHIN(2, 512, events[0].scale);
+    TEST_ASSERT_INT_WITHIN(2, 512, events[0].scale_sum);
+    TEST_ASSERT_EQUAL(400, events[0].center.x);
+    TEST_ASSERT_EQUAL(240, events[0].center.y);
+    TEST_ASSERT_EQUAL(0, events[0].rotation_sum);
+
+    /*Back to the original distance*/
+    touch(2, 3, 300, 240, 7, 500, 240);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, event_cnt);
+    TEST_ASSERT_EQUAL(LV_MULTI_GESTURE_CHANGE, events[1].state);
+    TEST_ASSERT_INT_WITHIN(2, 128, events[1].scale);
+    TEST_ASSERT_INT_WITHIN(2, 256, events[1].scale_sum);
+
+    /*Lift a finger*/
+    touch(1, 3, 300, 240, 0, 0, 0);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(3, event_cnt);
+    TEST_ASSERT_EQUAL(LV_MULTI_GESTURE_END, events[2].state);
+    TEST_ASSERT_EQUAL(256, events[2].scale);
+
+    /*Nothing more is sent*/
+    touch(0, 0, 0, 0, 0, 0, 0);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(3, event_cnt);
+#endif
+}
+
+void test_indev_multi_touch_rotate(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    touch(2, 1, 300, 240, 2, 500, 240);
+    read();
+    touch(2, 1, 329, 169, 2, 471, 311);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, event_cnt);
+    TEST_ASSERT_EQUAL(LV_MULTI_GESTURE_ROTATE, events[0].types);
+    TEST_ASSERT_INT_WITHIN(2, 45, events[0].rotation);
+
+    touch(2, 1, 400, 140, 2, 400, 340);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, event_cnt);
+    TEST_ASSERT_INT_WITHIN(2, 45, events[1].rotation);
+    TEST_ASSERT_INT_WITHIN(2, 90, events[1].rotation_sum);
+    TEST_ASSERT_EQUAL(256, events[1].scale_sum);
+    TEST_ASSERT_EQUAL(0, events[1].pan_sum.x);
+
+    /*Across 180 degrees the rotation is continuous*/
+    touch(2, 1, 500, 240, 2, 300, 240);
+    read();
+    lv_refr_now(NULL);
+    touch(2, 1, 471, 311, 2, 329, 169);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(4, event_cnt);
+    TEST_ASSERT_INT_WITHIN(2, 45, events[3].rotation);
+    TEST_ASSERT_INT_WITHIN(3, 225, events[3].rotation_sum);
+#endif
+}
+
+void test_indev_multi_touch_pan(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    touch(2, 1, 300, 240, 2, 400, 240);
+    read();
+    touch(2, 1, 350, 260, 2, 450, 260);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, event_cnt);
+    TEST_ASSERT_EQUAL(LV_MULTI_GESTURE_PAN, events[0].types);
+    TEST_ASSERT_EQUAL(50, events[0].pan.x);
+    TEST_ASSERT_EQUAL(20, events[0].pan.y);
+
+    touch(2, 1, 360, 250, 2, 460, 250);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, event_cnt);
+    TEST_ASSERT_EQUAL(10, events[1].pan.x);
+    TEST_ASSERT_EQUAL(-10, events[1].pan.y);
+    TEST_ASSERT_EQUAL(60, events[1].pan_sum.x);
+    TEST_ASSERT_EQUAL(10, events[1].pan_sum.y);
+#endif
+}
+
+void test_indev_multi_touch_one_event_per_frame(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    touch(2, 1, 300, 240, 2, 400, 240);
+    read();
+
+    /*The touch panel reports faster than the display refreshes*/
+    uint32_t i;
+    for(i = 1; i <= 5; i++) {
+        touch(2, 1, 300 + i * 10, 240, 2, 400 + i * 10, 240);
+        read();
+    }
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, event_cnt);
+    TEST_ASSERT_EQUAL(50, events[0].pan.x);
+
+    for(i = 6; i <= 8; i++) {
+        touch(2, 1, 300 + i * 10, 240, 2, 400 + i * 10, 240);
+        read();
+    }
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, event_cnt);
+    TEST_ASSERT_EQUAL(30, events[1].pan.x);
+
+    /*No event without a change*/
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, event_cnt);
+#endif
+}
+
+void test_indev_multi_touch_tracking_id(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    touch(2, 4, 300, 240, 9, 500, 240);
+    read();
+    lv_refr_now(NULL);
+
+    /*The panel reports the same touches in the other order*/
+    touch(2, 9, 500, 240, 4, 300, 240);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(0, event_cnt);
+
+    /*A third finger doesn't matter*/
+    touch(3, 9, 500, 240, 5, 100, 100);
+    touches[2].id = 4;
+    touches[2].point.x = 300;
+    touches[2].point.y = 240;
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(0, event_cnt);
+
+    /*Noise below the limits isn't a gesture*/
+    touch(2, 4, 302, 239, 9, 499, 242);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(0, event_cnt);
+#endif
+}
+
+void test_indev_multi_touch_no_click(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    /*One finger still clicks*/
+    touch(1, 1, 300, 240, 0, 0, 0);
+    read();
+    touch(0, 0, 0, 0, 0, 0, 0);
+    read();
+    TEST_ASSERT_EQUAL(1, clicked_cnt);
+
+    /*A gesture is not a click*/
+    touch(1, 1, 300, 240, 0, 0, 0);
+    read();
+    touch(2, 1, 300, 240, 2, 400, 240);
+    read();
+    touch(2, 1, 250, 240, 2, 450, 240);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, event_cnt);
+
+    touch(0, 0, 0, 0, 0, 0, 0);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, event_cnt);
+    TEST_ASSERT_EQUAL(LV_MULTI_GESTURE_END, events[1].state);
+    TEST_ASSERT_EQUAL(1, clicked_cnt);
+    TEST_ASSERT_EQUAL(1, press_lost_cnt);
+#endif
+}
+
+void test_indev_multi_touch_delete_obj(void)
+{
+#if LV_INDEV_MULTI_TOUCH_MAX
+    lv_obj_add_event_cb(obj, delete_event_cb, LV_EVENT_MULTI_GESTURE, NULL);
+
+    touch(2, 1, 300, 240, 2, 400, 240);
+    read();
+    touch(2, 1, 250, 240, 2, 450, 240);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, event_cnt);
+
+    /*The deleted object gets no more events*/
+    touch(0, 0, 0, 0, 0, 0, 0);
+    read();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, event_cnt);
+#endif
+}
+
+#endif
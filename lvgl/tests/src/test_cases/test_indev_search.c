@@ -0,0 +1,165 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define BTN_CNT     400
+#define POINT_STEP  9
+
+static lv_obj_t * cont;
+static uint32_t ref_visit_cnt;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 780, 460);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < BTN_CNT; i++) {
+        lv_obj_t * btn = lv_btn_create(cont);
+        lv_obj_set_size(btn, 60, 30);
+    }
+
+    lv_obj_update_layout(lv_scr_act());
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+/*The search without any index*/
+static lv_obj_t * ref_search(lv_obj_t * obj, lv_point_t * point)
+{
+    ref_visit_cnt++;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return NULL;
+
+    lv_point_t p_trans = *point;
+    lv_obj_transform_point(obj, &p_trans, false, true);
+
+    bool hit_test_ok = lv_obj_hit_test(obj, &p_trans);
+    if(_lv_area_is_point_on(&obj->coords, &p_trans, 0) || lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        int32_t i;
+        for(i = lv_obj_get_child_cnt(obj) - 1; i >= 0; i--) {
+            lv_obj_t * found_p = ref_search(lv_obj_get_child(obj, i), &p_trans);
+            if(found_p) return found_p;
+        }
+    }
+
+    return hit_test_ok ? obj : NULL;
+}
+
+static void assert_same_as_ref(void)
+{
+    lv_point_t p;
+    for(p.y = 0; p.y < lv_disp_get_ver_res(NULL); p.y += POINT_STEP) {
+        for(p.x = 0; p.x < lv_disp_get_hor_res(NULL); p.x += POINT_STEP) {
+            lv_obj_t * ref = ref_search(lv_scr_act(), &p);
+            lv_obj_t * res = lv_indev_search_obj(lv_scr_act(), &p);
+            TEST_ASSERT_EQUAL_PTR(ref, res);
+        }
+    }
+}
+
+void test_indev_search_same_as_tree_walk(void)
+{
+    assert_same_as_ref();
+
+    /*Hidden, reordered, deleted and new children*/
+    lv_obj_add_flag(lv_obj_get_child(cont, 3), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_to_index(lv_obj_get_child(cont, 10), 0);
+    lv_obj_swap(lv_obj_get_child(cont, 20), lv_obj_get_child(cont, 30));
+    lv_obj_del(lv_obj_get_child(cont, 40));
+    lv_btn_create(cont);
+    assert_same_as_ref();
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+
+    /*Larger click area*/
+    lv_obj_set_ext_click_area(lv_obj_get_child(cont, 50), 8);
+    assert_same_as_ref();
+
+    /*Floating child over the others*/
+    lv_obj_t * floating = lv_obj_get_child(cont, 60);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_set_pos(floating, 100, 100);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+
+    /*Transformed child*/
+    lv_obj_set_style_transform_zoom(lv_obj_get_child(cont, 70), 512, 0);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+
+    /*Child with a clickable child out of its area*/
+    lv_obj_t * parent = lv_obj_get_child(cont, 80);
+    lv_obj_add_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    lv_obj_t * btn = lv_btn_create(parent);
+    lv_obj_set_pos(btn, 50, 50);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+
+    /*Resized child*/
+    lv_obj_set_size(lv_obj_get_child(cont, 90), 200, 80);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+
+    /*Scrolled and moved container*/
+    lv_obj_scroll_to_y(cont, 300, LV_ANIM_OFF);
+    assert_same_as_ref();
+    lv_obj_set_pos(cont, 10, 15);
+    lv_obj_update_layout(lv_scr_act());
+    assert_same_as_ref();
+}
+
+void test_indev_search_visits_few_objects(void)
+{
+    uint32_t obj_cnt = BTN_CNT + 2;
+    lv_obj_t * btn = lv_obj_get_child(cont, BTN_CNT / 2);
+    lv_obj_scroll_to_view(btn, LV_ANIM_OFF);
+    lv_point_t p;
+    p.x = (btn->coords.x1 + btn->coords.x2) / 2;
+    p.y = (btn->coords.y1 + btn->coords.y2) / 2;
+
+    /*Build the grid*/
+    lv_indev_search_obj(lv_scr_act(), &p);
+
+    lv_indev_reset_search_stat();
+    TEST_ASSERT_EQUAL_PTR(btn, lv_indev_search_obj(lv_scr_act(), &p));
+
+    lv_indev_search_stat_t stat;
+    lv_indev_get_search_stat(&stat);
+    TEST_PRINTF("search: %d of %d objects visited", (int)stat.visit_cnt, (int)obj_cnt);
+
+    uint32_t i;
+    clock_t start = clock();
+    for(i = 0; i < 1000; i++) ref_search(lv_scr_act(), &p);
+    double us_ref = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / 1000;
+    start = clock();
+    for(i = 0; i < 1000; i++) lv_indev_search_obj(lv_scr_act(), &p);
+    double us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / 1000;
+    TEST_PRINTF("search time, tree walk: %d us, indexed: %d us", (int)us_ref, (int)us);
+
+#if LV_OBJ_HIT_GRID_MIN_CHILD
+    TEST_ASSERT_LESS_THAN_UINT32(obj_cnt / 20, stat.visit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.grid_build_cnt);
+
+    /*Scrolling doesn't need to rebuild the grid*/
+    lv_obj_scroll_by(cont, 0, 50, LV_ANIM_OFF);
+    lv_indev_search_obj(lv_scr_act(), &p);
+    lv_indev_get_search_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.grid_build_cnt);
+
+    /*Moving a child does*/
+    lv_obj_set_style_translate_x(btn, 5, 0);
+    lv_obj_update_layout(lv_scr_act());
+    lv_indev_search_obj(lv_scr_act(), &p);
+    lv_indev_get_search_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.grid_build_cnt);
+#endif
+}
+
+#endif
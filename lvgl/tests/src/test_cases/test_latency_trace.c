@@ -0,0 +1,198 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+
+#include <string.h>
+
+extern lv_indev_t * lv_test_mouse_indev;
+
+static lv_obj_t * obj;
+static char report[1024];
+
+void setUp(void)
+{
+    /*Pressing the object only needs a redraw, without transitions*/
+    obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 100, 50);
+    lv_obj_center(obj);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_RED), LV_STATE_PRESSED);
+    lv_obj_update_layout(obj);
+
+    /*Start from a released mouse and a clean screen*/
+    lv_test_mouse_move_to(lv_obj_get_x(obj) + 50, lv_obj_get_y(obj) + 25);
+    lv_test_mouse_release();
+    lv_indev_read_timer_cb(lv_test_mouse_indev->driver->read_timer);
+    lv_refr_now(NULL);
+
+#if LV_USE_LATENCY_TRACE
+    lv_latency_trace_reset();
+#endif
+    report[0] = '\0';
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+#if LV_USE_LATENCY_TRACE
+static void report_cb(const char * line)
+{
+    strncat(report, line, sizeof(report) - strlen(report) - 2);
+    strcat(report, "\n");
+}
+
+static void read_mouse(void)
+{
+    lv_indev_read_timer_cb(lv_test_mouse_indev->driver->read_timer);
+}
+
+static void assert_latency_ms(lv_latency_trace_point_t id, uint32_t ms)
+{
+    lv_latency_trace_stat_t stat;
+    lv_latency_trace_get_stat(id, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.cnt);
+    TEST_ASSERT_EQUAL_UINT32(ms * 1000, stat.min_us);
+    TEST_ASSERT_EQUAL_UINT32(ms * 1000, stat.max_us);
+}
+#endif
+
+void test_latency_trace_touch_to_display(void)
+{
+#if LV_USE_LATENCY_TRACE
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_IRQ);
+    lv_tick_inc(1);
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_ACQUIRED);
+
+    /*Redraws before the input is read don't belong to the interaction*/
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+
+    lv_tick_inc(2);
+    lv_test_mouse_press();
+    read_mouse();
+
+    lv_tick_inc(3);
+    lv_refr_now(NULL);
+
+    lv_tick_inc(4);
+    lv_latency_trace_point(LV_LATENCY_TRACE_DISP_SHOW);
+
+    TEST_ASSERT_EQUAL_UINT32(1, lv_latency_trace_get_done_cnt());
+    TEST_ASSERT_EQUAL_UINT32(0, lv_latency_trace_get_no_redraw_cnt());
+    assert_latency_ms(LV_LATENCY_TRACE_INPUT_ACQUIRED, 1);
+    assert_latency_ms(LV_LATENCY_TRACE_INDEV_READ, 3);
+    assert_latency_ms(LV_LATENCY_TRACE_INDEV_PRESS, 3);
+    assert_latency_ms(LV_LATENCY_TRACE_INVALIDATE, 3);
+    assert_latency_ms(LV_LATENCY_TRACE_RENDER_DONE, 6);
+    assert_latency_ms(LV_LATENCY_TRACE_FLUSH, 6);
+    assert_latency_ms(LV_LATENCY_TRACE_DISP_SHOW, 10);
+
+    /*10000 us has 14 significant bits*/
+    lv_latency_trace_stat_t stat;
+    lv_latency_trace_get_stat(LV_LATENCY_TRACE_DISP_SHOW, &stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hist[14]);
+
+    /*Nothing is recorded until the next input*/
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    lv_latency_trace_point(LV_LATENCY_TRACE_DISP_SHOW);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_latency_trace_get_done_cnt());
+
+    lv_latency_trace_report(report_cb);
+    TEST_ASSERT_NOT_NULL(strstr(report, "Latency of 1 interactions (0 without redraw)"));
+    TEST_ASSERT_NOT_NULL(strstr(report, "disp_show"));
+    TEST_ASSERT_NOT_NULL(strstr(report, "<16384:1"));
+    TEST_ASSERT_NULL(strstr(report, "input_irq"));      /*The start has no latency*/
+#endif
+}
+
+void test_latency_trace_without_redraw(void)
+{
+#if LV_USE_LATENCY_TRACE
+    /*A release on a released mouse changes nothing*/
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_IRQ);
+    read_mouse();
+    lv_refr_now(NULL);
+
+    /*Nothing can be changed by the input after a refresh period*/
+    lv_tick_inc(LV_DISP_DEF_REFR_PERIOD);
+    read_mouse();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_latency_trace_get_no_redraw_cnt());
+    lv_tick_inc(1);
+    read_mouse();
+    TEST_ASSERT_EQUAL_UINT32(1, lv_latency_trace_get_no_redraw_cnt());
+
+    /*An input arriving in the refresh period belongs to the same interaction*/
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_IRQ);
+    read_mouse();
+    lv_tick_inc(10);
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_IRQ);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_latency_trace_get_no_redraw_cnt());
+
+    /*The next input after the refresh period closes it*/
+    lv_tick_inc(LV_DISP_DEF_REFR_PERIOD);
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_IRQ);
+    TEST_ASSERT_EQUAL_UINT32(2, lv_latency_trace_get_no_redraw_cnt());
+
+    /*Pressing the object redraws it*/
+    lv_tick_inc(5);
+    lv_test_mouse_press();
+    read_mouse();
+    lv_refr_now(NULL);
+    lv_latency_trace_point(LV_LATENCY_TRACE_DISP_SHOW);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_latency_trace_get_done_cnt());
+    TEST_ASSERT_EQUAL_UINT32(2, lv_latency_trace_get_no_redraw_cnt());
+    assert_latency_ms(LV_LATENCY_TRACE_DISP_SHOW, 5);
+#endif
+}
+
+void test_latency_trace_without_display_mark(void)
+{
+#if LV_USE_LATENCY_TRACE
+    /*The interaction is finished by the next input if the port doesn't mark the display*/
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_ACQUIRED);
+    lv_tick_inc(2);
+    lv_test_mouse_press();
+    read_mouse();
+    lv_tick_inc(8);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_latency_trace_get_done_cnt());
+
+    lv_tick_inc(20);
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_ACQUIRED);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_latency_trace_get_done_cnt());
+    assert_latency_ms(LV_LATENCY_TRACE_FLUSH, 10);
+
+    lv_latency_trace_stat_t stat;
+    lv_latency_trace_get_stat(LV_LATENCY_TRACE_DISP_SHOW, &stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.cnt);
+#endif
+}
+
+void test_latency_trace_time_stamp_order(void)
+{
+#if LV_USE_LATENCY_TRACE
+    /*A time stamp saved in an interrupt earlier than the last step is not recorded*/
+    uint32_t irq_time = lv_latency_trace_get_time();
+    lv_tick_inc(3);
+    lv_latency_trace_point(LV_LATENCY_TRACE_INPUT_IRQ);
+    lv_latency_trace_point_at(LV_LATENCY_TRACE_INPUT_ACQUIRED, irq_time);
+
+    lv_tick_inc(2);
+    lv_test_mouse_press();
+    read_mouse();
+    lv_refr_now(NULL);
+    lv_latency_trace_point(LV_LATENCY_TRACE_DISP_SHOW);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_latency_trace_get_done_cnt());
+
+    lv_latency_trace_stat_t stat;
+    lv_latency_trace_get_stat(LV_LATENCY_TRACE_INPUT_ACQUIRED, &stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.cnt);
+    assert_latency_ms(LV_LATENCY_TRACE_INDEV_READ, 2);
+#endif
+}
+
+#endif
@@ -0,0 +1,154 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define ROW_CNT     30
+#define COL_CNT     3
+
+static lv_obj_t * cont;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 400, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        lv_obj_t * row = lv_obj_create(cont);
+        lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW_WRAP);
+
+        uint32_t j;
+        for(j = 0; j < COL_CNT; j++) {
+            lv_obj_t * label = lv_label_create(row);
+            lv_label_set_text_fmt(label, "Item %d.%d", (int)i, (int)j);
+        }
+    }
+
+    lv_obj_update_layout(cont);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+static uint32_t count_objs(const lv_obj_t * obj)
+{
+    uint32_t cnt = 1;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) cnt += count_objs(lv_obj_get_child(obj, i));
+    return cnt;
+}
+
+static void save_coords(const lv_obj_t * obj, lv_area_t ** p)
+{
+    **p = obj->coords;
+    (*p)++;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) save_coords(lv_obj_get_child(obj, i), p);
+}
+
+static void mark_all_dirty(lv_obj_t * obj)
+{
+    lv_obj_mark_layout_as_dirty(obj);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) mark_all_dirty(lv_obj_get_child(obj, i));
+}
+
+void test_layout_update_dirty_subtree_only(void)
+{
+    uint32_t obj_cnt = count_objs(lv_scr_act());
+
+    /*Make a row taller by wrapping its labels*/
+    lv_obj_t * label = lv_obj_get_child(lv_obj_get_child(cont, ROW_CNT / 2), 1);
+    lv_obj_reset_layout_stat();
+    lv_label_set_text(label, "A much longer text which needs a new line in the row");
+    lv_obj_update_layout(cont);
+
+    lv_obj_layout_stat_t stat;
+    lv_obj_get_layout_stat(&stat);
+    TEST_PRINTF("layout: %d passes, %d of %d objects visited, %d size, %d position updates",
+                (int)stat.pass_cnt, (int)stat.visit_cnt, (int)obj_cnt, (int)stat.refr_cnt, (int)stat.pos_refr_cnt);
+    TEST_PRINTF("self size: %d measured, %d from the cache", (int)stat.self_size_cnt, (int)stat.self_size_hit_cnt);
+
+    /*Only the path to the label and the ancestors of the resized objects are visited in each pass*/
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.pass_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(obj_cnt / 4, stat.visit_cnt);
+
+    /*The result is the same as laying out everything again*/
+    static lv_area_t coords_inc[1 + ROW_CNT * (COL_CNT + 1)];
+    static lv_area_t coords_full[1 + ROW_CNT * (COL_CNT + 1)];
+    lv_area_t * p = coords_inc;
+    save_coords(cont, &p);
+
+    mark_all_dirty(cont);
+    lv_obj_update_layout(cont);
+    p = coords_full;
+    save_coords(cont, &p);
+
+    TEST_ASSERT_EQUAL_MEMORY(coords_full, coords_inc, sizeof(coords_full));
+    TEST_ASSERT_GREATER_THAN(lv_obj_get_height(lv_obj_get_child(cont, 0)),
+                             lv_obj_get_height(lv_obj_get_child(cont, ROW_CNT / 2)));
+}
+
+void test_layout_update_position_only(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 100, LV_SIZE_CONTENT);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Position");
+    lv_obj_update_layout(obj);
+    lv_coord_t h = lv_obj_get_height(obj);
+
+    lv_obj_reset_layout_stat();
+    lv_obj_set_pos(obj, 30, 40);
+    lv_obj_update_layout(obj);
+
+    lv_obj_layout_stat_t stat;
+    lv_obj_get_layout_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.pos_refr_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.self_size_cnt);
+
+    TEST_ASSERT_EQUAL(30, lv_obj_get_x(obj));
+    TEST_ASSERT_EQUAL(40, lv_obj_get_y(obj));
+    TEST_ASSERT_EQUAL(h, lv_obj_get_height(obj));
+    TEST_ASSERT_EQUAL(obj->coords.x1 + lv_obj_get_style_pad_left(obj, 0) + lv_obj_get_style_border_width(obj, 0),
+                      label->coords.x1);
+}
+
+void test_layout_self_size_cache(void)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "Cached");
+    lv_obj_update_layout(label);
+    lv_coord_t w = lv_obj_get_width(label);
+
+    /*A new text or style is measured again*/
+    lv_label_set_text(label, "Cached text");
+    lv_obj_update_layout(label);
+    TEST_ASSERT_GREATER_THAN(w, lv_obj_get_width(label));
+    TEST_ASSERT_EQUAL(lv_obj_get_width(label), lv_obj_get_self_width(label));
+
+    w = lv_obj_get_width(label);
+    lv_obj_set_style_text_letter_space(label, 4, 0);
+    lv_obj_update_layout(label);
+    TEST_ASSERT_GREATER_THAN(w, lv_obj_get_width(label));
+
+    lv_obj_reset_layout_stat();
+    lv_obj_get_self_width(label);
+    lv_obj_get_self_height(label);
+
+    lv_obj_layout_stat_t stat;
+    lv_obj_get_layout_stat(&stat);
+#if LV_OBJ_SELF_SIZE_CACHE
+    TEST_ASSERT_EQUAL_UINT32(0, stat.self_size_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.self_size_hit_cnt);
+#else
+    TEST_ASSERT_EQUAL_UINT32(2, stat.self_size_cnt);
+#endif
+}
+
+#endif
@@ -3,6 +3,42 @@
 
 #include "unity/unity.h"
 
+/*Create/delete cycles of the slab soak test. Set by `main.py --soak-cycles` for a long run, see README.md*/
+#ifndef LV_TEST_MEM_SOAK_CYCLES
+    #define LV_TEST_MEM_SOAK_CYCLES 20000
+#endif
+
+#define SOAK_ROW_NUM    32
+
+#if LV_USE_MEM_PROFILER
+static uint8_t profile_buf[4096];
+static uint32_t profile_len;
+
+static void profile_write_cb(const void * data, uint32_t len)
+{
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(profile_buf), profile_len + len);
+    lv_memcpy(&profile_buf[profile_len], data, len);
+    profile_len += len;
+}
+
+static lv_uintptr_t profile_get_ptr(uint32_t * pos)
+{
+    lv_uintptr_t v = 0;
+    uint32_t i;
+    for(i = 0; i < sizeof(void *); i++) v |= (lv_uintptr_t)profile_buf[*pos + i] << (i * 8);
+    *pos += sizeof(void *);
+    return v;
+}
+
+static uint32_t profile_get_u32(uint32_t * pos)
+{
+    uint32_t v = profile_buf[*pos] | profile_buf[*pos + 1] << 8 | profile_buf[*pos + 2] << 16 |
+                 (uint32_t)profile_buf[*pos + 3] << 24;
+    *pos += 4;
+    return v;
+}
+#endif
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -23,4 +59,263 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+void test_mem_ext_placement(void)
+{
+#if LV_MEM_CUSTOM == 0 && LV_MEM_EXT
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor_ext(&mon_start);
+    TEST_ASSERT_EQUAL_UINT32(LV_MEM_EXT_SIZE, mon_start.total_size);
+
+    /*Small allocations stay in the main pool*/
+    void * small = lv_mem_alloc(32);
+    lv_mem_monitor_ext(&mon);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.free_size, mon.free_size);
+
+    /*Large ones go to the bulk pool*/
+    void * large = lv_mem_alloc(LV_MEM_EXT_THRESHOLD);
+    lv_mem_monitor_ext(&mon);
+    TEST_ASSERT_LESS_THAN_UINT32(mon_start.free_size, mon.free_size);
+
+    /*Hints override the size threshold*/
+    lv_mem_monitor_t mon_prev = mon;
+    void * bulk = lv_mem_alloc_hint(16, LV_MEM_HINT_BULK);
+    lv_mem_monitor_ext(&mon);
+    TEST_ASSERT_LESS_THAN_UINT32(mon_prev.free_size, mon.free_size);
+
+    mon_prev = mon;
+    void * fast = lv_mem_alloc_hint(LV_MEM_EXT_THRESHOLD * 2, LV_MEM_HINT_FAST);
+    lv_mem_monitor_ext(&mon);
+    TEST_ASSERT_EQUAL_UINT32(mon_prev.free_size, mon.free_size);
+
+    /*Growing keeps the data and the pool*/
+    lv_memset(bulk, 0x5a, 16);
+    bulk = lv_mem_realloc(bulk, 64);
+    TEST_ASSERT_EQUAL_UINT8(0x5a, ((uint8_t *)bulk)[15]);
+    lv_mem_monitor_ext(&mon);
+    TEST_ASSERT_LESS_THAN_UINT32(mon_start.free_size, mon.free_size);
+
+    lv_mem_free(small);
+    lv_mem_free(large);
+    lv_mem_free(bulk);
+    lv_mem_free(fast);
+
+    lv_mem_monitor_ext(&mon);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_scratch_arena(void)
+{
+#if LV_MEM_SCRATCH_SIZE
+    /*Released blocks are given back from the top, even if released out of order*/
+    _lv_mem_scratch_begin();
+    void * a = lv_mem_buf_get(100);
+    void * b = lv_mem_buf_get(30);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    lv_mem_buf_release(a);
+    void * c = lv_mem_buf_get(10);
+    TEST_ASSERT_NOT_EQUAL(a, c);
+    lv_mem_buf_release(c);
+    lv_mem_buf_release(b);
+    void * d = lv_mem_buf_get(20);
+    TEST_ASSERT_EQUAL_PTR(a, d);
+    lv_mem_buf_release(d);
+
+    /*Too large requests still work, from the normal buffers*/
+    lv_mem_scratch_monitor_t mon;
+    lv_mem_scratch_monitor(&mon);
+    uint32_t fallback_start = mon.fallback_cnt;
+    void * big = lv_mem_buf_get(LV_MEM_SCRATCH_SIZE + 16);
+    TEST_ASSERT_NOT_NULL(big);
+    lv_mem_buf_release(big);
+    _lv_mem_scratch_end();
+
+    lv_mem_scratch_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(fallback_start + 1, mon.fallback_cnt);
+    lv_mem_buf_free_all();
+
+    /*Rendering uses the arena and the peak is reported*/
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, 200, 100);
+    lv_obj_set_style_radius(obj, 20, 0);
+    lv_obj_set_style_shadow_width(obj, 10, 0);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Scratch arena");
+    lv_refr_now(NULL);
+
+    lv_mem_scratch_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(LV_MEM_SCRATCH_SIZE, mon.total_size);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mon.frame_peak);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(mon.frame_peak, mon.max_peak);
+
+    lv_obj_del(obj);
+#endif
+}
+
+void test_mem_slab(void)
+{
+#if LV_MEM_SLAB_SIZE
+    lv_mem_slab_monitor_t mon_start;
+    lv_mem_slab_monitor_t mon;
+    lv_mem_slab_monitor(&mon_start);
+    TEST_ASSERT_EQUAL_UINT32(LV_MEM_SLAB_SIZE, mon_start.total_size);
+
+    /*Sizes are rounded up to the next class*/
+    void * p20 = lv_mem_alloc(20);
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT16(24, mon.cls[1].block_size);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.cls[1].used_cnt + 1, mon.cls[1].used_cnt);
+
+    /*Growing within the block keeps the address, growing over it moves to a larger class*/
+    lv_memset(p20, 0x5a, 20);
+    TEST_ASSERT_EQUAL_PTR(p20, lv_mem_realloc(p20, 24));
+    void * p40 = lv_mem_realloc(p20, 40);
+    TEST_ASSERT_NOT_EQUAL(p20, p40);
+    TEST_ASSERT_EQUAL_UINT8(0x5a, ((uint8_t *)p40)[19]);
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.cls[1].used_cnt, mon.cls[1].used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.cls[3].used_cnt + 1, mon.cls[3].used_cnt);
+
+    /*Large and bulk allocations bypass the slabs*/
+    void * large = lv_mem_alloc(200);
+    void * bulk = lv_mem_alloc_hint(16, LV_MEM_HINT_BULK);
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.cls[0].alloc_cnt, mon.cls[0].alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.cls[LV_MEM_SLAB_CLASS_NUM - 1].alloc_cnt,
+                             mon.cls[LV_MEM_SLAB_CLASS_NUM - 1].alloc_cnt);
+
+    lv_mem_free(p40);
+    lv_mem_free(large);
+    lv_mem_free(bulk);
+
+    /*Fill more pages than a class needs and check that the empty ones are given back*/
+    static void * blocks[256];
+    uint32_t i;
+    for(i = 0; i < 256; i++) blocks[i] = lv_mem_alloc(128);
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT16(256 / (1024 / 128), mon.cls[6].page_cnt);
+    for(i = 0; i < 256; i++) lv_mem_free(blocks[i]);
+
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.cls[6].used_cnt, mon.cls[6].used_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT16(mon_start.cls[6].page_cnt + 1, mon.cls[6].page_cnt);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_profiler(void)
+{
+#if LV_USE_MEM_PROFILER
+    profile_len = 0;
+    lv_mem_profiler_start(profile_write_cb);
+    lv_mem_profiler_set_tag(7);
+
+    void * p = lv_mem_alloc(40);
+    void * p2 = lv_mem_realloc(p, 400);
+    lv_mem_free(p2);
+
+    lv_mem_profiler_set_tag(0);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_mem_profiler_stop();
+
+    /*The header*/
+    TEST_ASSERT_GREATER_THAN_UINT32(8, profile_len);
+    TEST_ASSERT_EQUAL_MEMORY(LV_MEM_PROFILER_MAGIC, profile_buf, 4);
+    TEST_ASSERT_EQUAL_UINT8(LV_MEM_PROFILER_VERSION, profile_buf[4]);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(void *), profile_buf[5]);
+
+    /*Alloc, realloc and free with the same call site*/
+    uint32_t pos = 8;
+    TEST_ASSERT_EQUAL_UINT8(LV_MEM_PROFILER_ALLOC, profile_buf[pos]);
+    TEST_ASSERT_EQUAL_UINT8(7, profile_buf[pos + 1]);
+    pos += 2;
+    TEST_ASSERT_EQUAL_PTR(p, (void *)profile_get_ptr(&pos));
+    TEST_ASSERT_EQUAL_UINT32(40, profile_get_u32(&pos));
+    lv_uintptr_t site = profile_get_ptr(&pos);
+    TEST_ASSERT_NOT_EQUAL(0, site);
+
+    TEST_ASSERT_EQUAL_UINT8(LV_MEM_PROFILER_REALLOC, profile_buf[pos]);
+    pos += 2;
+    TEST_ASSERT_EQUAL_PTR(p, (void *)profile_get_ptr(&pos));
+    TEST_ASSERT_EQUAL_PTR(p2, (void *)profile_get_ptr(&pos));
+    TEST_ASSERT_EQUAL_UINT32(400, profile_get_u32(&pos));
+    TEST_ASSERT_NOT_EQUAL(0, profile_get_ptr(&pos));
+
+    TEST_ASSERT_EQUAL_UINT8(LV_MEM_PROFILER_FREE, profile_buf[pos]);
+    pos += 2;
+    TEST_ASSERT_EQUAL_PTR(p2, (void *)profile_get_ptr(&pos));
+    TEST_ASSERT_NOT_EQUAL(0, profile_get_ptr(&pos));
+
+    /*The refresh starts a new frame*/
+    TEST_ASSERT_EQUAL_UINT8(LV_MEM_PROFILER_FRAME, profile_buf[pos]);
+    pos += 2;
+    TEST_ASSERT_EQUAL_UINT32(1, profile_get_u32(&pos));
+
+    /*Nothing is recorded after stopping*/
+    uint32_t len = profile_len;
+    lv_mem_free(lv_mem_alloc(16));
+    TEST_ASSERT_EQUAL_UINT32(len, profile_len);
+#endif
+}
+
+void test_mem_slab_soak(void)
+{
+#if LV_MEM_SLAB_SIZE
+    lv_obj_t * list = lv_list_create(lv_scr_act());
+    lv_obj_t * rows[SOAK_ROW_NUM] = {NULL};
+
+    /*Let the list allocate its own data for the children first*/
+    lv_obj_del(lv_list_add_btn(list, LV_SYMBOL_FILE, "Row"));
+    lv_refr_now(NULL);
+
+    lv_mem_slab_monitor_t slab_start;
+    lv_mem_slab_monitor(&slab_start);
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    /*List rows are created and deleted in random order as on a scrolling list*/
+    uint32_t i;
+    for(i = 0; i < LV_TEST_MEM_SOAK_CYCLES; i++) {
+        uint32_t r = lv_rand(0, SOAK_ROW_NUM - 1);
+        if(rows[r]) lv_obj_del(rows[r]);
+        rows[r] = lv_list_add_btn(list, LV_SYMBOL_FILE, "Row");
+        lv_obj_set_style_bg_color(rows[r], lv_palette_main(LV_PALETTE_BLUE), LV_STATE_PRESSED);
+        lv_obj_set_style_translate_x(rows[r], 5, LV_STATE_CHECKED);
+    }
+
+    for(i = 0; i < SOAK_ROW_NUM; i++) {
+        if(rows[i]) lv_obj_del(rows[i]);
+    }
+    lv_refr_now(NULL);
+
+    lv_mem_slab_monitor_t slab;
+    lv_mem_slab_monitor(&slab);
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    TEST_PRINTF("%d cycles, heap: frag %d%% -> %d%%, free %d -> %d, biggest free %d -> %d",
+                (int)LV_TEST_MEM_SOAK_CYCLES, mon_start.frag_pct, mon.frag_pct,
+                (int)mon_start.free_size, (int)mon.free_size,
+                (int)mon_start.free_biggest_size, (int)mon.free_biggest_size);
+    for(i = 0; i < LV_MEM_SLAB_CLASS_NUM; i++) {
+        TEST_PRINTF("slab %d: pages %d, max used %d, allocs %d, fallbacks %d", slab.cls[i].block_size,
+                    slab.cls[i].page_cnt, (int)slab.cls[i].max_used_cnt, (int)slab.cls[i].alloc_cnt,
+                    (int)slab.cls[i].fallback_cnt);
+        TEST_ASSERT_EQUAL_UINT32(slab_start.cls[i].used_cnt, slab.cls[i].used_cnt);
+        TEST_ASSERT_EQUAL_UINT32(0, slab.cls[i].fallback_cnt);
+    }
+
+    /*Nothing is leaked and the heap is not fragmented by the churn*/
+    TEST_ASSERT_EQUAL_UINT32(mon_start.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL_UINT32(mon_start.free_biggest_size, mon.free_biggest_size);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+
+    lv_obj_del(list);
+#endif
+}
+
 #endif
@@ -0,0 +1,207 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_disp.h"
+
+#if LV_USE_SCROLL_BLIT
+
+static lv_disp_t * disp;
+static lv_obj_t * cont;
+
+static void create_disp(bool double_buffered)
+{
+    disp = lv_test_disp_create(double_buffered, NULL);
+
+    /*A list of colored rows and labels*/
+    lv_obj_t * scr = lv_disp_get_scr_act(disp);
+    cont = lv_obj_create(scr);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
+    lv_obj_set_pos(cont, 10, 10);
+    lv_obj_set_size(cont, 180, 130);
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_SCROLL_BLIT);
+
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        lv_obj_t * row = lv_obj_create(cont);
+        lv_obj_remove_style_all(row);
+        lv_obj_set_style_bg_opa(row, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(row, lv_palette_main(i % 16), 0);
+        lv_obj_set_pos(row, (i % 3) * 20, i * 25);
+        lv_obj_set_size(row, 260, 20);
+
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text_fmt(label, "Row %d", (int)i);
+    }
+
+    lv_refr_now(disp);
+}
+
+/*In direct mode the whole screen is flushed, so count the pixels of the invalidated areas*/
+static uint32_t scroll_and_refr(lv_coord_t x, lv_coord_t y)
+{
+    static uint8_t inv_map[LV_TEST_DISP_HOR_RES * LV_TEST_DISP_VER_RES];
+    lv_memset_00(inv_map, sizeof(inv_map));
+
+    lv_obj_scroll_by(cont, x, y, LV_ANIM_OFF);
+
+    uint32_t px = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        const lv_area_t * a = &disp->inv_areas[i];
+        lv_coord_t ax;
+        lv_coord_t ay;
+        for(ay = a->y1; ay <= a->y2; ay++) {
+            for(ax = a->x1; ax <= a->x2; ax++) {
+                if(inv_map[ay * LV_TEST_DISP_HOR_RES + ax] == 0) px++;
+                inv_map[ay * LV_TEST_DISP_HOR_RES + ax] = 1;
+            }
+        }
+    }
+
+    lv_refr_now(disp);
+    return px;
+}
+
+#endif
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+#if LV_USE_SCROLL_BLIT
+    lv_test_disp_delete();
+#endif
+}
+
+void test_scroll_blit_vertical(void)
+{
+#if LV_USE_SCROLL_BLIT
+    create_disp(true);
+
+    /*Only the exposed strip is drawn*/
+    TEST_ASSERT_EQUAL(180 * 10, scroll_and_refr(0, -10));
+    TEST_ASSERT_EQUAL(180 * 7, scroll_and_refr(0, -7));
+    TEST_ASSERT_EQUAL(180 * 12, scroll_and_refr(0, 12));
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_scroll_blit_horizontal(void)
+{
+#if LV_USE_SCROLL_BLIT
+    create_disp(true);
+
+    TEST_ASSERT_EQUAL(130 * 15, scroll_and_refr(-15, 0));
+    TEST_ASSERT_EQUAL(130 * 5, scroll_and_refr(5, 0));
+    lv_test_disp_check_full_redraw();
+
+    /*Diagonally two strips are drawn*/
+    TEST_ASSERT_EQUAL(180 * 10 + 120 * 6, scroll_and_refr(-6, -10));
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_scroll_blit_single_buffer(void)
+{
+#if LV_USE_SCROLL_BLIT
+    create_disp(false);
+
+    /*The pixels are moved in place*/
+    TEST_ASSERT_EQUAL(180 * 10, scroll_and_refr(0, -10));
+    TEST_ASSERT_EQUAL(180 * 3, scroll_and_refr(0, 3));
+    TEST_ASSERT_EQUAL(130 * 9, scroll_and_refr(-9, 0));
+    TEST_ASSERT_EQUAL(130 * 4, scroll_and_refr(4, 0));
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_scroll_blit_more_in_a_frame(void)
+{
+#if LV_USE_SCROLL_BLIT
+    create_disp(true);
+
+    lv_obj_scroll_by(cont, 0, -10, LV_ANIM_OFF);
+    lv_obj_scroll_by(cont, 0, -10, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(180 * 25, scroll_and_refr(0, -5));
+    lv_test_disp_check_full_redraw();
+
+    /*A changed child is drawn at its old and new places*/
+    lv_obj_set_style_bg_color(lv_obj_get_child(cont, 2), lv_color_black(), 0);
+    scroll_and_refr(0, -20);
+    lv_test_disp_check_full_redraw();
+
+    /*Scrolling back and forth*/
+    lv_obj_scroll_by(cont, 0, -30, LV_ANIM_OFF);
+    scroll_and_refr(0, 30);
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_scroll_blit_scrollbar(void)
+{
+#if LV_USE_SCROLL_BLIT
+    create_disp(true);
+    lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, LV_PART_SCROLLBAR);
+    lv_obj_set_style_bg_color(cont, lv_color_black(), LV_PART_SCROLLBAR);
+    lv_obj_set_style_width(cont, 4, LV_PART_SCROLLBAR);
+    lv_obj_set_style_border_width(cont, 3, 0);
+    lv_obj_set_style_border_color(cont, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_radius(cont, 6, 0);
+    lv_obj_set_scrollbar_mode(cont, LV_SCROLLBAR_MODE_ON);
+    lv_refr_now(disp);
+
+    /*The moved scrollbars and the corners are redrawn, but not the whole object*/
+    uint32_t px = scroll_and_refr(0, -10);
+    TEST_ASSERT_LESS_THAN(180 * 130 / 2, px);
+    lv_test_disp_check_full_redraw();
+
+    px = scroll_and_refr(-8, 0);
+    TEST_ASSERT_LESS_THAN(180 * 130 / 2, px);
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_scroll_blit_fallback(void)
+{
+#if LV_USE_SCROLL_BLIT
+    create_disp(true);
+
+    /*Something is drawn on the object. `lv_obj_invalidate()` adds 5 px around the object.*/
+    lv_obj_t * overlay = lv_obj_create(lv_disp_get_scr_act(disp));
+    lv_obj_set_pos(overlay, 50, 50);
+    lv_obj_set_size(overlay, 40, 40);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(190 * 140, scroll_and_refr(0, -10));
+    lv_test_disp_check_full_redraw();
+
+    /*It's not on the object anymore*/
+    lv_obj_set_pos(overlay, 150, 145);
+    lv_obj_set_size(overlay, 40, 5);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(180 * 10, scroll_and_refr(0, -10));
+    lv_test_disp_check_full_redraw();
+
+    /*A transparent background*/
+    lv_obj_set_style_bg_opa(cont, LV_OPA_50, 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(190 * 140, scroll_and_refr(0, -10));
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+void test_scroll_blit_scroll_more_than_size(void)
+{
+#if LV_USE_SCROLL_BLIT
+    create_disp(true);
+
+    TEST_ASSERT_EQUAL(180 * 130, scroll_and_refr(0, -140));
+    lv_test_disp_check_full_redraw();
+#endif
+}
+
+#endif
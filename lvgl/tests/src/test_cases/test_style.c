@@ -2,7 +2,11 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_indev.h"
 #include <unistd.h>
+#include <time.h>
+
+#include "../test_files/test_styles_gen.h"
 
 static void obj_set_height_helper(void * obj, int32_t height)
 {
@@ -106,4 +110,357 @@ void test_inherit_meta_with_lower_precedence_style(void)
     TEST_ASSERT_EQUAL_HEX(lv_color_hex(0xff0000).full, lv_obj_get_style_text_color(grandchild, LV_PART_MAIN).full);
 }
 
+void test_obj_style_cache(void)
+{
+    /*The previous tests leave objects with styles from their stack*/
+    lv_obj_clean(lv_scr_act());
+
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_t * label = lv_label_create(parent);
+
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_color(&style, lv_color_hex(0x00ff00));
+    lv_style_set_bg_opa(&style, LV_OPA_50);
+
+    /*Local style*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0xff0000), LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_HEX(lv_color_hex(0xff0000).full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x0000ff), LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_HEX(lv_color_hex(0x0000ff).full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+
+    /*State of the parent affects the inherited value*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0xffffff), LV_STATE_CHECKED);
+    lv_obj_add_state(parent, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_HEX(lv_color_hex(0xffffff).full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+    lv_obj_clear_state(parent, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_HEX(lv_color_hex(0x0000ff).full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+
+    /*Add and remove a style, also with disabled style refresh*/
+    lv_obj_add_style(label, &style, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_HEX(lv_color_hex(0x00ff00).full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(label, LV_PART_MAIN));
+    lv_obj_enable_style_refresh(false);
+    lv_obj_remove_style(label, &style, LV_PART_MAIN);
+    lv_obj_enable_style_refresh(true);
+    TEST_ASSERT_EQUAL_HEX(lv_color_hex(0x0000ff).full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+
+    /*Modify a shared style*/
+    lv_obj_add_style(parent, &style, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_bg_opa(parent, LV_PART_MAIN));
+    lv_style_set_bg_opa(&style, LV_OPA_30);
+    TEST_ASSERT_EQUAL(LV_OPA_30, lv_obj_get_style_bg_opa(parent, LV_PART_MAIN));
+
+    /*New parent*/
+    lv_obj_t * parent2 = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x123456), LV_PART_MAIN);
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_HEX(lv_color_hex(0x123456).full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+
+    /*Transition: the start and end values are read while the state is changed temporarily*/
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_OPA, 0};
+    static lv_style_transition_dsc_t trans;
+    lv_style_transition_dsc_init(&trans, props, lv_anim_path_linear, 100, 0, NULL);
+    lv_obj_set_style_bg_opa(parent2, LV_OPA_0, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(parent2, LV_OPA_100, LV_STATE_PRESSED);
+    lv_obj_set_style_transition(parent2, &trans, LV_STATE_PRESSED);
+    lv_obj_add_state(parent2, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(LV_OPA_0, lv_obj_get_style_bg_opa(parent2, LV_PART_MAIN));
+    lv_test_indev_wait(50);
+    lv_opa_t opa_mid = lv_obj_get_style_bg_opa(parent2, LV_PART_MAIN);
+    TEST_ASSERT_TRUE(opa_mid > LV_OPA_0 && opa_mid < LV_OPA_100);
+    lv_test_indev_wait(100);
+    TEST_ASSERT_EQUAL(LV_OPA_100, lv_obj_get_style_bg_opa(parent2, LV_PART_MAIN));
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*Repeated reads of unchanged objects are served from the cache*/
+    lv_obj_style_cache_stat_t stat;
+    lv_obj_reset_style_cache_stat();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_obj_get_style_cache_stat(&stat);
+    uint32_t miss_first = stat.miss_cnt;
+    TEST_ASSERT_TRUE(miss_first > 0);
+
+    lv_obj_reset_style_cache_stat();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_obj_get_style_cache_stat(&stat);
+    TEST_PRINTF("style cache on redraw: %d hits, %d misses", (int)stat.hit_cnt, (int)stat.miss_cnt);
+    TEST_ASSERT_TRUE(stat.hit_cnt > stat.miss_cnt);
+    TEST_ASSERT_TRUE(stat.miss_cnt < miss_first);
+#endif
+
+    lv_obj_del(parent);
+    lv_obj_del(parent2);
+    lv_style_reset(&style);
+}
+
+void test_obj_style_cache_pool(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    lv_obj_clean(lv_scr_act());
+
+    /*More objects than caches: the least recently read ones lose their cache*/
+    lv_obj_t * objs[LV_OBJ_STYLE_CACHE_OBJ_CNT + 4];
+    uint32_t cnt = sizeof(objs) / sizeof(objs[0]);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        objs[i] = lv_obj_create(lv_scr_act());
+        lv_obj_set_style_bg_opa(objs[i], (lv_opa_t)i, LV_PART_MAIN);
+    }
+
+    lv_obj_style_cache_stat_t stat;
+    lv_obj_reset_style_cache_stat();
+    uint32_t round;
+    for(round = 0; round < 2; round++) {
+        for(i = 0; i < cnt; i++) {
+            TEST_ASSERT_EQUAL(i, lv_obj_get_style_bg_opa(objs[i], LV_PART_MAIN));
+        }
+    }
+    lv_obj_get_style_cache_stat(&stat);
+    TEST_ASSERT_TRUE(stat.evict_cnt >= cnt);
+
+    /*The caches of the deleted objects are free again*/
+    for(i = 0; i < 8; i++) lv_obj_del(objs[i]);
+
+    lv_obj_reset_style_cache_stat();
+    for(round = 0; round < 2; round++) {
+        for(i = 8; i < cnt; i++) {
+            TEST_ASSERT_EQUAL(i, lv_obj_get_style_bg_opa(objs[i], LV_PART_MAIN));
+        }
+    }
+    lv_obj_get_style_cache_stat(&stat);
+    TEST_ASSERT_EQUAL(0, stat.evict_cnt);
+    TEST_ASSERT_EQUAL(cnt - 8, stat.hit_cnt);
+
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+void test_obj_style_cache_per_obj(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    lv_obj_clean(lv_scr_act());
+
+    /*An object with a transition, its label and an other object*/
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_OPA, 0};
+    static lv_style_transition_dsc_t trans;
+    lv_style_transition_dsc_init(&trans, props, lv_anim_path_linear, 100, 0, NULL);
+    lv_obj_t * anim_obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_bg_opa(anim_obj, LV_OPA_0, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(anim_obj, LV_OPA_100, LV_STATE_PRESSED);
+    lv_obj_set_style_transition(anim_obj, &trans, LV_STATE_PRESSED);
+    lv_obj_t * label = lv_label_create(anim_obj);
+    lv_obj_t * other = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_bg_opa(other, LV_OPA_40, LV_PART_MAIN);
+
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_opa(&style, LV_OPA_20);
+    lv_obj_t * styled = lv_obj_create(lv_scr_act());
+    lv_obj_add_style(styled, &style, LV_PART_MAIN);
+    lv_refr_now(NULL);
+
+    /*Animating one object doesn't drop the cache of the others.
+     *Only the animations run between the reads, so nothing else can take the cached entries.*/
+    lv_obj_add_state(anim_obj, LV_STATE_PRESSED);
+    lv_obj_get_style_bg_opa(label, LV_PART_MAIN);     /*The state of the parent has dropped its cache*/
+    lv_obj_style_cache_stat_t stat;
+    lv_opa_t opa_prev = LV_OPA_0;
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_tick_inc(20);
+        lv_anim_refr_now();
+        lv_opa_t opa = lv_obj_get_style_bg_opa(anim_obj, LV_PART_MAIN);
+        TEST_ASSERT_GREATER_OR_EQUAL(opa_prev, opa);
+        opa_prev = opa;
+
+        lv_obj_reset_style_cache_stat();
+        TEST_ASSERT_EQUAL(LV_OPA_40, lv_obj_get_style_bg_opa(other, LV_PART_MAIN));
+        TEST_ASSERT_EQUAL(LV_OPA_20, lv_obj_get_style_bg_opa(styled, LV_PART_MAIN));
+        /*The label doesn't inherit the animated property*/
+        lv_obj_get_style_bg_opa(label, LV_PART_MAIN);
+        lv_obj_get_style_cache_stat(&stat);
+        TEST_ASSERT_EQUAL(3, stat.hit_cnt);
+        TEST_ASSERT_EQUAL(0, stat.miss_cnt);
+        TEST_ASSERT_EQUAL(0, stat.flush_cnt);
+    }
+    TEST_ASSERT_TRUE(opa_prev > LV_OPA_0 && opa_prev < LV_OPA_100);
+
+    /*Modifying a style drops only the cache of its users*/
+    lv_obj_reset_style_cache_stat();
+    lv_style_set_bg_opa(&style, LV_OPA_60);
+    TEST_ASSERT_EQUAL(LV_OPA_60, lv_obj_get_style_bg_opa(styled, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(LV_OPA_40, lv_obj_get_style_bg_opa(other, LV_PART_MAIN));
+    lv_obj_get_style_cache_stat(&stat);
+    TEST_ASSERT_EQUAL(1, stat.hit_cnt);
+    TEST_ASSERT_EQUAL(1, stat.flush_cnt);
+
+    /*A state change of a parent drops the cache of its children*/
+    lv_obj_set_style_text_color(anim_obj, lv_color_hex(0xff0000), LV_STATE_CHECKED);
+    lv_color_t text_color = lv_obj_get_style_text_color(label, LV_PART_MAIN);
+    lv_obj_add_state(anim_obj, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_HEX(lv_color_hex(0xff0000).full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+    lv_obj_clear_state(anim_obj, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_HEX(text_color.full, lv_obj_get_style_text_color(label, LV_PART_MAIN).full);
+
+    lv_obj_clean(lv_scr_act());
+    lv_style_reset(&style);
+#endif
+}
+
+static uint32_t get_props_ns(const lv_obj_t * obj, uint32_t rounds, bool cached)
+{
+    clock_t start = clock();
+    uint32_t r;
+    for(r = 0; r < rounds; r++) {
+        if(!cached) _lv_obj_style_cache_invalidate();
+        const lv_style_const_prop_t * p;
+        for(p = style_wide_props; p->prop != LV_STYLE_PROP_INV; p++) {
+            volatile lv_style_value_t v = lv_obj_get_style_prop(obj, LV_PART_MAIN, p->prop);
+            LV_UNUSED(v);
+        }
+    }
+    double ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC;
+    return (uint32_t)(ns / ((double)rounds * _LV_STYLE_CONST_ARRAY_CNT(style_wide_props)));
+}
+
+void test_style_sorted_props(void)
+{
+    /*The same properties unsorted in a const style, sorted in a const style and set in a normal style*/
+    LV_STYLE_CONST_INIT(style_wide_unsorted, style_wide_props);
+    lv_style_t style_rt;
+    lv_style_init(&style_rt);
+    int32_t i;
+    int32_t cnt = (int32_t)_LV_STYLE_CONST_ARRAY_CNT(style_wide_props);
+    for(i = cnt - 1; i >= 0; i--) {
+        lv_style_set_prop(&style_rt, style_wide_props[i].prop, style_wide_props[i].value);
+    }
+    /*Remove and add again a few to check that the order is kept*/
+    lv_style_remove_prop(&style_rt, LV_STYLE_BG_OPA);
+    lv_style_remove_prop(&style_rt, LV_STYLE_WIDTH);
+    lv_style_set_width(&style_rt, 200);
+    lv_style_set_bg_opa(&style_rt, LV_OPA_COVER);
+    TEST_ASSERT_EQUAL(cnt, style_rt.prop_cnt);
+    TEST_ASSERT_EQUAL(cnt, style_wide.prop_cnt);
+
+    lv_style_prop_t prop;
+    for(prop = 1; prop <= _LV_STYLE_LAST_BUILT_IN_PROP; prop++) {
+        lv_style_value_t v1 = {0};
+        lv_style_value_t v2 = {0};
+        lv_style_value_t v3 = {0};
+        lv_style_res_t res1 = lv_style_get_prop(&style_wide_unsorted, prop, &v1);
+        lv_style_res_t res2 = lv_style_get_prop(&style_wide, prop, &v2);
+        lv_style_res_t res3 = lv_style_get_prop(&style_rt, prop, &v3);
+        TEST_ASSERT_EQUAL(res1, res2);
+        TEST_ASSERT_EQUAL(res1, res3);
+        TEST_ASSERT_EQUAL_MEMORY(&v1, &v2, sizeof(v1));
+        TEST_ASSERT_EQUAL_MEMORY(&v1, &v3, sizeof(v1));
+    }
+
+    lv_style_remove_prop(&style_rt, LV_STYLE_TEXT_ALIGN);
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style_rt, LV_STYLE_TEXT_ALIGN, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style_rt, LV_STYLE_OPA, &v));
+    TEST_ASSERT_EQUAL(LV_OPA_90, v.num);
+
+    /*Throughput of `lv_obj_get_style_prop()` with a wide style on an object*/
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * obj_unsorted = lv_obj_create(lv_scr_act());
+    lv_obj_t * obj_sorted = lv_obj_create(lv_scr_act());
+    lv_obj_t * obj_rt = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj_unsorted);
+    lv_obj_remove_style_all(obj_sorted);
+    lv_obj_remove_style_all(obj_rt);
+    lv_obj_add_style(obj_unsorted, (lv_style_t *)&style_wide_unsorted, 0);
+    lv_obj_add_style(obj_sorted, (lv_style_t *)&style_wide, 0);
+    lv_obj_add_style(obj_rt, &style_rt, 0);
+
+    uint32_t rounds = 5000;
+    TEST_PRINTF("lv_obj_get_style_prop, const linear: %d ns", (int)get_props_ns(obj_unsorted, rounds, false));
+    TEST_PRINTF("lv_obj_get_style_prop, const sorted: %d ns", (int)get_props_ns(obj_sorted, rounds, false));
+    TEST_PRINTF("lv_obj_get_style_prop, normal sorted: %d ns", (int)get_props_ns(obj_rt, rounds, false));
+#if LV_OBJ_STYLE_CACHE_SIZE
+    TEST_PRINTF("lv_obj_get_style_prop, cached: %d ns", (int)get_props_ns(obj_rt, rounds, true));
+#endif
+
+    lv_obj_del(obj_unsorted);
+    lv_obj_del(obj_sorted);
+    lv_obj_del(obj_rt);
+    lv_style_reset(&style_rt);
+}
+
+static uint32_t style_changed_cnt;
+
+static void style_changed_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    style_changed_cnt++;
+}
+
+void test_style_refresh_deferred(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_obj_update_layout(lv_scr_act());
+
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(parent, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_t * label = lv_label_create(parent);
+    lv_label_set_text(label, "Deferred");
+    lv_obj_add_event_cb(label, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    uint32_t i;
+    for(i = 0; i < 20; i++) lv_obj_create(parent);
+    lv_obj_update_layout(parent);
+    lv_coord_t label_w = lv_obj_get_width(label);
+
+    /*Inherited layout properties refresh all children*/
+    style_changed_cnt = 0;
+    lv_obj_reset_style_refr_stat();
+    lv_obj_set_style_text_letter_space(parent, 2, 0);
+    lv_obj_set_style_text_line_space(parent, 3, 0);
+    lv_obj_set_style_pad_all(parent, 5, 0);
+
+    static lv_style_t style1;
+    static lv_style_t style2;
+    lv_style_init(&style1);
+    lv_style_init(&style2);
+    lv_obj_add_style(label, &style1, 0);
+    lv_obj_add_style(label, &style2, 0);
+    lv_style_set_text_opa(&style1, LV_OPA_50);
+    lv_obj_report_style_change(&style1);
+    lv_style_set_text_opa(&style2, LV_OPA_70);
+    lv_obj_report_style_change(&style2);
+
+    /*A queued object can be deleted*/
+    lv_obj_t * tmp = lv_obj_create(parent);
+    lv_obj_set_style_bg_color(tmp, lv_color_black(), 0);
+    lv_obj_del(tmp);
+
+    lv_obj_update_layout(parent);
+
+    lv_obj_style_refr_stat_t stat;
+    lv_obj_get_style_refr_stat(&stat);
+    TEST_PRINTF("style refresh: %d requests, %d merged, %d tree walks instead of %d", (int)stat.refr_cnt,
+                (int)stat.refr_merged_cnt, (int)stat.walk_cnt, (int)stat.walk_req_cnt);
+    TEST_PRINTF("LV_EVENT_STYLE_CHANGED sent to the label %d times", (int)style_changed_cnt);
+
+#if LV_OBJ_STYLE_REFR_DEFER
+    /*One walk for the reports, one for the children of `parent` and one for the children of `label`*/
+    TEST_ASSERT_EQUAL_UINT32(3, stat.walk_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(stat.walk_cnt, stat.walk_req_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.refr_merged_cnt);
+#else
+    TEST_ASSERT_EQUAL_UINT32(stat.walk_req_cnt, stat.walk_cnt);
+#endif
+
+    /*The refresh is applied: the label is measured with the new letter space*/
+    TEST_ASSERT_GREATER_THAN(label_w, lv_obj_get_width(label));
+    TEST_ASSERT_EQUAL(5, label->coords.x1 - parent->coords.x1 - lv_obj_get_style_border_width(parent, 0));
+
+    lv_obj_del(parent);
+    lv_style_reset(&style1);
+    lv_style_reset(&style2);
+}
+
 #endif
@@ -112,6 +112,8 @@ void test_switch_should_update_extra_draw_size_after_editing_padding(void)
     lv_obj_remove_style_all(sw);
     lv_obj_add_style(sw, &style_knob, LV_PART_KNOB);
     lv_obj_center(sw);
+    /* Apply the style refresh if it's deferred */
+    lv_obj_update_layout(sw);
 
     /* Get extra draw size */
     actual = _lv_obj_get_ext_draw_size(sw);
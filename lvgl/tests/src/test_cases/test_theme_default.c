@@ -0,0 +1,234 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define INIT_ROUNDS     100
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+#if LV_THEME_DEFAULT_CONST
+
+static lv_theme_t * theme_init(bool use_const)
+{
+    lv_theme_default_use_const(use_const);
+    return lv_theme_default_init(lv_disp_get_default(), lv_palette_main(LV_PALETTE_BLUE),
+                                 lv_palette_main(LV_PALETTE_RED), false, LV_THEME_DEFAULT_FONT);
+}
+
+static void create_widgets(lv_obj_t * parent)
+{
+    lv_obj_t * obj;
+    lv_obj_create(parent);
+    lv_label_create(lv_btn_create(parent));
+    lv_bar_create(parent);
+    lv_slider_create(parent);
+    lv_switch_create(parent);
+    lv_checkbox_create(parent);
+    lv_arc_create(parent);
+    lv_spinner_create(parent, 1000, 60);
+    lv_line_create(parent);
+    lv_img_create(parent);
+    lv_led_create(parent);
+    lv_roller_create(parent);
+    lv_spinbox_create(parent);
+    lv_colorwheel_create(parent, true);
+    lv_calendar_header_arrow_create(lv_calendar_create(parent));
+    lv_keyboard_create(parent);
+    lv_meter_add_scale(lv_meter_create(parent));
+
+    obj = lv_dropdown_create(parent);
+    lv_dropdown_open(obj);
+
+    obj = lv_textarea_create(parent);
+    lv_textarea_set_placeholder_text(obj, "Placeholder");
+
+    obj = lv_table_create(parent);
+    lv_table_set_cell_value(obj, 1, 1, "Cell");
+
+    obj = lv_chart_create(parent);
+    lv_chart_add_series(obj, lv_palette_main(LV_PALETTE_GREEN), LV_CHART_AXIS_PRIMARY_Y);
+
+    obj = lv_list_create(parent);
+    lv_list_add_text(obj, "Text");
+    lv_list_add_btn(obj, LV_SYMBOL_OK, "Button");
+
+    obj = lv_tabview_create(parent, LV_DIR_TOP, 40);
+    lv_tabview_add_tab(obj, "Tab");
+
+    obj = lv_menu_create(parent);
+    lv_menu_set_page(obj, lv_menu_page_create(obj, "Page"));
+
+    lv_msgbox_create(parent, "Title", "Text", NULL, true);
+}
+
+static void assert_style_equal(const lv_style_t * style_rt, const lv_style_t * style_const)
+{
+    uint32_t prop;
+    for(prop = 1; prop <= _LV_STYLE_LAST_BUILT_IN_PROP; prop++) {
+        lv_style_value_t v_rt;
+        lv_style_value_t v_const;
+        lv_res_t res_rt = lv_style_get_prop(style_rt, prop, &v_rt);
+        lv_res_t res_const = lv_style_get_prop(style_const, prop, &v_const);
+        TEST_ASSERT_EQUAL_MESSAGE(res_rt, res_const, "property is missing");
+        if(res_rt != LV_RES_OK) continue;
+
+        /*The descriptors are different variables but they should describe the same*/
+        if(prop == LV_STYLE_TRANSITION) {
+            const lv_style_transition_dsc_t * t_rt = v_rt.ptr;
+            const lv_style_transition_dsc_t * t_const = v_const.ptr;
+            TEST_ASSERT_EQUAL_PTR(t_rt->props, t_const->props);
+            TEST_ASSERT_EQUAL_PTR(t_rt->path_xcb, t_const->path_xcb);
+            TEST_ASSERT_EQUAL(t_rt->time, t_const->time);
+            TEST_ASSERT_EQUAL(t_rt->delay, t_const->delay);
+        }
+        else if(prop == LV_STYLE_COLOR_FILTER_DSC) {
+            const lv_color_filter_dsc_t * f_rt = v_rt.ptr;
+            const lv_color_filter_dsc_t * f_const = v_const.ptr;
+            TEST_ASSERT_EQUAL_PTR(f_rt->filter_cb, f_const->filter_cb);
+        }
+        else if(prop == LV_STYLE_TEXT_FONT || prop == LV_STYLE_BG_IMG_SRC || prop == LV_STYLE_ARC_IMG_SRC ||
+                prop == LV_STYLE_ANIM) {
+            TEST_ASSERT_EQUAL_PTR(v_rt.ptr, v_const.ptr);
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT32_MESSAGE(v_rt.num, v_const.num, "different value");
+        }
+    }
+}
+
+static void assert_tree_equal(const lv_obj_t * obj_rt, const lv_obj_t * obj_const)
+{
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_class(obj_rt), lv_obj_get_class(obj_const));
+    TEST_ASSERT_EQUAL_UINT32(obj_rt->style_cnt, obj_const->style_cnt);
+
+    uint32_t i;
+    for(i = 0; i < obj_rt->style_cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT32(obj_rt->styles[i].selector, obj_const->styles[i].selector);
+        assert_style_equal(obj_rt->styles[i].style, obj_const->styles[i].style);
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj_rt);
+    TEST_ASSERT_EQUAL_UINT32(child_cnt, lv_obj_get_child_cnt(obj_const));
+    for(i = 0; i < child_cnt; i++) {
+        assert_tree_equal(lv_obj_get_child(obj_rt, i), lv_obj_get_child(obj_const, i));
+    }
+}
+#endif /*LV_THEME_DEFAULT_CONST*/
+
+/*Runs first, before anything initializes the runtime styles*/
+void test_theme_default_const_ram_and_init_time(void)
+{
+#if LV_THEME_DEFAULT_CONST
+    lv_obj_clean(lv_scr_act());
+
+    /*Measure without the style change report of the screen*/
+    lv_theme_t * th_prev = lv_disp_get_theme(NULL);
+    lv_disp_set_theme(NULL, NULL);
+
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor_t mon_end;
+    lv_mem_monitor(&mon_start);
+    theme_init(true);
+    lv_mem_monitor(&mon_end);
+    uint32_t ram_const = mon_start.free_size - mon_end.free_size;
+
+    lv_mem_monitor(&mon_start);
+    theme_init(false);
+    lv_mem_monitor(&mon_end);
+    uint32_t ram_rt = mon_start.free_size - mon_end.free_size;
+
+    TEST_PRINTF("default theme RAM, runtime: %d bytes, const: %d bytes", (int)ram_rt, (int)ram_const);
+    TEST_ASSERT_EQUAL_UINT32(0, ram_const);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, ram_rt);
+#endif
+
+    uint32_t i;
+    clock_t start = clock();
+    for(i = 0; i < INIT_ROUNDS; i++) theme_init(false);
+    double us_rt = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / INIT_ROUNDS;
+
+    start = clock();
+    for(i = 0; i < INIT_ROUNDS; i++) theme_init(true);
+    double us_const = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / INIT_ROUNDS;
+
+    TEST_PRINTF("default theme init, runtime: %d us, const: %d us", (int)us_rt, (int)us_const);
+    TEST_ASSERT_TRUE(us_const <= us_rt);
+
+    lv_disp_set_theme(NULL, th_prev);
+#endif
+}
+
+void test_theme_default_const_matches_runtime(void)
+{
+#if LV_THEME_DEFAULT_CONST
+    lv_obj_clean(lv_scr_act());
+
+    /*The test display and the default parameters match the precompiled styles*/
+    TEST_ASSERT_TRUE(lv_theme_default_is_const());
+
+    theme_init(false);
+    TEST_ASSERT_FALSE(lv_theme_default_is_const());
+    lv_obj_t * cont_rt = lv_obj_create(lv_scr_act());
+    create_widgets(cont_rt);
+
+    theme_init(true);
+    TEST_ASSERT_TRUE(lv_theme_default_is_const());
+    lv_obj_t * cont_const = lv_obj_create(lv_scr_act());
+    create_widgets(cont_const);
+
+    assert_tree_equal(cont_rt, cont_const);
+
+    /*Other parameters are built in RAM*/
+    lv_theme_default_init(lv_disp_get_default(), lv_palette_main(LV_PALETTE_GREEN),
+                          lv_palette_main(LV_PALETTE_RED), false, LV_THEME_DEFAULT_FONT);
+    TEST_ASSERT_FALSE(lv_theme_default_is_const());
+    lv_theme_default_init(lv_disp_get_default(), lv_palette_main(LV_PALETTE_BLUE),
+                          lv_palette_main(LV_PALETTE_RED), true, LV_THEME_DEFAULT_FONT);
+    TEST_ASSERT_FALSE(lv_theme_default_is_const());
+    lv_theme_default_init(lv_disp_get_default(), lv_palette_main(LV_PALETTE_BLUE),
+                          lv_palette_main(LV_PALETTE_RED), false, &lv_font_montserrat_14);
+    TEST_ASSERT_FALSE(lv_theme_default_is_const());
+
+    theme_init(true);
+    lv_obj_clean(lv_scr_act());
+#endif
+}
+
+/*The widgets demo initializes the theme with its own font for the display size.
+ *Like on the board, `LV_THEME_DEFAULT_FONT` is set to it so the demo gets the precompiled styles.*/
+void test_theme_default_const_widgets_demo(void)
+{
+#if LV_THEME_DEFAULT_CONST && LV_USE_DEMO_WIDGETS
+    /*The demo stays on its own screen. Deleting it at once is not safe in this version of LVGL:
+     *the destructor of its dropdown updates the layout of the half deleted tabview.*/
+    lv_obj_t * scr_prev = lv_scr_act();
+    lv_scr_load(lv_obj_create(NULL));
+
+    /*Start from the runtime styles to see that the demo selects the const set itself*/
+    lv_theme_default_init(lv_disp_get_default(), lv_palette_main(LV_PALETTE_GREEN),
+                          lv_palette_main(LV_PALETTE_RED), false, LV_THEME_DEFAULT_FONT);
+    TEST_ASSERT_FALSE(lv_theme_default_is_const());
+
+    lv_demo_widgets();
+    TEST_ASSERT_TRUE(lv_theme_default_is_const());
+    TEST_ASSERT_EQUAL_PTR(LV_THEME_DEFAULT_FONT, lv_theme_get_font_normal(NULL));
+
+    lv_scr_load(scr_prev);
+    theme_init(true);
+#endif
+}
+
+#endif
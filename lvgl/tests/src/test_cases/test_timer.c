@@ -0,0 +1,353 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define CALL_LOG_SIZE   64
+
+static uint32_t call_log[CALL_LOG_SIZE];
+static uint32_t call_cnt;
+static lv_timer_t * other_timer;
+
+void setUp(void)
+{
+    call_cnt = 0;
+    other_timer = NULL;
+}
+
+void tearDown(void)
+{
+}
+
+/*Log the ID of the timer stored in the user data*/
+static void log_cb(lv_timer_t * timer)
+{
+    TEST_ASSERT_LESS_THAN_UINT32(CALL_LOG_SIZE, call_cnt);
+    call_log[call_cnt] = (uint32_t)(uintptr_t)timer->user_data;
+    call_cnt++;
+}
+
+static void self_del_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_del(timer);
+}
+
+static void del_other_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    if(other_timer) {
+        lv_timer_del(other_timer);
+        other_timer = NULL;
+    }
+}
+
+static void create_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_t * t = lv_timer_create(log_cb, 0, (void *)100);
+    lv_timer_set_repeat_count(t, 1);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+typedef struct {
+    uint32_t next;      /*Expected tick of the next run*/
+    uint32_t late_max;
+    uint32_t run_cnt;
+} deadline_t;
+
+/*Check that the timer doesn't run before its deadline and log the lateness*/
+static void deadline_cb(lv_timer_t * timer)
+{
+    deadline_t * d = timer->user_data;
+    uint32_t now = lv_tick_get();
+    TEST_ASSERT_TRUE((int32_t)(now - d->next) >= 0);
+    d->late_max = LV_MAX(d->late_max, now - d->next);
+    d->next = now + timer->period;
+    d->run_cnt++;
+}
+
+/*Step the time and call the handler in every ms*/
+static void run_ms(uint32_t ms)
+{
+    uint32_t i;
+    for(i = 0; i < ms; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+}
+
+void test_timer_period_order(void)
+{
+    lv_timer_t * t1 = lv_timer_create(log_cb, 33, (void *)1);
+    lv_timer_t * t2 = lv_timer_create(log_cb, 10, (void *)2);
+    lv_timer_t * t3 = lv_timer_create(log_cb, 25, (void *)3);
+
+    run_ms(9);
+    TEST_ASSERT_EQUAL_UINT32(0, call_cnt);
+
+    run_ms(24);
+    TEST_ASSERT_EQUAL_UINT32(5, call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, call_log[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, call_log[1]);
+    TEST_ASSERT_EQUAL_UINT32(3, call_log[2]);
+    TEST_ASSERT_EQUAL_UINT32(2, call_log[3]);
+    TEST_ASSERT_EQUAL_UINT32(1, call_log[4]);
+
+    lv_timer_del(t1);
+    lv_timer_del(t2);
+    lv_timer_del(t3);
+}
+
+void test_timer_same_deadline_order(void)
+{
+    /*With the same deadline the newer timer runs first, in every period*/
+    lv_timer_t * timers[8];
+    uint32_t i;
+    for(i = 0; i < 8; i++) timers[i] = lv_timer_create(log_cb, 30, (void *)(uintptr_t)i);
+
+    run_ms(30);
+    run_ms(30);
+    TEST_ASSERT_EQUAL_UINT32(16, call_cnt);
+    for(i = 0; i < 16; i++) {
+        TEST_ASSERT_EQUAL_UINT32(7 - i % 8, call_log[i]);
+    }
+
+    for(i = 0; i < 8; i++) lv_timer_del(timers[i]);
+}
+
+void test_timer_pause_resume(void)
+{
+    lv_timer_t * t = lv_timer_create(log_cb, 10, (void *)1);
+
+    run_ms(10);
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+
+    lv_timer_pause(t);
+    lv_timer_pause(t);      /*Pausing twice is harmless*/
+    run_ms(50);
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+
+    /*The period has already elapsed so it runs immediately*/
+    lv_timer_resume(t);
+    lv_timer_resume(t);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_till_next());
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+
+    run_ms(10);
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+
+    /*A paused timer can be deleted*/
+    lv_timer_pause(t);
+    lv_timer_del(t);
+    run_ms(20);
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t = lv_timer_create(log_cb, 5, (void *)1);
+    lv_timer_set_repeat_count(t, 3);
+
+    run_ms(14);
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+    TEST_ASSERT_TRUE(timer_exists(t));
+
+    /*Deleted automatically after the last run*/
+    run_ms(1);
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t));
+
+    /*Setting zero repeat count deletes the timer in the next call without running it*/
+    t = lv_timer_create(log_cb, 1000, (void *)2);
+    lv_timer_set_repeat_count(t, 0);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t));
+}
+
+void test_timer_delete_in_callback(void)
+{
+    lv_timer_t * t1 = lv_timer_create(self_del_cb, 10, (void *)1);
+    lv_timer_t * t2 = lv_timer_create(del_other_cb, 5, (void *)2);
+    other_timer = lv_timer_create(log_cb, 5, (void *)3);
+    lv_timer_t * t3 = other_timer;
+
+    /*t2 and t3 are due at the same time, t3 runs only if it comes first*/
+    run_ms(5);
+    TEST_ASSERT_FALSE(timer_exists(t3));
+    TEST_ASSERT_NULL(other_timer);
+    uint32_t cnt_after_t2 = call_cnt;
+    TEST_ASSERT_TRUE(cnt_after_t2 == 1 || cnt_after_t2 == 2);
+
+    run_ms(5);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+    TEST_ASSERT_EQUAL_UINT32(cnt_after_t2 + 2, call_cnt);
+
+    run_ms(20);
+    TEST_ASSERT_EQUAL_UINT32(cnt_after_t2 + 6, call_cnt);
+    uint32_t i;
+    for(i = cnt_after_t2 + 2; i < call_cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT32(2, call_log[i]);
+    }
+
+    lv_timer_del(t2);
+}
+
+void test_timer_create_in_callback(void)
+{
+    lv_timer_t * t = lv_timer_create(create_cb, 10, (void *)1);
+
+    /*The new timer is ready so it runs in the same call*/
+    run_ms(10);
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, call_log[0]);
+    TEST_ASSERT_EQUAL_UINT32(100, call_log[1]);
+
+    lv_timer_del(t);
+}
+
+void test_timer_ready_and_reset(void)
+{
+    lv_timer_t * t = lv_timer_create(log_cb, 1000, (void *)1);
+
+    lv_timer_ready(t);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+
+    run_ms(600);
+    lv_timer_reset(t);
+    run_ms(999);
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+    run_ms(1);
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+
+    /*A shorter period is applied immediately*/
+    lv_timer_set_period(t, 10);
+    run_ms(10);
+    TEST_ASSERT_EQUAL_UINT32(3, call_cnt);
+
+    lv_timer_del(t);
+}
+
+void test_timer_zero_period_runs_once_per_call(void)
+{
+    lv_timer_t * t = lv_timer_create(log_cb, 0, (void *)1);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+
+    run_ms(5);
+    TEST_ASSERT_EQUAL_UINT32(6, call_cnt);
+
+    lv_timer_del(t);
+}
+
+void test_timer_time_till_next(void)
+{
+    /*Let the built-in timers run and set the time relative to them*/
+    lv_timer_handler();
+    uint32_t builtin = lv_timer_get_time_till_next();
+
+    lv_timer_t * t = lv_timer_create(log_cb, 3, (void *)1);
+    TEST_ASSERT_EQUAL_UINT32(LV_MIN(builtin, 3), lv_timer_get_time_till_next());
+    TEST_ASSERT_EQUAL_UINT32(LV_MIN(builtin, 3), lv_timer_handler());
+
+    lv_tick_inc(3);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_till_next());
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+
+    lv_timer_del(t);
+
+    /*A very long period doesn't overflow the deadline*/
+    t = lv_timer_create(log_cb, UINT32_MAX - 10, (void *)2);
+    lv_timer_t * t2 = lv_timer_create(log_cb, 7, (void *)3);
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+    lv_tick_inc(2);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, call_log[1]);
+
+    lv_timer_del(t);
+    lv_timer_del(t2);
+}
+
+void test_timer_many(void)
+{
+    static lv_timer_t * timers[500];
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        timers[i] = lv_timer_create(NULL, 1 + (i * 37) % 100, NULL);
+        if(i % 3 == 0) lv_timer_pause(timers[i]);
+    }
+
+    run_ms(200);
+
+    for(i = 0; i < 500; i++) {
+        if(i % 2 == 0) lv_timer_del(timers[i]);
+    }
+
+    /*Half of the timers remain, some of them paused*/
+    lv_timer_t * t1 = lv_timer_create(log_cb, 1, (void *)1);
+    run_ms(10);
+    TEST_ASSERT_EQUAL_UINT32(10, call_cnt);
+
+    for(i = 0; i < 500; i++) {
+        if(i % 2 == 1) lv_timer_del(timers[i]);
+    }
+    lv_timer_del(t1);
+}
+
+void test_timer_tickless_loop(void)
+{
+    /*Simulate a run loop which sleeps until the time returned by the handler,
+     *with a fake tick source which jumps over the sleeping time.
+     *An interrupt wakes up the loop early in every 7 ms.*/
+    static const uint32_t periods[] = {16, 30, 100};
+    static deadline_t d[3];
+    static lv_timer_t * timers[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_memset_00(&d[i], sizeof(d[i]));
+        d[i].next = lv_tick_get() + periods[i];
+        timers[i] = lv_timer_create(deadline_cb, periods[i], &d[i]);
+    }
+
+    uint32_t elapsed = 0;
+    uint32_t next_irq = 7;
+    uint32_t wakeup_cnt = 0;
+    while(elapsed < 1000) {
+        uint32_t sleep = lv_timer_handler();
+        TEST_ASSERT_GREATER_THAN_UINT32(0, sleep);
+        if(elapsed + sleep >= next_irq) {
+            sleep = next_irq - elapsed;
+            next_irq += 7;
+        }
+        lv_tick_inc(sleep);
+        elapsed += sleep;
+        wakeup_cnt++;
+    }
+
+    TEST_PRINTF("tickless loop: %d wake-ups in 1000 ms", (int)wakeup_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(1000 / 7 + 1000 / 16 + 1000 / 30 * 2, wakeup_cnt);
+    for(i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, d[i].late_max);
+        TEST_ASSERT_EQUAL_UINT32(999 / periods[i], d[i].run_cnt);
+        lv_timer_del(timers[i]);
+    }
+}
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file test_styles_gen.h
+ * Generated by `scripts/style_api_gen.py --const-styles test_styles.json`. Don't edit.
+ * The properties of the styles are sorted by their ID.
+ */
+
+static const lv_style_const_prop_t style_wide_props[] = {
+    LV_STYLE_CONST_WIDTH(200),
+    LV_STYLE_CONST_HEIGHT(100),
+    LV_STYLE_CONST_RADIUS(8),
+    LV_STYLE_CONST_PAD_TOP(10),
+    LV_STYLE_CONST_PAD_BOTTOM(11),
+    LV_STYLE_CONST_PAD_LEFT(12),
+    LV_STYLE_CONST_PAD_RIGHT(13),
+    LV_STYLE_CONST_PAD_ROW(5),
+    LV_STYLE_CONST_PAD_COLUMN(6),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x20, 0x40, 0x60)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0x60, 0x40, 0x20)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x10, 0x10, 0x10)),
+    LV_STYLE_CONST_BORDER_OPA(LV_OPA_50),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_OUTLINE_WIDTH(3),
+    LV_STYLE_CONST_OUTLINE_PAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(10),
+    LV_STYLE_CONST_SHADOW_OFS_Y(4),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_30),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_TEXT_LETTER_SPACE(1),
+    LV_STYLE_CONST_TEXT_LINE_SPACE(2),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_OPA(LV_OPA_90),
+    LV_STYLE_CONST_ANIM_TIME(300),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_SORTED_INIT(style_wide, style_wide_props, 0x7F);
@@ -1,9 +1,11 @@
 /**
  * @file lv_port_disp.c
- * Порт дисплея LVGL для STM32F746IGT + LTDC + SDRAM (двойная буферизация)
+ * Порт дисплея LVGL для STM32F746IGT + LTDC + SDRAM
+ * (двойная буферизация или один фреймбуфер с отрисовкой за лучом)
  */
 
 #include "lv_port_disp.h"
+#include "lv_port_trace.h"
 #include "main.h"
 #include "stm32746g_lcd.h"
 #include "ltdc.h"
@@ -20,10 +22,19 @@ extern DMA2D_HandleTypeDef hdma2d;  // используется LVGL при LV_U
  * Константы
  *----------------------------------------------------------------*/
 #define ACTIVE_LAYER        0
+#define OVERLAY_LAYER       1
 
-/* Два фреймбуфера в SDRAM */
+/* Два фреймбуфера в SDRAM (с LV_BUF_TYPE == 1 только первый) */
 static __IO uint16_t *framebuffer_1 = (__IO uint16_t *)LCD_FB_START_ADDRESS;
+#if LV_BUF_TYPE == 3
 static __IO uint16_t *framebuffer_2 = (__IO uint16_t *)(LCD_FB_START_ADDRESS + LCD_FB_SIZE_BYTES);
+#endif
+
+#if LV_BUF_TYPE == 1
+/* Позиция счётчика строк LTDC (от начала VSYNC) для первой видимой строки и число строк в кадре */
+#define SCAN_FIRST_LINE     (hltdc.Init.AccumulatedVBP + 1)
+#define SCAN_TOTAL_LINES    (hltdc.Init.TotalHeigh + 1)
+#endif
 
 /*-----------------------------------------------------------------
  * Глобальные переменные
@@ -31,12 +42,47 @@ static __IO uint16_t *framebuffer_2 = (__IO uint16_t *)(LCD_FB_START_ADDRESS + L
 static lv_disp_drv_t disp_drv;
 
 static volatile bool disp_update_enabled = true;
+#if LV_USE_DISP_PAN
+static bool pan_restore = false;     // после панорамирования вернуть обычный фреймбуфер
+#endif
+#if LV_USE_DISP_FADE
+static bool fade_active = false;     // слой 1 показывает проявляющийся экран
+static bool fade_restore = false;    // после перехода вернуть обычный фреймбуфер и слой 1
+#endif
+#if LV_USE_DISP_OVERLAY
+static bool overlay_shown = false;   // на верхнем или системном слое что-то нарисовано, слой 1 включён
+static lv_area_t overlay_area;       // окно слоя 1: область, в которой нарисовано всё содержимое оверлея
+#endif
+#if LV_BUF_TYPE == 1
+static volatile uint32_t scan_frame = 0;       // номер кадра, растёт на первой видимой строке
+static volatile uint32_t scan_event_pos = 0;   // позиция, на которую запрограммировано прерывание по строке
+static volatile uint32_t scan_wait_pos = 0;    // позиция, которую ждёт disp_scan_wait, 0: не ждём
+static volatile bool scan_reached = false;
+#endif
 
 /*-----------------------------------------------------------------
  * Прототипы
  *----------------------------------------------------------------*/
 static void disp_init(void);
 static void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+#if LV_BUF_TYPE == 1
+static void scan_init(void);
+static void scan_program(uint32_t pos);
+static lv_coord_t disp_scan_line(lv_disp_drv_t *disp_drv, uint32_t *frame);
+static void disp_scan_wait(lv_disp_drv_t *disp_drv, lv_coord_t line);
+#endif
+#if LV_USE_DISP_PAN
+static void disp_pan(lv_disp_drv_t *disp_drv, const lv_color_t *buf, lv_coord_t stride);
+#endif
+#if LV_USE_DISP_FADE
+static void disp_fade(lv_disp_drv_t *disp_drv, const lv_color_t *under, const lv_color_t *over, lv_opa_t opa);
+#endif
+#if LV_USE_DISP_OVERLAY
+static uint16_t *overlay_init(void);
+static void overlay_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area);
+static void overlay_set_area(lv_disp_drv_t *disp_drv, const lv_area_t *area);
+static void overlay_layer_config(lv_disp_drv_t *disp_drv);
+#endif
 
 /*-----------------------------------------------------------------
  * Публичные функции
@@ -49,24 +95,59 @@ void lv_port_disp_init(void)
 {
     disp_init();
 
-#if LV_BUF_TYPE == 3
+#if LV_BUF_TYPE == 3 || LV_BUF_TYPE == 1
     static lv_disp_draw_buf_t draw_buf;
 
+#if LV_BUF_TYPE == 3
     lv_disp_draw_buf_init(&draw_buf,
                           (void *)framebuffer_1,
                           (void *)framebuffer_2,
                           MY_DISP_HOR_RES * MY_DISP_VER_RES);
+#else
+    // Один фреймбуфер: LTDC читает тот же буфер, в который рисует LVGL
+    lv_disp_draw_buf_init(&draw_buf,
+                          (void *)framebuffer_1,
+                          NULL,
+                          MY_DISP_HOR_RES * MY_DISP_VER_RES);
+#endif
 
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res      = MY_DISP_HOR_RES;
     disp_drv.ver_res      = MY_DISP_VER_RES;
     disp_drv.flush_cb     = disp_flush;
     disp_drv.draw_buf     = &draw_buf;
+#if LV_BUF_TYPE == 1
+    // Изменённые области рисуются полосами сразу за лучом LTDC: полоса готова раньше,
+    // чем луч вернётся к ней в следующем кадре
+    disp_drv.direct_mode  = 1;
+    disp_drv.scan_line_cb = disp_scan_line;
+    disp_drv.scan_wait_cb = disp_scan_wait;
+    scan_init();
+#elif LV_USE_SCROLL_BLIT
+    // LVGL сам копирует изменения в другой буфер, перерисовываются только изменённые области,
+    // а при прокрутке пиксели сдвигаются через DMA2D
+    disp_drv.direct_mode  = 1;
+#else
     disp_drv.full_refresh = 1;          // обязательно для двойной буферизации
+#endif
+#if LV_USE_DISP_PAN
+    // Горизонтальные переходы экранов и tileview показываются сдвигом окна LTDC
+    disp_drv.pan_cb       = disp_pan;
+#endif
+#if LV_USE_DISP_OVERLAY
+    // Верхний и системный слои LVGL рисуются в слой 1 LTDC и смешиваются аппаратно
+    disp_drv.overlay_buf      = overlay_init();
+    disp_drv.overlay_flush_cb = overlay_flush;
+    disp_drv.overlay_area_cb  = overlay_set_area;
+#endif
+#if LV_USE_DISP_FADE
+    // Переходы FADE_IN/OUT: два экрана смешиваются слоями LTDC, меняется только постоянная альфа
+    disp_drv.fade_cb          = disp_fade;
+#endif
 
     lv_disp_drv_register(&disp_drv);
 #else
-    #error "Поддерживается только LV_BUF_TYPE == 3 (двойная буферизация полного экрана)"
+    #error "Поддерживается только LV_BUF_TYPE == 3 (двойная буферизация) или 1 (один фреймбуфер)"
 #endif
 }
 
@@ -101,9 +182,10 @@ static void disp_init(void)
 
 /**
  * Функция передачи данных на дисплей (flush callback)
- * При использовании двойной буферизации + full_refresh:
+ * При использовании двойной буферизации + full_refresh (или direct_mode):
  *   - копирование не требуется
  *   - просто меняем адрес фреймбуфера в LTDC
+ *   - в direct_mode адрес меняется только после последней области кадра
  */
 static void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
 {
@@ -113,12 +195,333 @@ static void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_
         return;
     }
 
+#if LV_BUF_TYPE == 1
+    // Один фреймбуфер: полосу нужно выгрузить из кэша до того, как луч к ней вернётся.
+    // D-кэш всего 4 КБ, очистить его целиком быстрее, чем весь буфер по адресам
+    SCB_CleanDCache();
+#endif
+
+    // Кадр ещё не готов, буфер переключится после последней области
+    if (!lv_disp_flush_is_last(disp_drv))
+    {
+        lv_disp_flush_ready(disp_drv);
+        return;
+    }
+
+#if LV_BUF_TYPE == 3
     // Очистка кэша данных (обязательно!)
     SCB_CleanDCache_by_Addr((uint32_t *)color_p, LCD_FB_SIZE_BYTES);
+#endif
+
+#if LV_USE_DISP_PAN
+    if (pan_restore)
+    {
+        // Адрес и шаг строки меняются одной перезагрузкой теневых регистров
+        HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)color_p, ACTIVE_LAYER);
+        HAL_LTDC_SetPitch_NoReload(&hltdc, MY_DISP_HOR_RES, ACTIVE_LAYER);
+        HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_IMMEDIATE);
+        pan_restore = false;
+        lv_port_trace_disp_show();
+        lv_disp_flush_ready(disp_drv);
+        return;
+    }
+#endif
 
+#if LV_USE_DISP_FADE
+    if (fade_restore)
+    {
+        // Слой 1 снова показывает оверлей (или выключается), всё одной перезагрузкой
+#if LV_USE_DISP_OVERLAY
+        if (disp_drv->overlay_buf)
+        {
+            overlay_layer_config(disp_drv);
+        }
+        else
+#endif
+        {
+            __HAL_LTDC_LAYER_DISABLE(&hltdc, OVERLAY_LAYER);
+        }
+        HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)color_p, ACTIVE_LAYER);
+        HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_IMMEDIATE);
+        fade_restore = false;
+        lv_port_trace_disp_show();
+        lv_disp_flush_ready(disp_drv);
+        return;
+    }
+#endif
+
+#if LV_BUF_TYPE == 3
     // Переключаем активный фреймбуфер в LTDC
     HAL_LTDC_SetAddress(&hltdc, (uint32_t)color_p, ACTIVE_LAYER);
+#endif
+    lv_port_trace_disp_show();
 
     // Сообщаем LVGL, что буфер готов
     lv_disp_flush_ready(disp_drv);
 }
+
+#if LV_USE_DISP_PAN
+/**
+ * Показать окно холста двойной ширины с заранее отрисованными экранами (pan callback)
+ *   - LTDC читает строки с шагом stride, начиная с buf
+ *   - buf == NULL: панорамирование закончено, обычный буфер вернётся в следующем disp_flush
+ */
+static void disp_pan(lv_disp_drv_t *disp_drv, const lv_color_t *buf, lv_coord_t stride)
+{
+    LV_UNUSED(disp_drv);
+
+    if (buf == NULL)
+    {
+        pan_restore = true;
+        return;
+    }
+
+    if (!disp_update_enabled) return;
+
+    // Холст отрисован процессором, его нужно выгрузить из кэша
+    SCB_CleanDCache();
+
+    // Новое окно применяется в вертикальном гашении, без разрыва изображения.
+    // HAL_LTDC_SetAddress пересчитывает шаг строки по ширине слоя, поэтому шаг ставится после адреса
+    HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)buf, ACTIVE_LAYER);
+    HAL_LTDC_SetPitch_NoReload(&hltdc, stride, ACTIVE_LAYER);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+#endif
+
+#if LV_USE_DISP_FADE
+/**
+ * Показать экран over с прозрачностью opa поверх экрана under (fade callback)
+ *   - слой 0 показывает under, слой 1 (вместо оверлея) показывает over в RGB565
+ *   - в кадрах перехода меняется только постоянная альфа слоя 1
+ *   - under == NULL: переход закончен, обычный буфер вернётся в следующем disp_flush
+ */
+static void disp_fade(lv_disp_drv_t *disp_drv, const lv_color_t *under, const lv_color_t *over, lv_opa_t opa)
+{
+    LV_UNUSED(disp_drv);
+
+    if (under == NULL)
+    {
+        fade_active = false;
+        fade_restore = true;
+        return;
+    }
+
+    if (!disp_update_enabled) return;
+
+    if (!fade_active)
+    {
+        // Экраны отрисованы процессором, их нужно выгрузить из кэша
+        SCB_CleanDCache();
+
+        HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)under, ACTIVE_LAYER);
+        // Окно слоя 1 могло быть уменьшено до содержимого оверлея
+        HAL_LTDC_SetWindowSize_NoReload(&hltdc, MY_DISP_HOR_RES, MY_DISP_VER_RES, OVERLAY_LAYER);
+        HAL_LTDC_SetWindowPosition_NoReload(&hltdc, 0, 0, OVERLAY_LAYER);
+        HAL_LTDC_SetPixelFormat_NoReload(&hltdc, LTDC_PIXEL_FORMAT_RGB565, OVERLAY_LAYER);
+        HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)over, OVERLAY_LAYER);
+        __HAL_LTDC_LAYER_ENABLE(&hltdc, OVERLAY_LAYER);
+        fade_active = true;
+    }
+
+    // Новая прозрачность применяется в вертикальном гашении, без разрыва изображения
+    HAL_LTDC_SetAlpha_NoReload(&hltdc, opa, OVERLAY_LAYER);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+#endif
+
+#if LV_USE_DISP_OVERLAY
+/**
+ * Буфер оверлея для слоя 1 LTDC
+ *   - ARGB4444, буфер в SDRAM из пула LVGL, изначально полностью прозрачный
+ *   - слой был выключен в main() до инициализации LVGL и остаётся выключенным,
+ *     пока на верхнем и системном слоях ничего не нарисовано (см. overlay_set_area)
+ *   - NULL: нет памяти, слои рисуются на экране как обычно
+ */
+static uint16_t *overlay_init(void)
+{
+    uint32_t size = MY_DISP_HOR_RES * MY_DISP_VER_RES * sizeof(uint16_t);
+    uint16_t *buf = lv_mem_alloc_hint(size, LV_MEM_HINT_BULK);
+    if (buf == NULL) return NULL;
+
+    lv_memset_00(buf, size);
+    SCB_CleanDCache_by_Addr((uint32_t *)buf, size);
+
+    return buf;
+}
+
+/**
+ * Оверлей обновлён (overlay flush callback)
+ *   - LTDC читает буфер напрямую, достаточно выгрузить изменённые строки из кэша
+ */
+static void overlay_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area)
+{
+    uint16_t *row = disp_drv->overlay_buf + area->y1 * MY_DISP_HOR_RES;
+    uint32_t size = lv_area_get_height(area) * MY_DISP_HOR_RES * sizeof(uint16_t);
+
+    SCB_CleanDCache_by_Addr((uint32_t *)row, size);
+}
+
+/**
+ * Изменилась область с содержимым оверлея (overlay area callback)
+ *   - вне области буфер прозрачный, LTDC читает только окно слоя 1 с этой областью
+ *   - area == NULL: оверлей пуст, слой 1 выключается и не занимает шину SDRAM
+ *     (полноэкранный ARGB4444 1024x600 — это 1,2 МБ чтения в каждом кадре)
+ *   - во время перехода FADE слой 1 занят, окно применится в disp_flush после него
+ */
+static void overlay_set_area(lv_disp_drv_t *disp_drv, const lv_area_t *area)
+{
+    bool shown = area != NULL;
+    if (shown == overlay_shown && (!shown || _lv_area_is_equal(area, &overlay_area))) return;
+
+    overlay_shown = shown;
+    if (shown) lv_area_copy(&overlay_area, area);
+
+#if LV_USE_DISP_FADE
+    if (fade_active || fade_restore) return;
+#endif
+
+    // Новое окно применяется в вертикальном гашении, без разрыва изображения
+    overlay_layer_config(disp_drv);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+
+/**
+ * Настройка слоя 1 LTDC для оверлея (без перезагрузки теневых регистров)
+ *   - ARGB4444, постоянная альфа 255, прозрачность задаёт альфа каждого пикселя (PAxCA)
+ *   - окно и адрес — область overlay_area, строки буфера по-прежнему MY_DISP_HOR_RES пикселей
+ *   - HAL пересчитывает шаг строки по ширине окна при каждой настройке, поэтому шаг ставится последним
+ */
+static void overlay_layer_config(lv_disp_drv_t *disp_drv)
+{
+    if (!overlay_shown)
+    {
+        __HAL_LTDC_LAYER_DISABLE(&hltdc, OVERLAY_LAYER);
+        return;
+    }
+
+    uint16_t *start = disp_drv->overlay_buf + overlay_area.y1 * MY_DISP_HOR_RES + overlay_area.x1;
+
+    HAL_LTDC_SetWindowSize_NoReload(&hltdc, lv_area_get_width(&overlay_area),
+                                    lv_area_get_height(&overlay_area), OVERLAY_LAYER);
+    HAL_LTDC_SetWindowPosition_NoReload(&hltdc, overlay_area.x1, overlay_area.y1, OVERLAY_LAYER);
+    HAL_LTDC_SetPixelFormat_NoReload(&hltdc, LTDC_PIXEL_FORMAT_ARGB4444, OVERLAY_LAYER);
+    HAL_LTDC_SetAlpha_NoReload(&hltdc, 255, OVERLAY_LAYER);
+    HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)start, OVERLAY_LAYER);
+    HAL_LTDC_SetPitch_NoReload(&hltdc, MY_DISP_HOR_RES, OVERLAY_LAYER);
+    __HAL_LTDC_LAYER_ENABLE(&hltdc, OVERLAY_LAYER);
+}
+#endif
+
+#if LV_BUF_TYPE == 1
+/**
+ * Настройка прерывания LTDC по строке
+ *   - прерывание стоит на первой видимой строке и считает кадры
+ *   - disp_scan_wait на время ожидания переставляет его на нужную строку
+ */
+static void scan_init(void)
+{
+    scan_event_pos = SCAN_FIRST_LINE;
+    HAL_LTDC_ProgramLineEvent(&hltdc, scan_event_pos);
+
+    HAL_NVIC_SetPriority(LTDC_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(LTDC_IRQn);
+}
+
+/**
+ * Перепрограммировать прерывание по строке из прерывания или при запрещённых прерываниях
+ *   - HAL_LTDC_ProgramLineEvent берёт блокировку дескриптора и может вернуть HAL_BUSY,
+ *     если прерывание пришло во время другого вызова HAL, поэтому регистр пишется напрямую
+ */
+static void scan_program(uint32_t pos)
+{
+    scan_event_pos = pos;
+    LTDC->LIPCR = pos;
+    __HAL_LTDC_ENABLE_IT(&hltdc, LTDC_IT_LI);
+}
+
+/**
+ * Прерывание LTDC по строке (вызывается из HAL_LTDC_IRQHandler)
+ *   - на первой видимой строке начинается новый кадр
+ *   - на ожидаемой строке будим disp_scan_wait
+ *   - следующее событие: ожидаемая строка этого кадра или начало следующего
+ */
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc_p)
+{
+    LV_UNUSED(hltdc_p);
+
+    if (scan_event_pos == SCAN_FIRST_LINE)
+    {
+        scan_frame++;
+    }
+    else
+    {
+        scan_reached = true;
+        scan_wait_pos = 0;
+    }
+
+    if (scan_wait_pos > scan_event_pos) scan_program(scan_wait_pos);
+    else scan_program(SCAN_FIRST_LINE);
+}
+
+/**
+ * Строка, которую сейчас выводит LTDC (scan line callback)
+ *   - 0..MY_DISP_VER_RES-1: видимые строки, дальше гашение
+ *   - frame растёт, когда луч снова доходит до строки 0
+ */
+static lv_coord_t disp_scan_line(lv_disp_drv_t *disp_drv, uint32_t *frame)
+{
+    LV_UNUSED(disp_drv);
+
+    uint32_t f;
+    uint32_t pos;
+    do
+    {
+        f = scan_frame;
+        pos = LTDC->CPSR & LTDC_CPSR_CYPOS;
+
+        // Луч уже прошёл первую видимую строку, а прерывание ещё не обработано
+        if (pos >= SCAN_FIRST_LINE && scan_event_pos == SCAN_FIRST_LINE &&
+            (LTDC->ISR & LTDC_ISR_LIF)) f++;
+
+        // Новый кадр начался во время чтения: читаем заново
+    } while ((int32_t)(scan_frame - f) > 0);
+
+    *frame = f;
+
+    // Синхроимпульс и задняя площадка относятся к гашению предыдущего кадра
+    if (pos < SCAN_FIRST_LINE) return pos + SCAN_TOTAL_LINES - SCAN_FIRST_LINE;
+    return pos - SCAN_FIRST_LINE;
+}
+
+/**
+ * Дождаться, пока LTDC дойдёт до строки line (scan wait callback)
+ *   - прерывание по строке переставляется на line, процессор спит до него
+ *   - если луч ещё в синхроимпульсе, сначала сработает начало кадра, оно и переставит прерывание
+ */
+static void disp_scan_wait(lv_disp_drv_t *disp_drv, lv_coord_t line)
+{
+    LV_UNUSED(disp_drv);
+
+    uint32_t pos = SCAN_FIRST_LINE + line;
+
+    __disable_irq();
+    uint32_t cur = LTDC->CPSR & LTDC_CPSR_CYPOS;
+    if (cur >= pos || (LTDC->ISR & LTDC_ISR_LIF))
+    {
+        // Строка уже пройдена или прерывание ждёт обработки: LVGL проверит положение луча ещё раз
+        __enable_irq();
+        return;
+    }
+
+    scan_reached = false;
+    scan_wait_pos = pos;
+    if (cur >= SCAN_FIRST_LINE) scan_program(pos);
+    __enable_irq();
+
+    while (!scan_reached)
+    {
+        __WFI();
+    }
+}
+#endif
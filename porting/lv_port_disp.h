@@ -22,7 +22,12 @@ extern "C" {
 #define MY_DISP_VER_RES     600
 
 // Тип буферизации: 3 = двойная буферизация полного экрана (рекомендуется)
+//                  1 = один фреймбуфер, полосы рисуются вслед за лучом LTDC (LV_USE_DISP_BEAM)
+#if LV_USE_DISP_BEAM
+#define LV_BUF_TYPE         1
+#else
 #define LV_BUF_TYPE         3
+#endif
 
 // Размер одного кадра в байтах (RGB565 = 2 байта на пиксель)
 #define LCD_FB_SIZE_BYTES   ((uint32_t)(MY_DISP_HOR_RES * MY_DISP_VER_RES * 2))
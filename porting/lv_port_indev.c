@@ -12,27 +12,34 @@
 #include "lv_port_indev.h"
 #include "../lvgl/lvgl.h"
 #include "GT911.h"
+#include "lv_port_trace.h"
 #include <stdio.h>
 /*********************
  *      DEFINES
  *********************/
 
+/*The GT911 reports in every ~10 ms while touched. Without a report for this long
+ *the release report is assumed to be lost.*/
+#define TOUCH_RELEASE_TIMEOUT   100
+
+/*Smoothing of the touch points: 3 Hz cutoff at rest, +2 Hz per 100 px/s*/
+#define TOUCH_FILTER_MIN_CUTOFF 30
+#define TOUCH_FILTER_BETA       20
+
+/*Extrapolate the touch points by about a refresh period, the time of rendering and swapping the
+ *frame buffers. Check it with LV_USE_LATENCY_TRACE.*/
+#define TOUCH_PREDICT_TIME      LV_DISP_DEF_REFR_PERIOD
+
 /**********************
  *      TYPEDEFS
  **********************/
 //TS_StateTypeDef  TS_State={0};
-extern uint8_t TS_flag;
-TouchCoordinate_t cordinate[5] = { 0 };
-uint8_t number;
-GT911_Status_t status = 0;
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
 static void touchpad_init(void);
 static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
-static bool touchpad_is_pressed(void);
-static void touchpad_get_xy(lv_coord_t *x, lv_coord_t *y);
 
 static void mouse_init(void);
 static void mouse_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data);
@@ -99,6 +106,11 @@ void lv_port_indev_init(void)
 	lv_indev_drv_init(&indev_drv);
 	indev_drv.type = LV_INDEV_TYPE_POINTER;
 	indev_drv.read_cb = touchpad_read;
+#if LV_USE_INDEV_FILTER
+	indev_drv.filter.min_cutoff = TOUCH_FILTER_MIN_CUTOFF;
+	indev_drv.filter.beta = TOUCH_FILTER_BETA;
+	indev_drv.filter.predict_time = TOUCH_PREDICT_TIME;
+#endif
 	indev_touchpad = lv_indev_drv_register(&indev_drv);
 #if 0
     /*------------------
@@ -177,6 +189,18 @@ void lv_port_indev_init(void)
 #endif
 }
 
+/**
+ * Read the touchpad in the next `lv_timer_handler()` if it has signaled a touch,
+ * instead of waiting for the end of the read period
+ */
+void lv_port_indev_check_touch(void)
+{
+	if (GT911_IsSampleAvailable() && indev_touchpad)
+	{
+		lv_timer_ready(indev_touchpad->driver->read_timer);
+	}
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -191,63 +215,63 @@ static void touchpad_init(void)
 	/*Your code comes here*/
 }
 
-/*Will be called by the library to read the touchpad*/
+/*Will be called by the library to read the touchpad.
+ *Replays the samples queued by the background read of the GT911 one by one.*/
 static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
 {
 	static lv_coord_t last_x = 0;
 	static lv_coord_t last_y = 0;
+	static lv_indev_state_t last_state = LV_INDEV_STATE_REL;
+	static uint32_t last_tick = 0;
+#if LV_INDEV_MULTI_TOUCH_MAX
+	static lv_indev_touch_t last_touches[LV_INDEV_MULTI_TOUCH_MAX];
+	static uint8_t last_touch_cnt = 0;
+#endif
+	GT911_Sample_t sample;
+
+	lv_port_trace_sync();
 
-	/*Save the pressed coordinates and the state*/
-	if (touchpad_is_pressed())
+	if (GT911_GetSample(&sample))
 	{
-		touchpad_get_xy(&last_x, &last_y);
-		data->state = LV_INDEV_STATE_PR;
+		if (sample.count > 0)
+		{
+			last_x = sample.points[0].x;
+			last_y = sample.points[0].y;
+			last_state = LV_INDEV_STATE_PR;
+#if LV_INDEV_MULTI_TOUCH_MAX
+			/*Pass all the points with their tracking IDs for the two finger gestures*/
+			last_touch_cnt = LV_MIN(sample.count, LV_INDEV_MULTI_TOUCH_MAX);
+			for (uint8_t i = 0; i < last_touch_cnt; i++)
+			{
+				last_touches[i].point.x = sample.points[i].x;
+				last_touches[i].point.y = sample.points[i].y;
+				last_touches[i].id = sample.points[i].id;
+			}
+#endif
+		}
+		else
+		{
+			last_state = LV_INDEV_STATE_REL;
+		}
+		last_tick = sample.tick;
+		data->timestamp = sample.tick;
+
+		/*Process the rest of the queued samples in this read too*/
+		data->continue_reading = GT911_IsSampleAvailable();
 	}
-	else
+	else if (last_state == LV_INDEV_STATE_PR && lv_tick_elaps(last_tick) > TOUCH_RELEASE_TIMEOUT)
 	{
-		data->state = LV_INDEV_STATE_REL;
+		last_state = LV_INDEV_STATE_REL;
 	}
 
 	/*Set the last pressed coordinates*/
+	data->state = last_state;
 	data->point.x = last_x;
 	data->point.y = last_y;
-}
-
-/*Return true is the touchpad is pressed*/
-static bool touchpad_is_pressed(void)
-{
-	/*Your code comes here*/
-
-	return TS_flag;
-}
-
-/*Get the x and y coordinates if the touchpad is pressed*/
-static void touchpad_get_xy(lv_coord_t *x, lv_coord_t *y)
-{
-	/*Your code comes here*/
-
-	TS_flag = 0;
-
-	status = GT911_ReadTouch(cordinate, &number);
-
-	switch (status)
-	{
-	case GT911_OK:
-		(*x) = cordinate[0].x;
-		(*y) = cordinate[0].y;
-		break;
-
-	case GT911_Error:
-		printf("Error status!\n\r");
-		break;
-
-	case GT911_NotResponse:
-		printf("GT911_NotResponse!\n\r");
-		break;
-
-	default:
-		printf("Error status!\n\r");
-	}
+#if LV_INDEV_MULTI_TOUCH_MAX
+	data->touch_cnt = last_state == LV_INDEV_STATE_PR ? last_touch_cnt : 0;
+	lv_memcpy(data->touches, last_touches, sizeof(last_touches));
+#endif
 }
 
 /*------------------
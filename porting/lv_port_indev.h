@@ -32,6 +32,8 @@ extern "C" {
  **********************/
 void lv_port_indev_init(void);
 
+void lv_port_indev_check_touch(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,133 @@
+/**
+ * @file lv_port_tick.c
+ * Tickless idle for the LVGL run loop.
+ *
+ * While sleeping the SysTick is reloaded to expire at the requested deadline instead of every 1 ms,
+ * so the CPU is not woken up only to count ticks. After waking up (by the deadline or by any
+ * other interrupt) the elapsed whole ticks are added to the HAL tick and the SysTick is restarted
+ * to keep the phase of the tick.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_tick.h"
+#include "main.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Sleeping for shorter time is not worth reprogramming the SysTick*/
+#define MIN_TICKLESS_SLEEP  2
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t cycles_per_tick;
+static uint32_t max_sleep_ticks;
+static uint32_t systick_ctrl;   /*SysTick control bits except ENABLE*/
+static volatile uint8_t wake_pending;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_port_tick_init(void)
+{
+	cycles_per_tick = SysTick->LOAD + 1;
+	max_sleep_ticks = SysTick_LOAD_RELOAD_Msk / cycles_per_tick;
+	systick_ctrl = SysTick->CTRL & (SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk);
+	wake_pending = 0;
+}
+
+void lv_port_tick_sleep(uint32_t ms)
+{
+	uint32_t ticks = ms / (uint32_t)uwTickFreq;
+	if (ticks > max_sleep_ticks) ticks = max_sleep_ticks;
+
+	/*The interrupts stay pending until the tick is compensated but they still end WFI*/
+	__disable_irq();
+
+	if (wake_pending || ticks == 0 || (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+	{
+		wake_pending = 0;
+		__enable_irq();
+		return;
+	}
+
+	if (ticks < MIN_TICKLESS_SLEEP)
+	{
+		/*Wait for the next interrupt, at the latest the next SysTick*/
+		__DSB();
+		__WFI();
+		__ISB();
+		wake_pending = 0;
+		__enable_irq();
+		return;
+	}
+
+	/*Stop the SysTick and make it expire `ticks` ticks after the last tick.
+	 *Write CTRL without reading it to keep COUNTFLAG.*/
+	SysTick->CTRL = systick_ctrl;
+	uint32_t reload = SysTick->VAL + (ticks - 1) * cycles_per_tick;
+	SysTick->LOAD = reload;
+	SysTick->VAL = 0;
+	SysTick->CTRL = systick_ctrl | SysTick_CTRL_ENABLE_Msk;
+
+	__DSB();
+	__WFI();
+	__ISB();
+
+	SysTick->CTRL = systick_ctrl;
+
+	uint32_t ticks_slept;
+	uint32_t next_load;
+	if (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk)
+	{
+		/*Woken up by the deadline. The pending SysTick interrupt counts the last tick.
+		 *The counter has restarted from `reload`, so shorten the next tick by the overrun.*/
+		ticks_slept = ticks - 1;
+		uint32_t overrun = reload - SysTick->VAL;
+		if (overrun >= cycles_per_tick - 1) next_load = cycles_per_tick - 1;
+		else next_load = cycles_per_tick - 1 - overrun;
+	}
+	else
+	{
+		/*Woken up early by an other interrupt. Count the whole ticks and finish the current one.*/
+		uint32_t elapsed = ticks * cycles_per_tick - SysTick->VAL;
+		ticks_slept = elapsed / cycles_per_tick;
+		next_load = (ticks_slept + 1) * cycles_per_tick - elapsed;
+	}
+
+	uwTick += ticks_slept * (uint32_t)uwTickFreq;
+
+	SysTick->LOAD = next_load;
+	SysTick->VAL = 0;
+	SysTick->CTRL = systick_ctrl | SysTick_CTRL_ENABLE_Msk;
+	SysTick->LOAD = cycles_per_tick - 1;
+
+	wake_pending = 0;
+	__enable_irq();
+}
+
+void lv_port_tick_wake(void)
+{
+	wake_pending = 1;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
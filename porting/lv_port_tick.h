@@ -0,0 +1,60 @@
+/**
+ * @file lv_port_tick.h
+ * Tickless idle for the LVGL run loop: sleep with WFI until the next timer deadline
+ */
+
+#ifndef LV_PORT_TICK_H
+#define LV_PORT_TICK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the tickless idle. Call it after `HAL_Init()` and the clock configuration,
+ * as the SysTick period is read from the SysTick registers.
+ */
+void lv_port_tick_init(void);
+
+/**
+ * Sleep with WFI for at most `ms` milliseconds.
+ * The SysTick interrupts are stopped meanwhile and `HAL_GetTick()` (the tick of LVGL too)
+ * is compensated with the time spent in sleep.
+ * Any interrupt ends the sleep early.
+ * @param ms    time to sleep, typically the return value of `lv_timer_handler()`
+ */
+void lv_port_tick_sleep(uint32_t ms);
+
+/**
+ * Don't go to sleep in the next `lv_port_tick_sleep()`.
+ * Call it from the interrupts which have work for the run loop,
+ * in case they fire before `lv_port_tick_sleep()` is entered.
+ */
+void lv_port_tick_wake(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PORT_TICK_H*/
@@ -0,0 +1,145 @@
+/**
+ * @file lv_port_trace.c
+ * Touch-to-photon latency trace of the board.
+ *
+ * The time stamps are the cycles of the DWT counter (5 ns at 200 MHz), see `LV_LATENCY_TRACE_TIME_EXPR`
+ * in lv_conf.h. The interrupts only save their time stamp, as the latency trace can be called only from
+ * the context of `lv_timer_handler()`. The saved stamps are passed to it when the touchpad is read.
+ * Only the first interrupt is saved until the next read, as it's the start of the interaction.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_trace.h"
+#include "main.h"
+#include <stdio.h>
+
+#if LV_USE_LATENCY_TRACE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void save_time(volatile uint32_t *time, volatile uint8_t *saved);
+static void report_timer_cb(lv_timer_t *timer);
+static void report_print_cb(const char *line);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static volatile uint32_t irq_time;
+static volatile uint8_t irq_saved;
+static volatile uint32_t acquired_time;
+static volatile uint8_t acquired_saved;
+static uint32_t reported_cnt;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_port_trace_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	lv_latency_trace_reset();
+	reported_cnt = 0;
+	lv_timer_create(report_timer_cb, LV_PORT_TRACE_REPORT_PERIOD, NULL);
+}
+
+void lv_port_trace_input_irq(void)
+{
+	save_time(&irq_time, &irq_saved);
+}
+
+void lv_port_trace_input_acquired(void)
+{
+	save_time(&acquired_time, &acquired_saved);
+}
+
+void lv_port_trace_sync(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	uint8_t irq = irq_saved;
+	uint8_t acquired = acquired_saved;
+	uint32_t irq_t = irq_time;
+	uint32_t acquired_t = acquired_time;
+	irq_saved = 0;
+	acquired_saved = 0;
+	__set_PRIMASK(primask);
+
+	if (irq) lv_latency_trace_point_at(LV_LATENCY_TRACE_INPUT_IRQ, irq_t);
+	if (acquired) lv_latency_trace_point_at(LV_LATENCY_TRACE_INPUT_ACQUIRED, acquired_t);
+}
+
+void lv_port_trace_disp_show(void)
+{
+	/*The address is reloaded immediately, the LTDC continues scanning from the new buffer*/
+	lv_latency_trace_point(LV_LATENCY_TRACE_DISP_SHOW);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void save_time(volatile uint32_t *time, volatile uint8_t *saved)
+{
+	if (*saved) return;
+
+	*time = lv_latency_trace_get_time();
+	*saved = 1;
+}
+
+static void report_timer_cb(lv_timer_t *timer)
+{
+	LV_UNUSED(timer);
+
+	uint32_t cnt = lv_latency_trace_get_done_cnt();
+	if (cnt == reported_cnt) return;
+
+	reported_cnt = cnt;
+	lv_latency_trace_report(report_print_cb);
+}
+
+static void report_print_cb(const char *line)
+{
+	printf("%s\r\n", line);
+}
+
+#else /*LV_USE_LATENCY_TRACE*/
+
+void lv_port_trace_init(void)
+{
+}
+
+void lv_port_trace_input_irq(void)
+{
+}
+
+void lv_port_trace_input_acquired(void)
+{
+}
+
+void lv_port_trace_sync(void)
+{
+}
+
+void lv_port_trace_disp_show(void)
+{
+}
+
+#endif /*LV_USE_LATENCY_TRACE*/
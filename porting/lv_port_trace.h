@@ -0,0 +1,69 @@
+/**
+ * @file lv_port_trace.h
+ * Touch-to-photon latency trace of the board: time stamps of the GT911 interrupts and the LTDC
+ * buffer swap for `LV_USE_LATENCY_TRACE`, and a periodic report on the UART
+ */
+
+#ifndef LV_PORT_TRACE_H
+#define LV_PORT_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lvgl/lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Print the latency report in this period [ms] if there were new interactions*/
+#define LV_PORT_TRACE_REPORT_PERIOD     10000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start the DWT cycle counter used as time stamp and the report timer.
+ * Call it after `lv_init()`. Does nothing if `LV_USE_LATENCY_TRACE` is 0, as all the functions below.
+ */
+void lv_port_trace_init(void);
+
+/**
+ * Save the time of the touch interrupt. Call it from the EXTI interrupt of the touch INT pin.
+ */
+void lv_port_trace_input_irq(void);
+
+/**
+ * Save the time when the touch points are read. Call it from the I2C interrupt completing the read.
+ */
+void lv_port_trace_input_acquired(void);
+
+/**
+ * Pass the time stamps saved by the interrupts to the latency trace.
+ * Call it from the `read_cb` of the touchpad, before taking the sample.
+ */
+void lv_port_trace_sync(void);
+
+/**
+ * Mark that the LTDC has started showing a new frame. Call it after changing the address of the layer.
+ */
+void lv_port_trace_disp_show(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PORT_TRACE_H*/